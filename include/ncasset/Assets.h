@@ -4,10 +4,12 @@
  */
 #pragma once
 
+#include "AudioSampleFormat.h"
 #include "ncmath/Geometry.h"
 #include "DirectXMath.h"
 
 #include <array>
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -18,8 +20,9 @@ namespace nc::asset
 struct AudioClip
 {
     size_t samplesPerChannel;
-    std::vector<double> leftChannel;
-    std::vector<double> rightChannel;
+    AudioSampleFormat format;
+    std::vector<std::byte> leftChannel;
+    std::vector<std::byte> rightChannel;
 };
 
 struct VertexSpaceToBoneSpace
@@ -7,6 +7,7 @@
 namespace nc::asset
 {
 struct AudioClip;
+struct AudioClipLayout;
 struct BonesData;
 struct ConcaveCollider;
 struct CubeMap;
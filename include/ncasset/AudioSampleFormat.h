@@ -0,0 +1,24 @@
+/**
+ * @file AudioSampleFormat.h
+ * @copyright Jaremie Romer and McCallister Romer 2024
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace nc::asset
+{
+/** @brief Encoding of the PCM samples stored in an AudioClip. */
+enum class AudioSampleFormat : uint32_t
+{
+    Int16,
+    Float32
+};
+
+/** @brief Get the size in bytes of a single sample. */
+constexpr auto GetSampleSize(AudioSampleFormat format) noexcept -> size_t
+{
+    return format == AudioSampleFormat::Int16 ? sizeof(int16_t) : sizeof(float);
+}
+} // namespace nc::asset
@@ -12,12 +12,27 @@
 
 namespace nc::asset
 {
+/** @brief Location of an AudioClip's sample data within an .nca file. */
+struct AudioClipLayout
+{
+    size_t samplesPerChannel;
+    AudioSampleFormat format;
+    size_t leftChannelOffset;  // byte offset from the start of the file
+    size_t rightChannelOffset; // byte offset from the start of the file
+};
+
 /** @brief Read an AudioClip asset from an .nca file. */
 auto ImportAudioClip(const std::filesystem::path& ncaPath) -> AudioClip;
 
 /** @brief Read an AudioClip asset from a binary stream. */
 auto ImportAudioClip(std::istream& data) -> AudioClip;
 
+/**
+ * @brief Locate an AudioClip's samples in an .nca file without reading them.
+ * @note Only supported for version5 and later files, where samples are stored in their final format.
+ */
+auto ImportAudioClipLayout(const std::filesystem::path& ncaPath) -> AudioClipLayout;
+
 /** @brief Read a ConcaveCollider asset from an .nca file. */
 auto ImportConcaveCollider(const std::filesystem::path& ncaPath) -> ConcaveCollider;
 
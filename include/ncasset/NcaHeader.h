@@ -13,7 +13,8 @@
 namespace nc::asset
 {
 constexpr auto version4 = 4ull;
-constexpr auto currentVersion = version4;
+constexpr auto version5 = 5ull; // AudioClip samples stored as int16 or float32 instead of double
+constexpr auto currentVersion = version5;
 
 /** @brief Identifiers for asset blobs in .nca files. */
 struct MagicNumber
@@ -46,11 +46,27 @@ struct CubeMapUpdateEventData
     UpdateAction updateAction;
 };
 
-/** @brief Event data for mesh load and unload operations. */
+/** @brief A contiguous range of elements within the mesh vertex or index arena. */
+struct MeshArenaRange
+{
+    uint32_t offset;
+    uint32_t count;
+};
+
+/**
+ * @brief Event data for mesh load and unload operations.
+ *
+ * The vertex and index spans always cover the entire arena, including unallocated space. When
+ * reallocate is true the arena capacity or layout has changed and all data must be uploaded.
+ * Otherwise only the changed ranges need to be copied into the existing buffers.
+ */
 struct MeshUpdateEventData
 {
     std::span<const asset::MeshVertex> vertices;
     std::span<const uint32_t> indices;
+    std::span<const MeshArenaRange> changedVertices;
+    std::span<const MeshArenaRange> changedIndices;
+    bool reallocate;
 };
 
 /** @brief Event data for skeletal animation load and unload operations. */
@@ -6,9 +6,11 @@
 
 #include "ncengine/utility/EnumUtilities.h"
 
+#include "ncasset/AudioSampleFormat.h"
 #include "ncmath/Geometry.h"
 
 #include <concepts>
+#include <cstddef>
 #include <span>
 #include <string>
 
@@ -19,9 +21,10 @@ namespace nc::asset
 struct AudioClipView
 {
     size_t id;
-    std::span<const double> leftChannel;
-    std::span<const double> rightChannel;
+    std::span<const std::byte> leftChannel;
+    std::span<const std::byte> rightChannel;
     size_t samplesPerChannel;
+    AudioSampleFormat format;
 };
 
 struct ConcaveColliderView
@@ -11,6 +11,8 @@ struct AssetFlags
     static constexpr asset_flags_type None                 = 0b00000000;
     static constexpr asset_flags_type TextureTypeImage     = 0b00000001;
     static constexpr asset_flags_type TextureTypeNormalMap = 0b00000010;
+    static constexpr asset_flags_type MeshDefragment       = 0b00000100;
+    static constexpr asset_flags_type AudioClipStream      = 0b00001000;
 };
 
 /** Assets must be loaded before dependent objects are created and should be unloaded only
@@ -19,7 +21,10 @@ struct AssetFlags
  *  Paths should be relative to directories specified in the config. Passing true for isExternal
  *  allows paths to be absolute or relative to the executable. Duplicate loads are ignored. */
 
-/** Supported file types: .nca */
+/** Supported file types: .nca
+ *  @note Passing AssetFlags::AudioClipStream memory maps the clip instead of reading it into memory, so
+ *  only the portions being played are resident. Prefer it for long clips like music and ambience. Streaming
+ *  requires clips converted with nc-convert v5 or later; older files are loaded normally. */
 bool LoadAudioClipAsset(const std::string& path, bool isExternal = false, asset_flags_type flags = AssetFlags::None);
 bool LoadAudioClipAssets(std::span<const std::string> paths, bool isExternal = false, asset_flags_type flags = AssetFlags::None);
 bool UnloadAudioClipAsset(const std::string& path, asset_flags_type flags = AssetFlags::None);
@@ -47,8 +52,9 @@ bool UnloadCubeMapAsset(const std::string& paths, asset_flags_type flags = Asset
 void UnloadAllCubeMapAssets(asset_flags_type flags = AssetFlags::None);
 
 /** Supported file types: .nca 
- *  @note Unloading meshes invalidates all MeshViews. It is intended
- *  to be done on scene change. */
+ *  @note Meshes are suballocated from a shared arena, so unloading a mesh leaves other
+ *  MeshViews valid. Passing AssetFlags::MeshDefragment to UnloadMeshAsset compacts the
+ *  arena, which invalidates all MeshViews and requires a full geometry upload. */
 bool LoadMeshAsset(const std::string& path, bool isExternal = false, asset_flags_type flags = AssetFlags::None);
 bool LoadMeshAssets(std::span<const std::string> paths, bool isExternal = false, asset_flags_type flags = AssetFlags::None);
 bool UnloadMeshAsset(const std::string& path, asset_flags_type flags = AssetFlags::None);
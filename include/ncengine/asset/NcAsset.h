@@ -9,6 +9,8 @@
 
 #include "ncasset/AssetType.h"
 
+#include <future>
+
 namespace nc
 {
 namespace config
@@ -50,9 +52,29 @@ class NcAsset : public Module
         /** @brief Get the signal for Font load and unload events. */
         virtual auto OnFontUpdate() noexcept -> Signal<>& = 0;
 
-        /** @brief Load assets from an AssetMap. */
+        /**
+         * @brief Load assets from an AssetMap, blocking until they are available.
+         * 
+         * Files are imported in parallel on the thread pool and then committed in a single batch on the
+         * calling thread.
+         */
         virtual void LoadAssets(const AssetMap& assets) = 0;
 
+        /**
+         * @brief Begin loading assets from an AssetMap without blocking.
+         * 
+         * Files are imported in parallel on the thread pool. Once all imports in the request finish, they are
+         * committed together, and update signals are fired, by the next call to CommitPendingLoads(). The
+         * returned future becomes ready after the commit and rethrows any import error.
+         */
+        virtual auto LoadAssetsAsync(const AssetMap& assets) -> std::future<void> = 0;
+
+        /**
+         * @brief Commit asynchronous loads whose imports have finished, in the order they were requested.
+         * @note The engine calls this on the main thread between frames.
+         */
+        virtual void CommitPendingLoads() = 0;
+
         /** @brief Get the names of all loaded assets as an AssetMap. */
         virtual auto GetLoadedAssets() const noexcept -> AssetMap = 0;
 };
@@ -61,11 +83,13 @@ class NcAsset : public Module
  * @brief Build an NcAsset instance.
  * @param assetSettings Settings controlling asset search locations.
  * @param memorySettings Settings controlling memory limits.
+ * @param dispatcher Dispatcher used to import asset files in parallel.
  * @param defaults A collection of assets to be available by default.
  * @return An NcAsset instance.
  */
 auto BuildAssetModule(const config::AssetSettings& assetSettings,
                       const config::MemorySettings& memorySettings,
+                      const task::AsyncDispatcher& dispatcher,
                       AssetMap defaults) -> std::unique_ptr<NcAsset>;
 } // namespace asset
 } // namespace nc
@@ -29,6 +29,8 @@ struct AudioSourceProperties
     uint8_t flags = AudioSourceFlags::None;
 };
 
+struct StereoGain;
+
 /** @brief Indicates an invalid audio clip index. */
 constexpr auto NullClipIndex = UINT32_MAX;
 
@@ -115,13 +117,27 @@ class AudioSource : public ComponentBase
         std::vector<asset::AudioClipView> m_clips;
         uint32_t m_currentClipIndex = NullClipIndex;
         uint32_t m_currentSampleIndex = 0u;
+        float m_lastLeftGain = 0.0f;
+        float m_lastRightGain = 0.0f;
         AudioSourceProperties m_properties;
         std::unique_ptr<AudioSourceColdData> m_coldData;
 
         void SetPlaying() noexcept { m_properties.flags |= AudioSourceFlags::Play; }
         void SetStopped() noexcept { m_properties.flags &= ~AudioSourceFlags::Play; }
-        void WriteSpatialSamples(double* buffer, size_t frames, const Vector3& sourcePosition, const Vector3& listenerPosition, const Vector3& rightEar);
-        void WriteNonSpatialSamples(double* buffer, size_t frames);
+
+        // Gain the source should be mixed at this block. Spatial sources are silent beyond their outer radius.
+        auto ComputeGain(const Vector3& sourcePosition, const Vector3& listenerPosition, const Vector3& rightEar) const noexcept -> StereoGain;
+        auto ComputeGain() const noexcept -> StereoGain;
+
+        // Whether the previous block left the source audible, in which case culling it must still fade it out.
+        auto IsAudible() const noexcept -> bool { return m_lastLeftGain != 0.0f || m_lastRightGain != 0.0f; }
+
+        // Mix frames into an interleaved stereo buffer, ramping from the previous block's gain to the given gain.
+        template<class Sample>
+        void WriteSamples(Sample* buffer, size_t frames, const StereoGain& gain);
+
+        // Advance playback without mixing, for sources that are virtualized this block.
+        void Advance(size_t frames) noexcept;
 
         friend class NcAudioImpl;
 };
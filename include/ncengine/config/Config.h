@@ -18,10 +18,13 @@ struct ProjectSettings
 /** @brief Settings for configuring the engine run loop and executor. */
 struct EngineSettings
 {
-    float timeStep = 0.01667f;    // Set to 0 for variable time step
-    float maxTimeStep = 0.1f;     // Clamp delta time below this value
-    unsigned threadCount = 8u;    // Set to 0 to use std::hardware_concurrency
-    bool buildTasksOnInit = true; // Build tasks automatically on engine initialization or require explicit building
+    float timeStep = 0.01667f;     // Set to 0 for variable time step
+    float maxTimeStep = 0.1f;      // Clamp delta time below this value
+    unsigned maxStepsPerTick = 4u; // Max fixed steps run to catch up before rendering; time beyond this is dropped (>=1)
+    bool framePacing = false;      // Sleep until the next fixed step instead of polling the clock
+    unsigned threadCount = 8u;     // Set to 0 to use std::hardware_concurrency
+    bool buildTasksOnInit = true;  // Build tasks automatically on engine initialization or require explicit building
+    bool pipelineRender = false;   // Run render tasks for a frame concurrently with the next frame's update tasks
 };
 
 /**
@@ -102,6 +105,9 @@ struct PhysicsSettings
     float penetrationSlop = 0.02f;                  ///< distance objects are allowed to overlap (meters)
     float timeBeforeSleep = 0.5f;                   ///< time until objects are allowed to sleep (seconds)
     float sleepThreshold = 0.03f;                   ///< velocity below which objects are put to sleep (m/s)
+    bool groupContactEvents = false;                ///< deliver collision events grouped by receiving entity, dropping duplicates
+    float fixedTimeStep = 0.0f;                     ///< length of a physics step (seconds); 0 steps once per frame with the frame delta
+    unsigned maxSubsteps = 4u;                      ///< max fixed steps per frame; time beyond this is dropped (>=1)
 };
 
 /** @brief Options for configuring NcAudio. */
@@ -109,6 +115,8 @@ struct AudioSettings
 {
     bool enabled = true;
     unsigned bufferFrames = 512u; // must be a power of two in the range [16, 2048]
+    bool floatSamples = false;    // mix and stream 32-bit float samples instead of 64-bit
+    unsigned maxVoices = 64u;     // max sources mixed at once; quieter sources only advance playback
 };
 
 /** @brief A collection of all configuration options.
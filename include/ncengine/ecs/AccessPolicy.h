@@ -13,6 +13,7 @@
 
 #include <concepts>
 #include <type_traits>
+#include <utility>
 
 namespace nc::ecs
 {
@@ -26,8 +27,12 @@ concept PoolInvocable = std::invocable<F, decltype(std::declval<ComponentRegistr
 
 /**
  * @brief A proxy for ComponentRegistry providing filtered access to data pools.
+ *
+ * Listing a type grants read and write access to it, while listing a const-qualified type only grants read access.
+ * Access to a const type, and its pool, is read-only.
+ *
  * @tparam Base A FilterBase value indicating a baseline set of types to be added to the policy.
- * @tparam Includes A list types to include in addition to the base set.
+ * @tparam Includes A list types to include in addition to the base set, which may be const-qualified.
  */
 template<FilterBase Base, class... Includes>
 class AccessPolicy
@@ -43,7 +48,8 @@ class AccessPolicy
                 detail::MatchFilter<Entity, Hierarchy, Tag, Transform, detail::FreeComponentGroup, Includes...>,
                 detail::MatchFilter<detail::FreeComponentGroup, Includes...>>>;
 
-        /** @brief Indicates whether all requested types are accessible by the policy. */
+        /** @brief Indicates whether all requested types are accessible by the policy. Const-qualified types only
+         *         require read access. */
         template<class... TargetIncludes>
         static constexpr bool HasAccess = (FilterType::template included<TargetIncludes> && ...);
 
@@ -67,20 +73,15 @@ class AccessPolicy
             return AccessPolicy<TargetBase, TargetIncludes...>{*m_registry};
         }
 
-        /** @brief Get the pool for a given type. */
-        template<RegistryType T>
-            requires HasAccess<T>
+        /** @brief Get the pool for a given type. The pool is const if T is const-qualified. */
+        template<class T>
+            requires RegistryType<std::remove_const_t<T>> && HasAccess<T>
         auto GetPool() const -> decltype(auto)
         {
-            return m_registry->GetPool<T>();
-        }
-
-        /** @brief Get the pool for a given type. */
-        template<RegistryType T>
-            requires HasAccess<T>
-        auto GetPool() -> decltype(auto)
-        {
-            return m_registry->GetPool<T>();
+            if constexpr (std::is_const_v<T>)
+                return std::as_const(m_registry->GetPool<std::remove_const_t<T>>());
+            else
+                return m_registry->GetPool<T>();
         }
 
         /** @brief Get a range of pointers to all ComponentPoolBase instances. */
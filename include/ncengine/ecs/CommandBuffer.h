@@ -0,0 +1,85 @@
+/**
+ * @file CommandBuffer.h
+ * @copyright Jaremie Romer and McCallister Romer 2024
+ */
+#pragma once
+
+#include "ncengine/ecs/Ecs.h"
+
+#include <functional>
+#include <tuple>
+#include <vector>
+
+namespace nc::ecs
+{
+/**
+ * @brief Records structural changes to be applied to the registry at a later point.
+ *
+ * Commands are replayed in the order they were recorded. A CommandBuffer is not thread safe, but separate
+ * instances may be recorded concurrently, which allows logic running on worker threads to defer changes that
+ * would otherwise race with other readers of the affected pools.
+ */
+class CommandBuffer
+{
+    public:
+        /** @brief Type of a recorded command. */
+        using Command_t = std::move_only_function<void(Ecs)>;
+
+        /** @brief Record an arbitrary operation. */
+        template<std::invocable<Ecs> F>
+        void Push(F&& func)
+        {
+            m_commands.emplace_back(std::forward<F>(func));
+        }
+
+        /** @brief Record the creation of an entity. */
+        template<std::same_as<Entity> T>
+        void Emplace(EntityInfo info = {})
+        {
+            Push([info = std::move(info)](Ecs world) mutable { world.Emplace<Entity>(std::move(info)); });
+        }
+
+        /** @brief Record the addition of a component. Arguments are copied or moved into the buffer. */
+        template<Component T, class... Args>
+        void Emplace(Entity entity, Args&&... args)
+        {
+            Push([entity, args = std::make_tuple(std::forward<Args>(args)...)](Ecs world) mutable
+            {
+                std::apply([&](auto&&... unpacked)
+                {
+                    world.Emplace<T>(entity, std::move(unpacked)...);
+                }, std::move(args));
+            });
+        }
+
+        /** @brief Record the removal of an entity or component. */
+        template<RegistryType T>
+        void Remove(Entity entity)
+        {
+            Push([entity](Ecs world) { world.Remove<T>(entity); });
+        }
+
+        /** @brief Apply all recorded commands in order and clear the buffer. */
+        void Playback(Ecs world)
+        {
+            for (auto& command : m_commands)
+            {
+                command(world);
+            }
+
+            m_commands.clear();
+        }
+
+        /** @brief Discard all recorded commands. */
+        void Clear() noexcept { m_commands.clear(); }
+
+        /** @brief Get the number of recorded commands. */
+        auto size() const noexcept { return m_commands.size(); }
+
+        /** @brief Check if there are no recorded commands. */
+        [[nodiscard]] auto empty() const noexcept { return m_commands.empty(); }
+
+    private:
+        std::vector<Command_t> m_commands;
+};
+} // namespace nc::ecs
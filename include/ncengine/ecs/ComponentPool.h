@@ -5,6 +5,8 @@
 #pragma once
 
 #include "ncengine/ecs/AnyComponent.h"
+#include "ncengine/ecs/detail/EntitySignatures.h"
+#include "ncengine/ecs/detail/OwningGroup.h"
 #include "ncengine/ecs/detail/PoolUtility.h"
 #include "ncengine/ecs/detail/SparseSet.h"
 #include "ncengine/type/StableAddress.h"
@@ -12,11 +14,16 @@
 
 #include "ncutility/NcError.h"
 
+#include <algorithm>
 #include <cassert>
+#include <ranges>
+#include <span>
 #include <string_view>
 
 namespace nc::ecs
 {
+class ComponentRegistry;
+
 /** @brief Type-agnostic base class for component pools. */
 class ComponentPoolBase : public StableAddress
 {
@@ -90,8 +97,76 @@ class ComponentPoolBase : public StableAddress
 
         /** @brief Finalize pending changes by merging staged components and removing data for any
          *         entities deleted from the ComponentRegistry.
-         *  @note This operation is handled automatically for pools owned by the ComponentRegistry. */
-        virtual void CommitStagedComponents(const std::vector<Entity>& deleted) = 0;
+         *  @note This operation is handled automatically for pools owned by the ComponentRegistry, which only
+         *        passes deleted entities the pool actually holds. Removal is done as a single batch. */
+        virtual void CommitStagedComponents(std::span<const Entity> deleted) = 0;
+
+        /** @brief Get the group owning the pool, or nullptr if it is not grouped. */
+        auto GetOwningGroup() const noexcept -> const detail::OwningGroupState* { return m_group; }
+
+        /** @brief Get a counter which changes whenever committed components are added, removed, or moved, or when
+         *         MarkModified() is called. Useful for invalidating data derived from the pool's contents. */
+        auto Version() const noexcept -> uint64_t { return m_version; }
+
+        /** @brief Change the pool's Version() to signal an edit that doesn't move components, such as a change to
+         *         relationships stored in them. */
+        void MarkModified() noexcept { ++m_version; }
+
+    protected:
+        /** @brief Record that the pool holds data for an entity in the owning registry's signatures, if any. */
+        void MarkSignature(Entity entity) noexcept
+        {
+            if (m_signatures)
+                m_signatures->Set(entity.Index(), m_signatureBit);
+        }
+
+        /** @brief Record that the pool no longer holds data for an entity. */
+        void UnmarkSignature(Entity entity) noexcept
+        {
+            if (m_signatures)
+                m_signatures->Unset(entity.Index(), m_signatureBit);
+        }
+
+        /** @brief Move an entity into its owning group's prefix if it now has a committed component in every
+         *         owned pool. Call after committing a component. */
+        void EnterGroup(Entity entity)
+        {
+            if (!m_group || GetDenseIndex(entity) < m_group->size)
+                return;
+
+            const auto& pools = m_group->pools;
+            if (!std::ranges::all_of(pools, [entity](auto pool) { return pool->GetDenseIndex(entity) != Entity::NullIndex; }))
+                return;
+
+            for (auto pool : pools)
+                pool->SwapDense(pool->GetDenseIndex(entity), m_group->size);
+
+            ++m_group->size;
+        }
+
+        /** @brief Move an entity out of its owning group's prefix. Call before removing a committed component. */
+        void LeaveGroup(Entity entity)
+        {
+            if (!m_group || GetDenseIndex(entity) >= m_group->size)
+                return;
+
+            --m_group->size;
+            for (auto pool : m_group->pools)
+                pool->SwapDense(pool->GetDenseIndex(entity), m_group->size);
+        }
+
+    private:
+        friend class ComponentRegistry;
+        detail::EntitySignatures* m_signatures = nullptr;
+        detail::OwningGroupState* m_group = nullptr;
+        uint64_t m_version = 0ull;
+        uint32_t m_signatureBit = 0u;
+
+        /** @brief Get the position of an entity's committed component, or Entity::NullIndex. */
+        virtual auto GetDenseIndex(Entity entity) const noexcept -> Entity::index_type = 0;
+
+        /** @brief Exchange the committed components, and their entities, at two positions. */
+        virtual void SwapDense(size_t lhs, size_t rhs) = 0;
 };
 
 /** @brief Type-aware implementation for component pools. */
@@ -198,7 +273,7 @@ class ComponentPool final : public ComponentPoolBase
         auto GetAsAnyComponent(Entity entity) -> AnyComponent override;
         auto Remove(Entity entity) -> bool override;
         auto Size() const noexcept -> size_t override { return m_storage.Size(); }
-        auto StagedSize() const noexcept -> size_t override { return m_staging.size(); }
+        auto StagedSize() const noexcept -> size_t override { return m_staged.size(); }
         auto TotalSize() const noexcept -> size_t override { return Size() + StagedSize(); }
         void Reserve(size_t capacity) override;
         auto GetEntityPool() const noexcept -> std::span<const Entity> override { return m_storage.GetEntities(); }
@@ -213,15 +288,22 @@ class ComponentPool final : public ComponentPoolBase
         void Deserialize(std::istream& stream, Entity entity, const DeserializationContext& ctx) override;
         void ClearNonPersistent() override;
         void Clear() override;
-        void CommitStagedComponents(const std::vector<Entity>& deleted) override;
+        void CommitStagedComponents(std::span<const Entity> deleted) override;
 
     private:
         ecs::detail::SparseSet<T> m_storage;
-        std::vector<detail::StagedComponent<T>> m_staging;
+        std::vector<T> m_staged;               // indexed by m_storage's staged entries
+        std::vector<Entity> m_stagedEntities;  // parallel to m_staged
+        std::vector<Entity> m_removeBatch;
         ComponentHandler<T> m_handler;
         Signal<T&> m_onAdd;
         Signal<T&> m_onCommit;
         Signal<Entity> m_onRemove;
+
+        auto Stage(Entity entity, T&& component) -> T&;
+        auto RemoveStaged(Entity entity) -> bool;
+        auto GetDenseIndex(Entity entity) const noexcept -> Entity::index_type override;
+        void SwapDense(size_t lhs, size_t rhs) override;
 };
 
 /** @cond internal */
@@ -230,11 +312,8 @@ template<class... Args>
 auto ComponentPool<T>::Emplace(Entity entity, Args&&... args) -> T&
 {
     NC_ASSERT(entity.Index() < m_storage.MaxSize() && !Contains(entity), "Bad entity");
-    auto& [_, component] = m_staging.emplace_back(
-        entity,
-        detail::Construct<T>(entity, std::forward<Args>(args)...)
-    );
-
+    auto& component = Stage(entity, detail::Construct<T>(entity, std::forward<Args>(args)...));
+    MarkSignature(entity);
     if constexpr(StoragePolicy<T>::EnableOnAddCallbacks)
         m_onAdd.Emit(component);
 
@@ -245,8 +324,8 @@ template<PooledComponent T>
 auto ComponentPool<T>::Insert(Entity entity, T obj) -> T&
 {
     NC_ASSERT(entity.Index() < m_storage.MaxSize() && !Contains(entity), "Bad entity");
-    auto& [_, component] = m_staging.emplace_back(entity, std::move(obj));
-
+    auto& component = Stage(entity, std::move(obj));
+    MarkSignature(entity);
     if constexpr(StoragePolicy<T>::EnableOnAddCallbacks)
         m_onAdd.Emit(component);
 
@@ -257,9 +336,18 @@ template<PooledComponent T>
 auto ComponentPool<T>::Remove(Entity entity) -> bool
 {
     NC_ASSERT(entity.Valid(), "Bad entity");
-    if (!m_storage.Remove(entity) && !detail::EraseUnstable(m_staging, entity))
+    if (m_storage.Contains(entity))
+    {
+        LeaveGroup(entity);
+        m_storage.Remove(entity);
+        MarkModified();
+    }
+    else if (!RemoveStaged(entity))
+    {
         return false;
+    }
 
+    UnmarkSignature(entity);
     if constexpr(StoragePolicy<T>::EnableOnRemoveCallbacks)
         m_onRemove.Emit(entity);
 
@@ -269,9 +357,7 @@ auto ComponentPool<T>::Remove(Entity entity) -> bool
 template<PooledComponent T>
 bool ComponentPool<T>::Contains(Entity entity) const
 {
-    return m_storage.Contains(entity)
-        ? true
-        : std::cend(m_staging) != std::ranges::find(m_staging, entity, &detail::StagedComponent<T>::entity);
+    return m_storage.Contains(entity) || m_storage.GetStagedIndex(entity) != Entity::NullIndex;
 }
 
 template<PooledComponent T>
@@ -281,9 +367,9 @@ auto ComponentPool<T>::Get(Entity entity) -> T&
     if (m_storage.Contains(entity))
         return m_storage.Get(entity);
 
-    auto pos = std::ranges::find(m_staging, entity, &detail::StagedComponent<T>::entity);
-    NC_ASSERT(pos != std::cend(m_staging), "Component does not exist");
-    return pos->component;
+    const auto stagedIndex = m_storage.GetStagedIndex(entity);
+    NC_ASSERT(stagedIndex != Entity::NullIndex, "Component does not exist");
+    return m_staged[stagedIndex];
 }
 
 template<PooledComponent T>
@@ -293,9 +379,9 @@ auto ComponentPool<T>::Get(Entity entity) const -> const T&
     if (m_storage.Contains(entity))
         return m_storage.Get(entity);
 
-    auto pos = std::ranges::find(m_staging, entity);
-    NC_ASSERT(pos != std::cend(m_staging), "Component does not exist");
-    return pos->component;
+    const auto stagedIndex = m_storage.GetStagedIndex(entity);
+    NC_ASSERT(stagedIndex != Entity::NullIndex, "Component does not exist");
+    return m_staged[stagedIndex];
 }
 
 template<PooledComponent T>
@@ -310,27 +396,33 @@ auto ComponentPool<T>::GetParent(const T* component) const -> Entity
     if (auto parent = m_storage.GetParent(component); parent.Valid())
         return parent;
 
-    const auto pos = std::ranges::find(m_staging, component, [](auto&& staged) { return &staged.component; });
-    return pos != std::cend(m_staging) ? pos->entity : Entity::Null();
+    const auto beg = m_staged.data();
+    const auto end = beg + m_staged.size();
+    return component >= beg && component < end ? m_stagedEntities[static_cast<size_t>(component - beg)]
+                                               : Entity::Null();
 }
 
 template<PooledComponent T>
 template<std::predicate<const T&, const T&> Pred>
 void ComponentPool<T>::Sort(Pred&& compare)
 {
+    NC_ASSERT(!GetOwningGroup(), "Cannot sort a pool owned by a group.");
     m_storage.Sort(std::forward<Pred>(compare));
+    MarkModified();
 }
 
 template<PooledComponent T>
 void ComponentPool<T>::Reserve(size_t capacity)
 {
     m_storage.Reserve(capacity);
+    MarkModified();
     const auto existing = TotalSize();
     if (capacity > existing)
     {
         // We don't need to reserve the whole capacity for staging - we just
         // want to guarantee ptrs remain valid until we exceed capacity.
-        m_staging.reserve(capacity - existing);
+        m_staged.reserve(capacity - existing);
+        m_stagedEntities.reserve(capacity - existing);
     }
 }
 
@@ -361,35 +453,111 @@ void ComponentPool<T>::Deserialize(std::istream& stream, Entity entity, const De
 }
 
 template<PooledComponent T>
-void ComponentPool<T>::CommitStagedComponents(const std::vector<Entity>& deleted)
+void ComponentPool<T>::CommitStagedComponents(std::span<const Entity> deleted)
 {
-    for(auto entity : deleted)
-        Remove(entity);
+    // Committed components are compacted out in one pass. Anything else is either staged or not held at all.
+    for (auto entity : deleted)
+    {
+        if (m_storage.Contains(entity))
+            m_removeBatch.push_back(entity);
+        else
+            Remove(entity);
+    }
+
+    if (!m_removeBatch.empty())
+    {
+        std::ranges::for_each(m_removeBatch, [this](auto entity) { LeaveGroup(entity); });
+        m_storage.RemoveBatch(m_removeBatch);
+        for (auto entity : m_removeBatch)
+        {
+            UnmarkSignature(entity);
+            if constexpr(StoragePolicy<T>::EnableOnRemoveCallbacks)
+                m_onRemove.Emit(entity);
+        }
+
+        m_removeBatch.clear();
+        MarkModified();
+    }
 
-    for(auto& [entity, component] : m_staging)
+    if (!m_staged.empty())
+        MarkModified();
+
+    for (auto [entity, component] : std::views::zip(m_stagedEntities, m_staged))
     {
         [[maybe_unused]] auto& committed = m_storage.Insert(entity, std::move(component));
         if constexpr (StoragePolicy<T>::EnableOnCommitCallbacks)
             m_onCommit(committed);
+
+        EnterGroup(entity);
     }
 
-    m_staging.clear();
+    m_staged.clear();
+    m_stagedEntities.clear();
 }
 
 template<PooledComponent T>
 void ComponentPool<T>::ClearNonPersistent()
 {
-    assert(m_staging.empty());
-    m_staging.shrink_to_fit();
+    assert(m_staged.empty());
+    m_staged.shrink_to_fit();
+    m_stagedEntities.shrink_to_fit();
     m_storage.ClearNonPersistent();
+    MarkModified();
 }
 
 template<PooledComponent T>
 void ComponentPool<T>::Clear()
 {
-    m_staging.clear();
-    m_staging.shrink_to_fit();
+    m_staged.clear();
+    m_staged.shrink_to_fit();
+    m_stagedEntities.clear();
+    m_stagedEntities.shrink_to_fit();
     m_storage.Clear();
+    MarkModified();
+}
+
+template<PooledComponent T>
+auto ComponentPool<T>::Stage(Entity entity, T&& component) -> T&
+{
+    m_storage.Stage(entity, static_cast<Entity::index_type>(m_staged.size()));
+    m_stagedEntities.push_back(entity);
+    return m_staged.emplace_back(std::move(component));
+}
+
+template<PooledComponent T>
+auto ComponentPool<T>::GetDenseIndex(Entity entity) const noexcept -> Entity::index_type
+{
+    return m_storage.Contains(entity) ? m_storage.GetIndex(entity) : Entity::NullIndex;
+}
+
+template<PooledComponent T>
+void ComponentPool<T>::SwapDense(size_t lhs, size_t rhs)
+{
+    const auto entities = m_storage.GetEntities();
+    m_storage.Swap(entities[lhs], entities[rhs]);
+    MarkModified();
+}
+
+template<PooledComponent T>
+auto ComponentPool<T>::RemoveStaged(Entity entity) -> bool
+{
+    const auto stagedIndex = m_storage.GetStagedIndex(entity);
+    if (stagedIndex == Entity::NullIndex)
+        return false;
+
+    // Swap the last staged component into the hole and retarget its index
+    if (const auto last = m_stagedEntities.back(); last != entity)
+    {
+        m_staged[stagedIndex] = std::move(m_staged.back());
+        m_stagedEntities[stagedIndex] = last;
+        m_storage.Unstage(last);
+        m_storage.Stage(last, stagedIndex);
+    }
+
+    m_staged.pop_back();
+    m_stagedEntities.pop_back();
+    m_storage.Unstage(entity);
+    return true;
 }
 /** @endcond */
 } // namespace nc::ecs
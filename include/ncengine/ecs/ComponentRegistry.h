@@ -6,6 +6,9 @@
 
 #include "ncengine/ecs/ComponentPool.h"
 #include "ncengine/ecs/EntityPool.h"
+#include "ncengine/ecs/detail/EntitySignatures.h"
+
+#include <ranges>
 
 namespace nc::ecs
 {
@@ -32,6 +35,7 @@ class ComponentRegistry : public StableAddress
          */
         explicit ComponentRegistry(size_t entityCapacity)
             : m_entities{entityCapacity},
+              m_signatures{entityCapacity},
               m_maxEntities{entityCapacity}
         {
             NC_ASSERT(!s_init, "There may only be one ComponentRegistry instance.");
@@ -58,6 +62,25 @@ class ComponentRegistry : public StableAddress
             SetupStorage<T>(std::make_unique<ComponentPool<T>>(capacity, std::move(handler)));
         }
 
+        /**
+         * @brief Register an owning group over a set of component types.
+         *
+         * Entities with every type in the group are kept at the front of each owned pool in the same order, so
+         * they can be iterated as parallel contiguous ranges with EcsInterface::GetGroup() or MultiView. A type may
+         * be owned by at most one group, and owned pools cannot be sorted. Any existing data is grouped immediately.
+         */
+        template<PooledComponent... Ts>
+            requires (sizeof...(Ts) > 1)
+        void RegisterGroup()
+        {
+            NC_ASSERT((IsTypeRegistered<Ts>() && ...), "Attempt to group an unregistered type.");
+            NC_ASSERT((!GetPool<Ts>().GetOwningGroup() && ...), "A type may only be owned by one group.");
+            auto& group = *m_groups.emplace_back(std::make_unique<detail::OwningGroupState>());
+            group.pools = {static_cast<ComponentPoolBase*>(s_typedPool<Ts>)...};
+            std::ranges::for_each(group.pools, [&group](auto pool) { pool->m_group = &group; });
+            RebuildGroup(group);
+        }
+
         /** @brief Check if a type is registered. */
         template<PooledComponent T>
         auto IsTypeRegistered() const noexcept -> bool
@@ -120,11 +143,26 @@ class ComponentRegistry : public StableAddress
         /** @brief Get the maximum number of concurrent entities supported. */
         auto GetMaxEntities() const noexcept { return m_maxEntities; }
 
-        /** @brief Merge staged components into their pools and finalize any entity removals. */
+        /**
+         * @brief Merge staged components into their pools and finalize any entity removals.
+         *
+         * Removed entities are routed to only the pools holding data for them, so the cost scales with the
+         * number of components removed rather than with removed entities times registered pools.
+         */
         void CommitPendingChanges()
         {
             const auto removed = m_entities.RecycleDeadEntities();
-            std::ranges::for_each(m_pools, [&removed](auto&& p) { p->CommitStagedComponents(removed); });
+            for (auto entity : removed)
+            {
+                m_signatures.ForEachPool(entity.Index(), [&](uint32_t pool) { m_pendingRemovals[pool].push_back(entity); });
+                m_signatures.Reset(entity.Index());
+            }
+
+            for (auto [pool, removals] : std::views::zip(m_pools, m_pendingRemovals))
+            {
+                pool->CommitStagedComponents(removals);
+                removals.clear();
+            }
         }
 
         /** @brief Destroy all non-persistent entities and components. */
@@ -132,6 +170,17 @@ class ComponentRegistry : public StableAddress
         {
             std::ranges::for_each(m_pools, [](auto&& p) { p->ClearNonPersistent(); });
             m_entities.ClearNonPersistent();
+
+            // Only persistent data remains, so rebuild signatures from what the pools still hold.
+            m_signatures.Clear();
+            for (auto [bit, pool] : std::views::enumerate(m_pools))
+            {
+                for (auto entity : pool->GetEntityPool())
+                    m_signatures.Set(entity.Index(), static_cast<uint32_t>(bit));
+            }
+
+            // Compaction doesn't preserve group prefixes
+            std::ranges::for_each(m_groups, [this](auto&& group) { RebuildGroup(*group); });
         }
 
         /** @brief Destroy all entities and components. */
@@ -139,11 +188,16 @@ class ComponentRegistry : public StableAddress
         {
             std::ranges::for_each(m_pools, [](auto&& p) { p->Clear(); });
             m_entities.Clear();
+            m_signatures.Clear();
+            std::ranges::for_each(m_groups, [](auto&& group) { group->size = 0ull; });
         }
 
     private:
         std::vector<std::unique_ptr<ComponentPoolBase>> m_pools;
+        std::vector<std::vector<Entity>> m_pendingRemovals;
+        std::vector<std::unique_ptr<detail::OwningGroupState>> m_groups;
         EntityPool m_entities;
+        detail::EntitySignatures m_signatures;
         std::vector<void**> m_refs;
         size_t m_maxEntities;
         size_t m_nextComponentId = std::numeric_limits<size_t>::max();
@@ -162,12 +216,24 @@ class ComponentRegistry : public StableAddress
                 throw NcError(fmt::format("ComponentId '{}' is already in use.", id));
         }
 
+        static void RebuildGroup(detail::OwningGroupState& group)
+        {
+            group.size = 0ull;
+            auto* basis = group.pools.front();
+            for (auto i = 0ull; i < basis->Size(); ++i)
+                basis->EnterGroup(basis->GetEntityPool()[i]);
+        }
+
         template<PooledComponent T>
-        void SetupStorage(std::unique_ptr<ComponentPool<T>> pool) noexcept
+        void SetupStorage(std::unique_ptr<ComponentPool<T>> pool)
         {
+            auto& base = static_cast<ComponentPoolBase&>(*pool);
+            base.m_signatures = &m_signatures;
+            base.m_signatureBit = m_signatures.AddPool();
             s_typedPool<T> = pool.get();
             m_refs.emplace_back(reinterpret_cast<void**>(&s_typedPool<T>));
             m_pools.push_back(std::move(pool));
+            m_pendingRemovals.emplace_back();
         }
 };
 } // namespace nc::ecs
@@ -5,13 +5,19 @@
 #pragma once
 
 #include "ncengine/ecs/AccessPolicy.h"
+#include "ncengine/ecs/Group.h"
 
 namespace nc::ecs
 {
 /**
  * @brief Interface for higher-level entity and component operations with optional type access restriction.
+ *
+ * Types listed as const-qualified are read-only: they may be retrieved as const references (including through
+ * non-const interfaces), but not emplaced, removed, or modified.
+ *
  * @tparam Base A FilterBase describing the baseline set of types accessible through the interface.
- * @tparam Includes A list of types accessible through the interface in addition to the Base.
+ * @tparam Includes A list of types accessible through the interface in addition to the Base, which may be
+ *                  const-qualified.
  */
 template<FilterBase Base, class... Includes>
 class EcsInterface
@@ -29,7 +35,25 @@ class EcsInterface
             requires PolicyType::template ConvertibleTo<TargetBase, TargetIncludes...>
         operator EcsInterface<TargetBase, TargetIncludes...>() const noexcept
         {
-            return EcsInterface<TargetBase, TargetIncludes...>(m_policy);
+            return EcsInterface<TargetBase, TargetIncludes...>(m_policy).WithWriteOwner(m_writeOwner);
+        }
+
+        /**
+         * @brief Get a copy of the interface that only permits access to writable types on a single entity.
+         *
+         * Writable components may only be retrieved with Get() on the owner, and anything else that could modify
+         * other entities (mutable pools, spans, and groups, emplacing, removing, and reparenting) is rejected. Read-only
+         * access is unaffected. This is applied to logic running concurrently on other entities, which must record
+         * structural changes in a CommandBuffer instead.
+         *
+         * @note The restriction is checked with NC_ASSERT and can't be lifted or moved to another entity once set.
+         */
+        auto WithWriteOwner(Entity owner) const -> EcsInterface
+        {
+            NC_ASSERT(!m_writeOwner.Valid() || owner == m_writeOwner, "The write owner of an interface can't be changed.");
+            auto out = *this;
+            out.m_writeOwner = owner;
+            return out;
         }
 
         /** @brief Emplace an entity. */
@@ -37,6 +61,7 @@ class EcsInterface
             requires PolicyType::template HasAccess<Entity, Transform, Tag, Hierarchy>
         auto Emplace(EntityInfo info = {}) -> Entity
         {
+            ValidateUnrestricted();
             const auto handle = m_policy.template GetPool<Entity>().Add(info.layer, info.flags);
             if (info.parent.Valid())
             {
@@ -60,6 +85,7 @@ class EcsInterface
             requires PolicyType::template HasAccess<T>
         auto Emplace(Entity entity, Args&&... args) -> T&
         {
+            ValidateUnrestricted();
             NC_ASSERT(Contains<Entity>(entity), "Bad entity");
             if constexpr (std::derived_from<T, FreeComponent>)
             {
@@ -76,6 +102,7 @@ class EcsInterface
             requires PolicyType::template HasAccess<Entity, Transform>
         auto Remove(Entity entity) -> bool
         {
+            ValidateUnrestricted();
             return Contains<Entity>(entity) ? RemoveNode<true>(entity) : false;
         }
 
@@ -84,6 +111,7 @@ class EcsInterface
             requires PolicyType::template HasAccess<T>
         auto Remove(Entity entity) -> bool
         {
+            ValidateUnrestricted();
             if (!Contains<Entity>(entity))
                 return false;
 
@@ -97,11 +125,12 @@ class EcsInterface
             }
         }
 
-        /** @brief Get a component. */
+        /** @brief Get a component. Requires write access to T. */
         template<Component T>
             requires PolicyType::template HasAccess<T>
         auto Get(Entity entity) -> T&
         {
+            ValidateWriteTarget(entity);
             if constexpr (std::derived_from<T, FreeComponent>)
             {
                 auto& bag = Get<detail::FreeComponentGroup>(entity);
@@ -113,19 +142,25 @@ class EcsInterface
             }
         }
 
-        /** @brief Get a component. */
+        /** @brief Get a component. Only requires read access to T. */
         template<Component T>
-            requires PolicyType::template HasAccess<T>
+            requires PolicyType::template HasAccess<const T>
         auto Get(Entity entity) const -> const T&
         {
+            // Writable types may be modified concurrently on other entities, so reads are restricted as well unless
+            // the type was also declared const (in which case logic touching it is never run concurrently)
+            if constexpr (PolicyType::template HasAccess<std::remove_const_t<T>>
+                       && !(std::same_as<const T, Includes> || ...))
+                ValidateWriteTarget(entity);
+
             if constexpr (std::derived_from<T, FreeComponent>)
             {
                 auto& bag = Get<detail::FreeComponentGroup>(entity);
-                return bag.template Get<T>();
+                return bag.template Get<std::remove_const_t<T>>();
             }
             else
             {
-                return m_policy.template GetPool<T>().Get(entity);
+                return m_policy.template GetPool<const T>().Get(entity);
             }
         }
 
@@ -139,7 +174,7 @@ class EcsInterface
             requires PolicyType::template HasAccess<Entity>
                   && PolicyType::template HasAccess<Tag>
         {
-            const auto tags = GetAll<Tag>();
+            const auto tags = std::as_const(*this).template GetAll<Tag>();
             const auto pos = std::ranges::find(tags, tagValue, [](const auto& tag) { return tag.value; });
             NC_ASSERT(pos != std::ranges::end(tags), fmt::format("No Entity found with Tag '{}'", tagValue));
             return m_policy.template GetPool<Tag>().GetParent(&(*pos));
@@ -151,40 +186,65 @@ class EcsInterface
                  && (PooledComponent<T> || std::same_as<Entity, T>)
         auto GetAll() -> std::span<T>
         {
+            ValidateUnrestricted();
             return std::span<T>{GetPool<T>()};
         }
 
-        /** @brief Get a contiguous view of all instances of a type. */
+        /** @brief Get a read-only contiguous view of all instances of a type. */
         template<class T>
-            requires PolicyType::template HasAccess<T>
-                 && (PooledComponent<T> || std::same_as<Entity, T>)
+            requires PolicyType::template HasAccess<const T>
+                 && (PooledComponent<std::remove_const_t<T>> || std::same_as<Entity, std::remove_const_t<T>>)
         auto GetAll() const -> std::span<const T>
         {
-            return std::span<const T>{GetPool<T>()};
+            return std::span<const T>{GetPool<const T>()};
         }
 
-        /** @brief Get the pool for a given type. */
+        /**
+         * @brief Get a view over the owning group registered for exactly the given types.
+         * @note The group must have been created with ComponentRegistry::RegisterGroup().
+         */
+        template<PooledComponent... Ts>
+            requires PolicyType::template HasAccess<Ts...>
+                  && (sizeof...(Ts) > 1)
+        auto GetGroup() -> Group<Ts...>
+        {
+            if constexpr (!(std::is_const_v<Ts> && ...))
+                ValidateUnrestricted();
+
+            const auto* group = detail::FindOwningGroup(m_policy.template GetPool<Ts>()...);
+            NC_ASSERT(group, "No group is registered for these types.");
+            return Group<Ts...>{
+                group->pools.front()->GetEntityPool().first(group->size),
+                m_policy.template GetPool<Ts>().GetComponents().first(group->size)...
+            };
+        }
+
+        /** @brief Get the pool for a given type. The pool is const if T is const-qualified. */
         template<class T>
             requires PolicyType::template HasAccess<T>
-                && (PooledComponent<T> || std::same_as<Entity, T>)
+                && (PooledComponent<std::remove_const_t<T>> || std::same_as<Entity, std::remove_const_t<T>>)
         auto GetPool() -> decltype(auto)
         {
+            if constexpr (!std::is_const_v<T>)
+                ValidateUnrestricted();
+
             return m_policy.template GetPool<T>();
         }
 
-        /** @brief Get the pool for a given type. */
+        /** @brief Get the read-only pool for a given type. */
         template<class T>
-            requires PolicyType::template HasAccess<T>
-                && (PooledComponent<T> || std::same_as<Entity, T>)
+            requires PolicyType::template HasAccess<const T>
+                && (PooledComponent<std::remove_const_t<T>> || std::same_as<Entity, std::remove_const_t<T>>)
         auto GetPool() const -> decltype(auto)
         {
-            return m_policy.template GetPool<T>();
+            return m_policy.template GetPool<const T>();
         }
 
         /** @brief Get a range of pointers to all ComponentPoolBase instances. */
         auto GetComponentPools()
             requires PolicyType::template BaseContains<FilterBase::All>
         {
+            ValidateUnrestricted();
             return m_policy.GetComponentPools();
         }
 
@@ -192,6 +252,7 @@ class EcsInterface
         void SetParent(Entity entity, Entity parent)
             requires PolicyType::template HasAccess<Hierarchy>
         {
+            ValidateUnrestricted();
             auto& hierarchy = Get<Hierarchy>(entity);
             const auto oldParent = std::exchange(hierarchy.parent, parent);
             if (oldParent.Valid())
@@ -203,11 +264,13 @@ class EcsInterface
             {
                 Get<Hierarchy>(parent).children.push_back(entity);
             }
+
+            m_policy.template GetPool<Hierarchy>().MarkModified();
         }
 
         /** @brief Get the root Entity in a hierarchy. */
-        auto GetRoot(Entity entity) -> Entity
-            requires PolicyType::template HasAccess<Hierarchy>
+        auto GetRoot(Entity entity) const -> Entity
+            requires PolicyType::template HasAccess<const Hierarchy>
         {
             const auto& hierarchy = Get<Hierarchy>(entity);
             return !hierarchy.parent.Valid() ? entity : GetRoot(hierarchy.parent);
@@ -215,15 +278,15 @@ class EcsInterface
 
         /** @brief Get the parent entity a component is attached to or Entity::Null(). */
         template<PooledComponent T>
-            requires PolicyType::template HasAccess<T>
+            requires PolicyType::template HasAccess<const T>
         auto GetParent(const T* component) const -> Entity
         {
-            return m_policy.template GetPool<T>().GetParent(component);
+            return m_policy.template GetPool<const T>().GetParent(component);
         }
 
         /** @brief Check if an entity or component exists. */
         template<RegistryType T>
-            requires PolicyType::template HasAccess<T>
+            requires PolicyType::template HasAccess<const T>
         auto Contains(Entity entity) const -> bool
         {
             if constexpr (std::derived_from<T, FreeComponent>)
@@ -236,12 +299,26 @@ class EcsInterface
             }
             else
             {
-                return m_policy.template GetPool<T>().Contains(entity);
+                return m_policy.template GetPool<const T>().Contains(entity);
             }
         }
 
     private:
         PolicyType m_policy;
+        Entity m_writeOwner = Entity::Null();
+
+        void ValidateWriteTarget([[maybe_unused]] Entity entity) const
+        {
+            NC_ASSERT(!m_writeOwner.Valid() || entity == m_writeOwner,
+                      "Writable types may only be accessed on the entity the interface is restricted to.");
+        }
+
+        void ValidateUnrestricted() const
+        {
+            NC_ASSERT(!m_writeOwner.Valid(),
+                      "Mutable pools and structural changes are unavailable while the interface is restricted to a "
+                      "single entity. Record changes in a CommandBuffer instead.");
+        }
 
         template<bool IsRoot>
         auto RemoveNode(Entity entity) -> bool
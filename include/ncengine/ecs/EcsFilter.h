@@ -25,8 +25,10 @@ namespace detail
 template<class... Ts>
 struct MatchFilter
 {
+    // A non-const type must be listed as is, while a const type is also covered by its non-const listing.
     template<class T>
-    static constexpr auto included = (std::is_same_v<T, Ts> || ...);
+    static constexpr auto included = (std::is_same_v<T, Ts> || ...) ||
+                                     (std::is_const_v<T> && (std::is_same_v<T, const Ts> || ...));
 };
 
 struct AllFilter
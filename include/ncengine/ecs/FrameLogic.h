@@ -4,8 +4,10 @@
  */
 #pragma once
 
+#include "ncengine/ecs/CommandBuffer.h"
 #include "ncengine/ecs/Component.h"
 #include "ncengine/ecs/Ecs.h"
+#include "ncengine/ecs/detail/AccessSet.h"
 
 #include <functional>
 
@@ -18,7 +20,30 @@ using FrameLogicCallable_t = std::move_only_function<void(Entity self, ecs::Ecs
 template<class Func>
 concept FrameLogicCallable = std::convertible_to<Func, FrameLogicCallable_t>;
 
-/** @brief Component that runs a custom callable during each logic phase. */
+/**
+ * @brief Declares the component types touched by a parallel FrameLogic.
+ *
+ * Non-const types may be read and written on the logic's own entity only. Const-qualified types may be read on any
+ * entity. The declaration is passed through to the logic's ExplicitEcs, so const types are only accessible as const
+ * references, and accessing non-const types on other entities fails an NC_ASSERT. Mutable pools and groups, which can
+ * reach any entity, fail the same assertion. Logic whose declarations don't conflict may be run concurrently.
+ */
+template<class... Ts>
+struct LogicAccess {};
+
+/** @brief Parallel FrameLogic callable type requirements */
+template<class Func, class... Ts>
+concept ParallelFrameLogicCallable =
+    std::invocable<Func&, Entity, ecs::ExplicitEcs<Ts...>, ecs::CommandBuffer&, float>;
+
+/**
+ * @brief Component that runs a custom callable during each logic phase.
+ *
+ * By default, logic receives unrestricted registry access and runs serially. Logic constructed with a LogicAccess
+ * declaration instead receives an ExplicitEcs limited to the declared types and may be run on worker threads
+ * alongside other non-conflicting logic. Parallel logic must not add or remove entities or components directly;
+ * structural changes are recorded in the provided CommandBuffer and applied after all logic has finished.
+ */
 class FrameLogic final : public ComponentBase
 {
     public:
@@ -29,19 +54,68 @@ class FrameLogic final : public ComponentBase
         {
         }
 
+        template<class... Ts, ParallelFrameLogicCallable<Ts...> Func>
+        FrameLogic(Entity entity, LogicAccess<Ts...> access, Func&& func)
+            : ComponentBase{entity}
+        {
+            SetFunction(access, std::forward<Func>(func));
+        }
+
         /** @brief Set a new callable. */
         template<FrameLogicCallable Func>
         void SetFunction(Func&& func)
         {
             m_func = std::forward<Func>(func);
+            m_parallelFunc = nullptr;
+            m_access = nullptr;
         }
 
+        /** @brief Set a new parallel callable. */
+        template<class... Ts, ParallelFrameLogicCallable<Ts...> Func>
+        void SetFunction(LogicAccess<Ts...>, Func&& func)
+        {
+            m_parallelFunc = [func = std::forward<Func>(func)](Entity self, ecs::Ecs world, ecs::CommandBuffer& commands, float dt) mutable
+            {
+                func(self, ecs::ExplicitEcs<Ts...>{world}.WithWriteOwner(self), commands, dt);
+            };
+
+            m_func = nullptr;
+            m_access = &ecs::detail::g_accessSet<Ts...>;
+        }
+
+        /** @brief Check if the logic was declared with a LogicAccess and may be run concurrently. */
+        auto IsParallel() const noexcept -> bool { return m_access != nullptr; }
+
+        /** @brief Run the logic, immediately applying any structural changes made by parallel logic. */
         void Run(ecs::Ecs world, float dt)
         {
-            if(m_func) m_func(ParentEntity(), world, dt);
+            if (m_parallelFunc)
+            {
+                auto commands = ecs::CommandBuffer{};
+                m_parallelFunc(ParentEntity(), world, commands, dt);
+                commands.Playback(world);
+            }
+            else if(m_func)
+            {
+                m_func(ParentEntity(), world, dt);
+            }
         }
 
+        /** @brief Run parallel logic, recording structural changes into a CommandBuffer. */
+        void Run(ecs::Ecs world, ecs::CommandBuffer& commands, float dt)
+        {
+            NC_ASSERT(m_parallelFunc, "FrameLogic was not declared with a LogicAccess.");
+            m_parallelFunc(ParentEntity(), world, commands, dt);
+        }
+
+        /** @internal Get the declared access of parallel logic, shared by all logic with the same declaration. */
+        auto GetAccess() const noexcept -> const ecs::detail::AccessSet* { return m_access; }
+
     private:
+        using ParallelCallable_t = std::move_only_function<void(Entity, ecs::Ecs, ecs::CommandBuffer&, float)>;
+
         FrameLogicCallable_t m_func;
+        ParallelCallable_t m_parallelFunc;
+        const ecs::detail::AccessSet* m_access = nullptr;
 };
 } // namespace nc
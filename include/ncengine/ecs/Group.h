@@ -0,0 +1,61 @@
+/**
+ * @file Group.h
+ * @copyright Jaremie Romer and McCallister Romer 2024
+ */
+#pragma once
+
+#include "ncengine/ecs/ComponentPool.h"
+
+#include <ranges>
+#include <span>
+#include <tuple>
+
+namespace nc::ecs
+{
+/**
+ * @brief A view over the entities and components of an owning group.
+ *
+ * Grouped components are stored at the front of each owned pool in matching order, so the i-th element of every
+ * range belongs to the same entity. Ranges may be processed independently (e.g. for SIMD) or iterated together as
+ * tuples of references. Invalidation rules are the same as for component pools.
+ *
+ * @tparam Ts The component types owned by the group, optionally const-qualified.
+ */
+template<PooledComponent... Ts>
+class Group
+{
+    public:
+        /** @brief Construct a group view from the grouped prefixes of each pool. */
+        explicit Group(std::span<const Entity> entities, std::span<Ts>... components) noexcept
+            : m_entities{entities}, m_components{components...} {}
+
+        /** @brief Get the entities in the group. */
+        auto Entities() const noexcept -> std::span<const Entity> { return m_entities; }
+
+        /** @brief Get the grouped components of one type. */
+        template<class T>
+        auto Get() const noexcept -> std::span<T> { return std::get<std::span<T>>(m_components); }
+
+        /** @brief Get a range of tuples of component references. */
+        auto Each() const noexcept
+        {
+            return std::apply([](auto... components) { return std::views::zip(components...); }, m_components);
+        }
+
+        /** @brief Get an iterator to the first tuple of component references. */
+        auto begin() const noexcept { return Each().begin(); }
+
+        /** @brief Get an iterator one past the last tuple of component references. */
+        auto end() const noexcept { return Each().end(); }
+
+        /** @brief Get the number of entities in the group. */
+        auto size() const noexcept { return m_entities.size(); }
+
+        /** @brief Check if the group is empty. */
+        [[nodiscard]] auto empty() const noexcept { return m_entities.empty(); }
+
+    private:
+        std::span<const Entity> m_entities;
+        std::tuple<std::span<Ts>...> m_components;
+};
+} // namespace nc::ecs
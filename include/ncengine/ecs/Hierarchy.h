@@ -17,7 +17,8 @@ namespace nc
  * 
  * A Hierarchy component is automatically attached to an Entity on creation, with its initial parent value taken from
  * the EntityInfo struct. Root Entities have their parent set to Entity::Null(). A Hierarchy may be directly modified,
- * but care must be taken to ensure related Hierarchy objects are updated accordingly. Ecs::SetParent() automatically
+ * but care must be taken to ensure related Hierarchy objects are updated accordingly, and the Hierarchy pool must be
+ * notified with ComponentPool::MarkModified() so cached scene graph data is rebuilt. Ecs::SetParent() automatically
  * handles this and should be preferred over direct modifications.
 */
 struct Hierarchy
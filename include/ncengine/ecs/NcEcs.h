@@ -5,8 +5,10 @@
 #pragma once
 
 #include "ncengine/module/Module.h"
+#include "ncengine/task/TaskFwd.h"
 #include "ncengine/type/EngineId.h"
 
+#include <cstdint>
 #include <memory>
 
 namespace nc
@@ -17,13 +19,20 @@ namespace ecs
 {
 class ComponentRegistry;
 
+/** @brief Strategies for propagating world space matrices through the scene graph. */
+enum class TransformUpdateMode : uint8_t
+{
+    GraphWalk,   ///< serial depth-first traversal from each root entity
+    DepthOrdered ///< cached breadth-first ordering with one parallel sweep per hierarchy depth level
+};
+
 /**
  * @brief Module managing ComponentRegistry operations.
  * 
  * Tasks
  *   FrameLogicUpdate
  *     Depends On: DebugRendererNewFrame (only in dev builds)
- *     Component Access: All
+ *     Component Access: All (FrameLogic declared with a LogicAccess runs on worker threads)
  *   CommitPendingChanges
  *     Depends On: ParticleEmitterUpdate, AudioSourceUpdate, FrameLogicUpdate
  *     Component Access: All
@@ -33,9 +42,24 @@ class NcEcs : public Module
     public:
         explicit NcEcs() noexcept
             : Module{NcEcsId} {}
+
+        /** @brief Get the strategy used for updating Transform world space matrices. */
+        virtual auto GetTransformUpdateMode() const noexcept -> TransformUpdateMode = 0;
+
+        /**
+         * @brief Set the strategy used for updating Transform world space matrices.
+         * @note DepthOrdered splits work across the task executor and is preferable for scenes with many Transforms
+         *       or wide hierarchies. The change takes effect on the next CommitStagedChanges task.
+         */
+        virtual void SetTransformUpdateMode(TransformUpdateMode mode) noexcept = 0;
+
+        /** @brief Get the time in milliseconds taken by the most recent Transform update run with a given strategy. */
+        virtual auto GetTransformUpdateTime(TransformUpdateMode mode) const noexcept -> float = 0;
 };
 
 /** @brief Build an NcEcs module instance. */
-auto BuildEcsModule(ComponentRegistry& registry, SystemEvents& events) -> std::unique_ptr<NcEcs>;
+auto BuildEcsModule(ComponentRegistry& registry,
+                    const task::AsyncDispatcher& dispatcher,
+                    SystemEvents& events) -> std::unique_ptr<NcEcs>;
 } // namespace ecs
 } // namespace nc
@@ -0,0 +1,110 @@
+/**
+ * @file ParallelForEach.h
+ * @copyright Jaremie Romer and McCallister Romer 2024
+ */
+#pragma once
+
+#include "ncengine/ecs/Ecs.h"
+#include "ncengine/task/AsyncDispatcher.h"
+
+#include <algorithm>
+
+namespace nc::ecs
+{
+/** @brief Default minimum number of elements processed by a single ParallelForEach() task. */
+inline constexpr size_t DefaultGrainSize = 256ull;
+
+/** @cond internal */
+namespace detail
+{
+template<class F, class... Ts>
+concept ForEachEntityCallable = std::invocable<F&, Entity, Ts&...>;
+
+template<class F, class... Ts>
+concept ForEachCallable = ForEachEntityCallable<F, Ts...> || std::invocable<F&, Ts&...>;
+
+template<class... Ts, class F>
+void InvokeForEach(F& func, Entity entity, Ts&... components)
+{
+    if constexpr (ForEachEntityCallable<F, Ts...>)
+        func(entity, components...);
+    else
+        func(components...);
+}
+} // namespace detail
+/** @endcond */
+
+/**
+ * @brief Invoke a function on every entity having all of the specified components, splitting the work across the
+ *        task thread pool.
+ *
+ * The function is called as func(Ts&...) or func(Entity, Ts&...) for each matching entity. Iteration runs over
+ * the committed range of the smallest pool in chunks of at least grainSize entities, so components added since the
+ * last commit may be skipped. When the types form an owning group, every pool is scanned linearly instead. The call
+ * returns once every entity has been visited.
+ *
+ * Access is checked against the EcsInterface passed in. Const-qualified Ts only require read access and are passed to
+ * the function as const references, while other Ts require write access, so an ExplicitEcs declaring a type as const
+ * can't be used to modify it. Chunks run concurrently, so the function must not add or remove entities or
+ * components, and may only write to data owned by the entity it was called for.
+ *
+ * @tparam Ts The components to visit, which may be const-qualified.
+ * @param world The interface granting access to Ts.
+ * @param dispatcher The dispatcher for the task thread pool.
+ * @param func The function to invoke for each entity.
+ * @param grainSize The minimum number of entities processed by one task.
+ */
+template<PooledComponent... Ts, FilterBase Base, class... Includes, detail::ForEachCallable<Ts...> F>
+    requires (sizeof...(Ts) > 0)
+          && EcsInterface<Base, Includes...>::PolicyType::template HasAccess<Ts...>
+void ParallelForEach(EcsInterface<Base, Includes...> world,
+                     const task::AsyncDispatcher& dispatcher,
+                     F&& func,
+                     size_t grainSize = DefaultGrainSize)
+{
+    if constexpr (sizeof...(Ts) == 1)
+    {
+        auto& pool = world.template GetPool<Ts...>();
+        const auto entities = pool.GetEntityPool();
+        const auto components = std::span<Ts...>{pool.GetComponents()};
+        dispatcher.ParallelFor(components.size(), grainSize, [&](size_t begin, size_t end)
+        {
+            for (auto i = begin; i < end; ++i)
+                detail::InvokeForEach<Ts...>(func, entities[i], components[i]);
+        });
+    }
+    else if (const auto* group = detail::FindOwningGroup(world.template GetPool<Ts>()...))
+    {
+        const auto entities = group->pools.front()->GetEntityPool().first(group->size);
+        const auto components = std::tuple{
+            std::span<Ts>{world.template GetPool<Ts>().GetComponents()}.first(group->size)...
+        };
+
+        dispatcher.ParallelFor(entities.size(), grainSize, [&](size_t begin, size_t end)
+        {
+            for (auto i = begin; i < end; ++i)
+                detail::InvokeForEach<Ts...>(func, entities[i], std::get<std::span<Ts>>(components)[i]...);
+        });
+    }
+    else
+    {
+        // Chunk over the smallest pool and look up the rest. Lookups only read pool state, so they're safe to run
+        // concurrently.
+        const auto* basis = std::min<const ComponentPoolBase*>(
+            {&world.template GetPool<Ts>()...},
+            [](const auto* l, const auto* r) { return l->Size() < r->Size(); }
+        );
+
+        const auto entities = basis->GetEntityPool();
+        dispatcher.ParallelFor(entities.size(), grainSize, [&](size_t begin, size_t end)
+        {
+            for (auto i = begin; i < end; ++i)
+            {
+                const auto entity = entities[i];
+                if ((world.template GetPool<Ts>().Contains(entity) && ...))
+                    detail::InvokeForEach<Ts...>(func, entity, world.template GetPool<Ts>().Get(entity)...);
+            }
+        });
+    }
+}
+} // namespace nc::ecs
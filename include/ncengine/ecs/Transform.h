@@ -5,9 +5,11 @@
 #pragma once
 
 #include "Component.h"
+#include "EcsFwd.h"
 
 #include "ncmath/MatrixUtilities.h"
 
+#include <atomic>
 #include <span>
 #include <vector>
 
@@ -15,7 +17,9 @@ namespace nc
 {
 namespace ecs
 {
+class DepthOrderedTransforms;
 class EcsModule;
+void UpdateWorldMatricesGraphWalk(Ecs world);
 }
 
 /** @brief Component with translation, rotation, and scale properties.
@@ -25,19 +29,29 @@ class EcsModule;
  * 
  *  A Transform's initial values can be set in EntityInfo when adding an Entity.
  * 
- *  Data is stored for local and world space, but only local space values may be
- *  directly modified. World space calculations are done internally based on the
- *  Entity's Hierarchy component.
+ *  Local space is stored as separate position, rotation, and scale values, so local
+ *  getters and setters never decompose or recompose a matrix. The world space matrix
+ *  is cached and rebuilt from local values only when the Transform, or one of its
+ *  ancestors, has changed. Only local space values may be directly modified. World
+ *  space calculations are done internally based on the Entity's Hierarchy component.
+ *
+ *  World rotation and scale are not stored. For root Transforms with positive scale they
+ *  are read directly from local values; otherwise they are decomposed from the world matrix
+ *  on each call, so prefer caching them when they are needed repeatedly.
 */
 class Transform final : public ComponentBase
 {
     public:
         Transform(Entity entity, const Vector3& pos, const Quaternion& rot, const Vector3& scale)
             : ComponentBase(entity),
-              m_localMatrix{ComposeMatrix(scale, rot, pos)},
-              m_worldMatrix{m_localMatrix}
+              m_localPosition{ToXMVectorHomogeneous(pos)},
+              m_localRotation{ToXMVector(rot)},
+              m_localScale{ToXMVector(scale)},
+              m_worldMatrix{ComposeLocalMatrix()},
+              m_revision{NextRevisionBase()}
         {
             NC_ASSERT(!HasAnyZeroElement(scale), "Invalid scale(elements cannot be 0)");
+            m_rootWithPositiveScale = HasPositiveLocalScale();
         }
 
         Transform(Entity entity,
@@ -46,8 +60,11 @@ class Transform final : public ComponentBase
                   const Vector3& scale,
                   DirectX::FXMMATRIX parentTransform)
             : ComponentBase(entity),
-              m_localMatrix{ComposeMatrix(scale, rot, pos)},
-              m_worldMatrix{m_localMatrix * parentTransform}
+              m_localPosition{ToXMVectorHomogeneous(pos)},
+              m_localRotation{ToXMVector(rot)},
+              m_localScale{ToXMVector(scale)},
+              m_worldMatrix{ComposeLocalMatrix() * parentTransform},
+              m_revision{NextRevisionBase()}
         {
             NC_ASSERT(!HasAnyZeroElement(scale), "Invalid scale(elements cannot be 0)");
         }
@@ -68,37 +85,50 @@ class Transform final : public ComponentBase
         auto LocalPosition() const noexcept -> Vector3 { return ToVector3(LocalPositionXM()); }
 
         /** @brief Get local space position as an XMVECTOR */
-        auto LocalPositionXM() const noexcept -> DirectX::FXMVECTOR { return m_localMatrix.r[3]; }
+        auto LocalPositionXM() const noexcept -> DirectX::FXMVECTOR { return m_localPosition; }
 
-        /** @brief Get world space rotation */
+        /** @brief Get world space rotation
+         *  @note Decomposes the world matrix unless the Transform is a root with positive scale. */
         auto Rotation() const noexcept -> Quaternion { return ToQuaternion(RotationXM()); }
 
-        /** @brief Get world space rotation as an XMVECTOR */
-        auto RotationXM() const noexcept -> DirectX::XMVECTOR { return DecomposeRotation(m_worldMatrix); }
+        /** @brief Get world space rotation as an XMVECTOR
+         *  @note Decomposes the world matrix unless the Transform is a root with positive scale. */
+        auto RotationXM() const noexcept -> DirectX::XMVECTOR
+        {
+            return IsWorldSpaceLocal() ? DirectX::XMQuaternionNormalize(m_localRotation) : DecomposeRotation(m_worldMatrix);
+        }
 
         /** @brief Get local space rotation */
         auto LocalRotation() const noexcept -> Quaternion { return ToQuaternion(LocalRotationXM()); }
 
         /** @brief Get local space rotation as an XMVECTOR */
-        auto LocalRotationXM() const noexcept -> DirectX::XMVECTOR { return DecomposeRotation(m_localMatrix); }
+        auto LocalRotationXM() const noexcept -> DirectX::XMVECTOR { return m_localRotation; }
 
         /** @brief Get world space scale */
         auto Scale() const noexcept -> Vector3 { return ToVector3(ScaleXM()); }
 
         /** @brief Get world space scale as an XMVECTOR */
-        auto ScaleXM() const noexcept -> DirectX::XMVECTOR { return DecomposeScale(m_worldMatrix); }
+        auto ScaleXM() const noexcept -> DirectX::XMVECTOR
+        {
+            return IsWorldSpaceLocal() ? m_localScale : DecomposeScale(m_worldMatrix);
+        }
 
         /** @brief Get local space scale */
         auto LocalScale() const noexcept -> Vector3 { return ToVector3(LocalScaleXM()); }
 
         /** @brief Get local space scale as an XMVECTOR */
-        auto LocalScaleXM() const noexcept -> DirectX::XMVECTOR { return DecomposeScale(m_localMatrix); }
+        auto LocalScaleXM() const noexcept -> DirectX::XMVECTOR { return m_localScale; }
 
         /** @brief Get world space matrix */
         auto TransformationMatrix() const noexcept -> DirectX::FXMMATRIX { return m_worldMatrix; }
 
-        /** @brief Get local space matrix */
-        auto LocalTransformationMatrix() const noexcept -> DirectX::FXMMATRIX { return m_localMatrix; }
+        /** @brief Get a value that changes whenever the world space matrix is rebuilt.
+         *  @note Values are never shared between Transforms, so they may be used to key caches of world space data. */
+        auto Revision() const noexcept -> uint64_t { return m_revision; }
+
+        /** @brief Get local space matrix
+         *  @note The local matrix is not stored, so it is composed on each call. */
+        auto LocalTransformationMatrix() const noexcept -> DirectX::XMMATRIX { return ComposeLocalMatrix(); }
 
         /** @brief Get local space matrix */
         auto ToLocalSpace(const Vector3& vec) const -> Vector3;
@@ -142,10 +172,8 @@ class Transform final : public ComponentBase
         /** @brief Set local position and rotation from XMVECTORs */
         void SetPositionAndRotationXM(DirectX::FXMVECTOR position, DirectX::FXMVECTOR orientation)
         {
-            const auto scale = DecomposeScale(m_localMatrix);
-            m_localMatrix = DirectX::XMMatrixScalingFromVector(scale) *
-                            DirectX::XMMatrixRotationQuaternion(orientation);
-            m_localMatrix.r[3] = DirectX::XMVectorSetW(position, 1.0f);
+            m_localPosition = DirectX::XMVectorSetW(position, 1.0f);
+            m_localRotation = orientation;
             m_dirty = true;
         }
 
@@ -174,26 +202,66 @@ class Transform final : public ComponentBase
         void LookAt(const Vector3& target);
 
     private:
+        friend class ecs::DepthOrderedTransforms;
         friend class ecs::EcsModule;
+        friend void ecs::UpdateWorldMatricesGraphWalk(ecs::Ecs world);
         bool m_dirty = false;
-        DirectX::XMMATRIX m_localMatrix;
+        bool m_rootWithPositiveScale = false; // whether the world matrix was composed from local values alone
+        DirectX::XMVECTOR m_localPosition; // w is always 1
+        DirectX::XMVECTOR m_localRotation;
+        DirectX::XMVECTOR m_localScale;
         DirectX::XMMATRIX m_worldMatrix;
+        uint64_t m_revision;
+
+        /** Each Transform counts revisions in the low bits above a unique base. */
+        static auto NextRevisionBase() noexcept -> uint64_t
+        {
+            static auto counter = std::atomic<uint64_t>{0};
+            return counter.fetch_add(1, std::memory_order_relaxed) << 32;
+        }
 
         auto IsDirty() const noexcept
         {
             return m_dirty;
         }
 
+        auto HasPositiveLocalScale() const noexcept -> bool
+        {
+            return DirectX::XMVector3Greater(m_localScale, DirectX::XMVectorZero());
+        }
+
+        /** World values equal local values only while the world matrix is current. */
+        auto IsWorldSpaceLocal() const noexcept -> bool
+        {
+            return m_rootWithPositiveScale && !m_dirty;
+        }
+
+        /** Build scale * rotation * translation by scaling the rotation matrix rows in place. */
+        auto ComposeLocalMatrix() const noexcept -> DirectX::XMMATRIX
+        {
+            using namespace DirectX;
+            auto out = XMMatrixRotationQuaternion(m_localRotation);
+            out.r[0] = XMVectorMultiply(out.r[0], XMVectorSplatX(m_localScale));
+            out.r[1] = XMVectorMultiply(out.r[1], XMVectorSplatY(m_localScale));
+            out.r[2] = XMVectorMultiply(out.r[2], XMVectorSplatZ(m_localScale));
+            out.r[3] = m_localPosition;
+            return out;
+        }
+
         void UpdateWorldMatrix()
         {
             m_dirty = false;
-            m_worldMatrix = m_localMatrix;
+            m_rootWithPositiveScale = HasPositiveLocalScale();
+            m_worldMatrix = ComposeLocalMatrix();
+            ++m_revision;
         }
 
         void UpdateWorldMatrix(DirectX::FXMMATRIX parentMatrix)
         {
             m_dirty = false;
-            m_worldMatrix = m_localMatrix * parentMatrix;
+            m_rootWithPositiveScale = false;
+            m_worldMatrix = ComposeLocalMatrix() * parentMatrix;
+            ++m_revision;
         }
 };
 } //end namespace nc
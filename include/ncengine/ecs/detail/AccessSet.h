@@ -0,0 +1,91 @@
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+/** @cond internal */
+namespace nc::ecs::detail
+{
+/** Per-type variable whose address identifies a component type. Non-const so the linker can't fold instances. */
+template<class T>
+inline char TypeTag = 0;
+
+template<class T>
+constexpr auto TypeKey() noexcept -> const void*
+{
+    return &TypeTag<std::remove_const_t<T>>;
+}
+
+/** Check if two sorted key lists share an element. */
+inline auto Intersects(const std::vector<const void*>& lhs, const std::vector<const void*>& rhs) noexcept -> bool
+{
+    auto l = lhs.cbegin();
+    auto r = rhs.cbegin();
+    while (l != lhs.cend() && r != rhs.cend())
+    {
+        if (std::less<>{}(*l, *r))
+            ++l;
+        else if (std::less<>{}(*r, *l))
+            ++r;
+        else
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * Component types a unit of logic declares it will touch.
+ *
+ * Writes are restricted to the logic's own entity, while reads may target any entity. Two pieces of logic can
+ * therefore run concurrently unless one writes a type the other reads. Keys are kept sorted for merging.
+ */
+struct AccessSet
+{
+    std::vector<const void*> reads;
+    std::vector<const void*> writes;
+
+    auto ConflictsWith(const AccessSet& other) const noexcept -> bool
+    {
+        return Intersects(writes, other.reads) || Intersects(other.writes, reads);
+    }
+
+    void Merge(const AccessSet& other)
+    {
+        auto merge = [](std::vector<const void*>& dst, const std::vector<const void*>& src)
+        {
+            auto merged = std::vector<const void*>{};
+            merged.reserve(dst.size() + src.size());
+            std::ranges::set_union(dst, src, std::back_inserter(merged), std::less<>{});
+            dst = std::move(merged);
+        };
+
+        merge(reads, other.reads);
+        merge(writes, other.writes);
+    }
+};
+
+/** Build the AccessSet for a list of types, where const-qualified types are read-only. */
+template<class... Ts>
+auto MakeAccessSet() -> AccessSet
+{
+    auto out = AccessSet{};
+    ((std::is_const_v<Ts> ? out.reads : out.writes).push_back(TypeKey<Ts>()), ...);
+    for (auto* keys : {&out.reads, &out.writes})
+    {
+        std::ranges::sort(*keys, std::less<>{});
+        const auto [first, last] = std::ranges::unique(*keys);
+        keys->erase(first, last);
+    }
+
+    return out;
+}
+
+/** Shared AccessSet instance for a type list, so logic with identical declarations can be batched by address. */
+template<class... Ts>
+inline const AccessSet g_accessSet = MakeAccessSet<Ts...>();
+} // namespace nc::ecs::detail
+/** @endcond */
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "ncengine/ecs/Entity.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <vector>
+
+/** @cond internal */
+namespace nc::ecs::detail
+{
+/**
+ * Tracks which component pools hold data for each entity.
+ *
+ * Each entity index owns a fixed-width row of bits, with one bit per registered pool. Rows grow to a new word
+ * when more than a multiple of 64 pools are registered. This lets entity removal visit only the pools that
+ * actually contain the entity rather than every registered pool.
+ *
+ * Pools sharing a word may be written from different threads, so Set() and Unset() update bits atomically. Reads
+ * and whole-row operations are only done while committing, when no pool is being modified.
+ */
+class EntitySignatures
+{
+    public:
+        using word_type = uint64_t;
+        static constexpr auto BitsPerWord = 64u;
+
+        explicit EntitySignatures(size_t maxEntities)
+            : m_maxEntities{maxEntities} {}
+
+        /** Reserve a bit for a new pool, returning its index. */
+        auto AddPool() -> uint32_t
+        {
+            const auto bit = m_poolCount++;
+            if (bit == m_wordsPerEntity * BitsPerWord)
+                Widen();
+
+            return bit;
+        }
+
+        void Set(Entity::index_type index, uint32_t bit) noexcept
+        {
+            Word(index, bit).fetch_or(Mask(bit), std::memory_order_relaxed);
+        }
+
+        void Unset(Entity::index_type index, uint32_t bit) noexcept
+        {
+            Word(index, bit).fetch_and(~Mask(bit), std::memory_order_relaxed);
+        }
+
+        auto Test(Entity::index_type index, uint32_t bit) const noexcept -> bool
+        {
+            return (Row(index)[bit / BitsPerWord] & Mask(bit)) != 0;
+        }
+
+        /** Clear all bits for an entity. */
+        void Reset(Entity::index_type index) noexcept
+        {
+            std::fill_n(Row(index), m_wordsPerEntity, word_type{0});
+        }
+
+        /** Clear all bits for all entities. */
+        void Clear() noexcept
+        {
+            std::ranges::fill(m_bits, word_type{0});
+        }
+
+        /** Invoke func with the bit of every pool holding data for an entity. */
+        template<std::invocable<uint32_t> F>
+        void ForEachPool(Entity::index_type index, F&& func) const
+        {
+            const auto* row = Row(index);
+            for (auto word = 0u; word < m_wordsPerEntity; ++word)
+            {
+                for (auto bits = row[word]; bits != 0; bits &= bits - 1)
+                {
+                    func(static_cast<uint32_t>(word * BitsPerWord + std::countr_zero(bits)));
+                }
+            }
+        }
+
+        auto PoolCount() const noexcept -> uint32_t { return m_poolCount; }
+
+    private:
+        std::vector<word_type> m_bits;
+        size_t m_maxEntities;
+        uint32_t m_wordsPerEntity = 0u;
+        uint32_t m_poolCount = 0u;
+
+        static constexpr auto Mask(uint32_t bit) noexcept -> word_type
+        {
+            return word_type{1} << (bit % BitsPerWord);
+        }
+
+        auto Word(Entity::index_type index, uint32_t bit) noexcept -> std::atomic_ref<word_type>
+        {
+            static_assert(alignof(word_type) >= std::atomic_ref<word_type>::required_alignment);
+            return std::atomic_ref<word_type>{Row(index)[bit / BitsPerWord]};
+        }
+
+        auto Row(Entity::index_type index) noexcept -> word_type*
+        {
+            return m_bits.data() + static_cast<size_t>(index) * m_wordsPerEntity;
+        }
+
+        auto Row(Entity::index_type index) const noexcept -> const word_type*
+        {
+            return m_bits.data() + static_cast<size_t>(index) * m_wordsPerEntity;
+        }
+
+        void Widen()
+        {
+            const auto oldWords = m_wordsPerEntity++;
+            auto widened = std::vector<word_type>(m_maxEntities * m_wordsPerEntity, word_type{0});
+            for (auto entity = 0ull; entity < m_maxEntities && oldWords != 0; ++entity)
+            {
+                std::copy_n(m_bits.data() + entity * oldWords, oldWords, widened.data() + entity * m_wordsPerEntity);
+            }
+
+            m_bits = std::move(widened);
+        }
+};
+} // namespace nc::ecs::detail
+/** @endcond */
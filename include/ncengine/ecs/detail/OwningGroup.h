@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace nc::ecs
+{
+class ComponentPoolBase;
+} // namespace nc::ecs
+
+/** @cond internal */
+namespace nc::ecs::detail
+{
+/**
+ * Shared state for component pools owned by a group.
+ *
+ * Entities having a component in every owned pool occupy the first `size` positions of each pool, in the same
+ * order, so grouped components can be visited with parallel linear scans instead of per-entity lookups. Owned
+ * pools keep the prefix intact as components are committed and removed.
+ */
+struct OwningGroupState
+{
+    std::vector<ComponentPoolBase*> pools;
+    size_t size = 0ull;
+};
+
+/** Get the group owning exactly the given pools, or nullptr if there isn't one. */
+template<class... Pools>
+auto FindOwningGroup(const Pools&... pools) noexcept -> const OwningGroupState*
+{
+    const auto* group = (pools.GetOwningGroup(), ...);
+    if (!group || group->pools.size() != sizeof...(Pools))
+        return nullptr;
+
+    return ((pools.GetOwningGroup() == group) && ...) ? group : nullptr;
+}
+} // namespace nc::ecs::detail
+/** @endcond */
@@ -11,18 +11,6 @@
 /** @cond internal */
 namespace nc::ecs::detail
 {
-template<class T>
-struct StagedComponent
-{
-    Entity entity;
-    T component;
-
-    auto operator==(const Entity& other) const noexcept
-    {
-        return entity == other;
-    }
-};
-
 template<class T, class... Args>
 auto Construct(Entity entity, Args&&... args)
 {
@@ -5,8 +5,11 @@
 #include "ncutility/Algorithm.h"
 
 #include <algorithm>
+#include <array>
+#include <memory>
 #include <numeric>
 #include <span>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -20,35 +23,54 @@ namespace nc::ecs::detail
  * provides both a contiguous view of all components and constant time random lookup of a component,
  * given its parent entity, at the cost of space + extra indirection.
  *
- * The sparse array is allocated upon construction using capacity * 4 bytes, while the component
- * array grows dynamically up to this size. An additional array of entities is kept, with the same
- * order as the components. This enables look up from a component to an entity and viewing a
- * component pool as a range of entities.
+ * The sparse array is split into fixed-size pages which are only allocated once an entity in their
+ * range is written. Unallocated pages all point to a shared, read-only page of null indices, so
+ * lookups never branch on page presence and memory scales with the entity indices actually used
+ * rather than with capacity. The component array grows dynamically up to capacity. An additional
+ * array of entities is kept, with the same order as the components. This enables look up from a
+ * component to an entity and viewing a component pool as a range of entities.
  *
  * Random access is achieved by indexing the sparse array with an entity's index, then indexing
  * into the packed array with the resulting index to get the component. A value of
  * Entity::NullIndex in the sparse array indicates no component is attached to that entity.
+ *
+ * Sparse entries may alternatively hold a staged index, tagged with StagedTag, referring to a
+ * component the owner is holding outside of the packed array until it is inserted. Staged entities
+ * are not considered contained, but can be found in constant time with GetStagedIndex().
  */
 template<class T>
 class SparseSet
 {
     public:
         using index_type = Entity::index_type;
+        static constexpr index_type StagedTag = index_type{1} << 31;
+        static constexpr size_t PageSize = 4096ull;
 
         explicit SparseSet(size_t maxCount)
-            : m_sparse(maxCount, Entity::NullIndex) {}
+            : m_pages((maxCount + PageSize - 1) / PageSize, NullPage()),
+              m_ownedPages(m_pages.size()),
+              m_maxCount{maxCount}
+        {
+            if (maxCount > StagedTag)
+                throw NcError{"SparseSet capacity exceeds the maximum supported size."};
+        }
 
         auto Insert(Entity entity, const T& component) -> T&;
         auto Insert(Entity entity, T&& component) -> T&;
         auto Remove(Entity entity) -> bool;
+        void RemoveBatch(std::span<const Entity> entities);
         auto Get(Entity entity) -> T&;
         auto Get(Entity entity) const -> const T&;
         auto GetParent(const T* component) const noexcept -> Entity;
         auto GetIndex(Entity entity) const -> index_type;
         auto GetEntity(index_type index) const -> Entity;
         auto Contains(Entity entity) const noexcept -> bool;
+        void Stage(Entity entity, index_type stagedIndex);
+        void Unstage(Entity entity) noexcept;
+        auto GetStagedIndex(Entity entity) const noexcept -> index_type;
         auto Size() const noexcept -> size_t { return m_dense.size(); }
-        auto MaxSize() const noexcept -> size_t { return m_sparse.size(); }
+        auto MaxSize() const noexcept -> size_t { return m_maxCount; }
+        auto AllocatedPageCount() const noexcept -> size_t;
         void Swap(Entity lhs, Entity rhs);
         void Reserve(size_t capacity);
         auto GetPackedArray() noexcept -> std::span<T> { return m_dense; }
@@ -61,18 +83,82 @@ class SparseSet
         void Sort(Predicate&& lessThan);
 
     private:
-        std::vector<index_type> m_sparse;
+        using page_type = std::array<index_type, PageSize>;
+
+        std::vector<const index_type*> m_pages;               // read view; unallocated pages are NullPage()
+        std::vector<std::unique_ptr<page_type>> m_ownedPages; // write view; null until first write
         std::vector<T> m_dense;
         std::vector<Entity> m_entities;
+        std::vector<index_type> m_holes; // scratch space for RemoveBatch()
+        size_t m_maxCount;
 
+        static auto NullPage() noexcept -> const index_type*;
+        auto GetSparse(index_type sparseIndex) const -> index_type;
+        auto AssureSparse(index_type sparseIndex) -> index_type&;
+        void ReleasePages() noexcept;
         void InsertEntity(Entity entity);
 };
 
+template<class T>
+auto SparseSet<T>::NullPage() noexcept -> const index_type*
+{
+    static constexpr auto page = []()
+    {
+        auto out = page_type{};
+        out.fill(Entity::NullIndex);
+        return out;
+    }();
+
+    return page.data();
+}
+
+template<class T>
+auto SparseSet<T>::GetSparse(index_type sparseIndex) const -> index_type
+{
+    if (sparseIndex >= m_maxCount)
+        throw std::out_of_range{"SparseSet index out of range."};
+
+    return m_pages[sparseIndex / PageSize][sparseIndex % PageSize];
+}
+
+template<class T>
+auto SparseSet<T>::AssureSparse(index_type sparseIndex) -> index_type&
+{
+    if (sparseIndex >= m_maxCount)
+        throw std::out_of_range{"SparseSet index out of range."};
+
+    const auto pageIndex = sparseIndex / PageSize;
+    auto& page = m_ownedPages[pageIndex];
+    if (!page)
+    {
+        page = std::make_unique<page_type>();
+        page->fill(Entity::NullIndex);
+        m_pages[pageIndex] = page->data();
+    }
+
+    return (*page)[sparseIndex % PageSize];
+}
+
+template<class T>
+void SparseSet<T>::ReleasePages() noexcept
+{
+    std::ranges::fill(m_pages, NullPage());
+    for (auto& page : m_ownedPages)
+        page.reset();
+}
+
+template<class T>
+auto SparseSet<T>::AllocatedPageCount() const noexcept -> size_t
+{
+    return static_cast<size_t>(std::ranges::count_if(m_ownedPages, [](const auto& page) { return page != nullptr; }));
+}
+
 template<class T>
 void SparseSet<T>::InsertEntity(Entity entity)
 {
-    auto& denseIndex = m_sparse.at(entity.Index());
-    if (denseIndex != Entity::NullIndex)
+    // Inserting a staged entity replaces its staged index
+    auto& denseIndex = AssureSparse(entity.Index());
+    if (!(denseIndex & StagedTag))
         throw NcError{"Entity already exists."};
 
     denseIndex = static_cast<index_type>(m_entities.size());
@@ -103,27 +189,71 @@ auto SparseSet<T>::Remove(Entity toRemove) -> bool
 
     const auto toRemoveSparse = toRemove.Index();
     const auto swappedSparse = m_entities.back().Index();
-    const auto toRemoveDense = m_sparse.at(toRemoveSparse);
+    const auto toRemoveDense = GetSparse(toRemoveSparse);
 
     m_dense.at(toRemoveDense) = std::move(m_dense.back());
     m_dense.pop_back();
     m_entities.at(toRemoveDense) = m_entities.back();
     m_entities.pop_back();
-    m_sparse.at(swappedSparse) = toRemoveDense;
-    m_sparse.at(toRemoveSparse) = Entity::NullIndex;
+    AssureSparse(swappedSparse) = toRemoveDense;
+    AssureSparse(toRemoveSparse) = Entity::NullIndex;
     return true;
 }
 
+/**
+ * Remove a set of entities, all of which must be contained, in a single compaction pass.
+ *
+ * Vacated slots below the new size are filled from the live tail of the packed array, so each surviving
+ * element moves at most once and the cost scales with the number of removals rather than the set size.
+ */
+template<class T>
+void SparseSet<T>::RemoveBatch(std::span<const Entity> entities)
+{
+    m_holes.clear();
+    for (auto entity : entities)
+    {
+        if (GetSparse(entity.Index()) & StagedTag)
+            throw NcError{"Entity does not exist."};
+
+        auto& denseIndex = AssureSparse(entity.Index());
+
+        m_holes.push_back(denseIndex);
+        denseIndex = Entity::NullIndex;
+    }
+
+    std::ranges::sort(m_holes);
+    const auto newSize = static_cast<index_type>(m_dense.size() - m_holes.size());
+    auto tailHole = m_holes.end();
+    auto source = static_cast<index_type>(m_dense.size());
+    for (auto hole = m_holes.begin(); hole != m_holes.end() && *hole < newSize; ++hole)
+    {
+        // Take the last element that isn't itself being removed
+        --source;
+        while (tailHole != hole && *(tailHole - 1) == source)
+        {
+            --tailHole;
+            --source;
+        }
+
+        m_dense[*hole] = std::move(m_dense[source]);
+        m_entities[*hole] = m_entities[source];
+        AssureSparse(m_entities[*hole].Index()) = *hole;
+    }
+
+    m_dense.erase(m_dense.begin() + newSize, m_dense.end());
+    m_entities.erase(m_entities.begin() + newSize, m_entities.end());
+}
+
 template<class T>
 auto SparseSet<T>::Get(Entity entity) -> T&
 {
-    return m_dense.at(m_sparse.at(entity.Index()));
+    return m_dense.at(GetSparse(entity.Index()));
 }
 
 template<class T>
 auto SparseSet<T>::Get(Entity entity) const -> const T&
 {
-    return m_dense.at(m_sparse.at(entity.Index()));
+    return m_dense.at(GetSparse(entity.Index()));
 }
 
 template<class T>
@@ -138,20 +268,50 @@ auto SparseSet<T>::GetParent(const T* component) const noexcept -> Entity
 template<class T>
 auto SparseSet<T>::GetIndex(Entity entity) const -> index_type
 {
-    return m_sparse.at(entity.Index());
+    return GetSparse(entity.Index());
 }
 
 template<class T>
 auto SparseSet<T>::GetEntity(index_type index) const -> Entity
 {
-    return m_entities.at(m_sparse.at(index));
+    return m_entities.at(GetSparse(index));
 }
 
 template<class T>
 auto SparseSet<T>::Contains(Entity entity) const noexcept -> bool
 {
+    // NullIndex also has the tag bit set, so this rejects both empty and staged entries
     const auto i = entity.Index();
-    return i < m_sparse.size() ? m_sparse[i] != Entity::NullIndex : false;
+    return i < m_maxCount ? !(m_pages[i / PageSize][i % PageSize] & StagedTag) : false;
+}
+
+template<class T>
+void SparseSet<T>::Stage(Entity entity, index_type stagedIndex)
+{
+    if (GetSparse(entity.Index()) != Entity::NullIndex)
+        throw NcError{"Entity already exists."};
+
+    AssureSparse(entity.Index()) = stagedIndex | StagedTag;
+}
+
+template<class T>
+void SparseSet<T>::Unstage(Entity entity) noexcept
+{
+    // A staged entry implies its page is already allocated
+    if (GetStagedIndex(entity) != Entity::NullIndex)
+        AssureSparse(entity.Index()) = Entity::NullIndex;
+}
+
+template<class T>
+auto SparseSet<T>::GetStagedIndex(Entity entity) const noexcept -> index_type
+{
+    const auto i = entity.Index();
+    if (i >= m_maxCount)
+        return Entity::NullIndex;
+
+    const auto sparseIndex = m_pages[i / PageSize][i % PageSize];
+    return sparseIndex != Entity::NullIndex && (sparseIndex & StagedTag) ? sparseIndex & ~StagedTag
+                                                                         : Entity::NullIndex;
 }
 
 template<class T>
@@ -162,10 +322,11 @@ void SparseSet<T>::Swap(Entity lhs, Entity rhs)
 
     const auto sparseIndex1 = lhs.Index();
     const auto sparseIndex2 = rhs.Index();
-    const auto denseIndex1 = m_sparse.at(sparseIndex1);
-    const auto denseIndex2 = m_sparse.at(sparseIndex2);
-    std::swap(m_sparse.at(sparseIndex1), m_sparse.at(sparseIndex2));
+    const auto denseIndex1 = GetSparse(sparseIndex1);
+    const auto denseIndex2 = GetSparse(sparseIndex2);
+    std::swap(AssureSparse(sparseIndex1), AssureSparse(sparseIndex2));
     std::swap(m_entities.at(denseIndex1), m_entities.at(denseIndex2));
+    std::swap(m_dense.at(denseIndex1), m_dense.at(denseIndex2));
 }
 
 template<class T>
@@ -212,8 +373,8 @@ void SparseSet<T>::Sort(Predicate&& lessThan)
             std::swap(m_entities[i1], m_entities[i2]);
             const auto sparse1 = m_entities[i1].Index();
             const auto sparse2 = m_entities[i2].Index();
-            m_sparse[sparse1] = i2;
-            m_sparse[sparse2] = i1;
+            AssureSparse(sparse1) = i2;
+            AssureSparse(sparse2) = i1;
             permutation[cur] = cur;
             cur = next;
             next = permutation[cur];
@@ -224,7 +385,8 @@ void SparseSet<T>::Sort(Predicate&& lessThan)
 template<class T>
 void SparseSet<T>::ClearNonPersistent()
 {
-    std::ranges::fill(m_sparse, Entity::NullIndex);
+    // Pages are rebuilt for persistent entities only
+    ReleasePages();
     auto swapToIndex = 0u;
     for (auto [denseIndex, entity] : algo::Enumerate(m_entities))
     {
@@ -232,7 +394,7 @@ void SparseSet<T>::ClearNonPersistent()
             continue;
 
         // push persistent entities/components to the front
-        m_sparse.at(entity.Index()) = swapToIndex;
+        AssureSparse(entity.Index()) = swapToIndex;
         if (swapToIndex != denseIndex) // don't self move!
         {
             m_dense.at(swapToIndex) = std::move(m_dense.at(denseIndex));
@@ -251,7 +413,7 @@ void SparseSet<T>::ClearNonPersistent()
 template<class T>
 void SparseSet<T>::Clear()
 {
-    std::ranges::fill(m_sparse, Entity::NullIndex);
+    ReleasePages();
     m_dense.clear();
     m_dense.shrink_to_fit();
     m_entities.clear();
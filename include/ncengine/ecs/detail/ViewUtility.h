@@ -88,6 +88,13 @@ class SingleViewIterator final
         iterator_type m_cur;
 };
 
+/**
+ * Iterator for multiple storage pools.
+ *
+ * Entities in the basis pool are checked against every other pool with a lookup. When the pools are owned by a
+ * group, the basis range is the group's prefix and components are instead read from the same position in each
+ * pool, so no lookups are needed.
+ */
 template<PooledComponent... Ts>
 class MultiViewIterator final
 {
@@ -107,6 +114,12 @@ class MultiViewIterator final
             if(m_cur != m_end && !fill_values()) operator++();
         }
 
+        MultiViewIterator(basis_iterator beg, basis_iterator cur, basis_iterator end, value_type groupData) noexcept
+            : m_cur{cur}, m_end{end}, m_groupBegin{beg}, m_registry{nullptr}, m_currentValues{}, m_groupData{groupData}
+        {
+            if(m_cur != m_end) fill_values();
+        }
+
         auto operator++() noexcept -> MultiViewIterator&
         {
             while(++m_cur != m_end && !fill_values()) {}
@@ -153,14 +166,23 @@ class MultiViewIterator final
     private:
         basis_iterator m_cur;
         basis_iterator m_end;
+        basis_iterator m_groupBegin = {};
         Registry* m_registry;
         value_type m_currentValues;
+        value_type m_groupData = {}; // first component in each pool when grouped
 
         template<class T>
         using raw_type = std::remove_const_t<std::remove_pointer_t<std::remove_reference_t<T>>>;
 
         bool fill_values()
         {
+            if (!m_registry)
+            {
+                const auto offset = m_cur - m_groupBegin;
+                m_currentValues = std::apply([offset](auto*... data) { return value_type{(data + offset)...}; }, m_groupData);
+                return true;
+            }
+
             auto entity = *m_cur;
             auto registry = m_registry;
             return std::apply([entity, registry](auto*&... element)
@@ -193,17 +215,39 @@ struct ViewStorageAdaptor
         );
     }
 
+    static auto group(Registry* registry) noexcept -> const OwningGroupState*
+    {
+        return FindOwningGroup(*registry->StorageFor<std::remove_const_t<Ts>>()...);
+    }
+
     static auto begin(storage_type* basis, Registry* registry) noexcept -> iterator
     {
+        if (const auto* owningGroup = group(registry))
+        {
+            auto entities = owningGroup->pools.front()->GetEntityPool().first(owningGroup->size);
+            return iterator{std::begin(entities), std::begin(entities), std::end(entities), group_data(registry)};
+        }
+
         auto entities = basis->GetEntityPool();
         return iterator{std::begin(entities), std::end(entities), registry};
     }
 
     static auto end(storage_type* basis, Registry* registry) noexcept -> iterator
     {
+        if (const auto* owningGroup = group(registry))
+        {
+            auto entities = owningGroup->pools.front()->GetEntityPool().first(owningGroup->size);
+            return iterator{std::begin(entities), std::end(entities), std::end(entities), group_data(registry)};
+        }
+
         auto entities = basis->GetEntityPool();
         return iterator{std::end(entities), std::end(entities), registry};
     }
+
+    static auto group_data(Registry* registry) noexcept -> std::tuple<Ts*...>
+    {
+        return std::tuple<Ts*...>{registry->StorageFor<std::remove_const_t<Ts>>()->GetComponents().data()...};
+    }
 };
 
 /** Specialization for views over entities. */
@@ -107,12 +107,14 @@ auto GetSupportedApis() -> std::span<const std::string_view>;
  * @brief Build an NcGraphics instance.
  * 
  * The NcAsset, NcScene, and NcWindow modules must be registered prior to initializing NcGraphics.
+ * @param dispatcher Dispatcher used to split per-frame work, such as culling, across worker threads.
  */
 auto BuildGraphicsModule(const config::ProjectSettings& projectSettings,
                          const config::GraphicsSettings& graphicsSettings,
                          const config::MemorySettings& memorySettings,
                          ModuleProvider modules,
                          Registry* registry,
+                         const task::AsyncDispatcher& dispatcher,
                          SystemEvents& events) -> std::unique_ptr<NcGraphics>;
 } // namespace graphics
 } // namespace nc
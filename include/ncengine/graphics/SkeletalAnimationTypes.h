@@ -332,6 +332,50 @@ struct PackedAnimationDecomposed
     std::vector<HasValue> hasValues;
 };
 
+/**
+ * @brief Keyframes for one channel (position, rotation or scale) of every animated bone in a clip.
+ *
+ * Times and values are stored in separate contiguous arrays. The keys for track i occupy the range
+ * [keyOffsets[i], keyOffsets[i + 1]).
+ */
+template<class T>
+struct KeyframeChannel
+{
+    std::vector<float> times;
+    std::vector<T> values;
+    std::vector<uint32_t> keyOffsets;
+};
+
+/**
+ * @brief A SkeletalAnimation resolved against a PackedRig for sampling.
+ *
+ * Bone names are resolved to PackedRig::boneNames indices once when the clip is compiled. Track i animates rig
+ * bone trackBones[i]; rig bones without animation data have no track. Tracks for bones with children come first,
+ * so sampling only the first coreTrackCount tracks skips leaf bones (fingers, accessories, etc.).
+ */
+struct CompiledClip
+{
+    std::vector<uint32_t> trackBones;
+    KeyframeChannel<Vector3> positions;
+    KeyframeChannel<Quaternion> rotations;
+    KeyframeChannel<Vector3> scales;
+    uint32_t boneCount = 0u;
+    uint32_t coreTrackCount = 0u;
+};
+
+/**
+ * @brief The last keyframe sampled per track of a CompiledClip.
+ *
+ * Playback time mostly moves forward by less than a keyframe, so sampling resumes the search from the cursor
+ * instead of from the first keyframe. The cursor restarts from the beginning when time moves backwards.
+ */
+struct ClipCursor
+{
+    std::vector<uint32_t> positions;
+    std::vector<uint32_t> rotations;
+    std::vector<uint32_t> scales;
+};
+
 /**
  * @brief The unit of work representing all the data SkeletalAnimationSystem needs to process each frame per animation.
  */
@@ -344,5 +388,12 @@ struct UnitOfWork
     float blendFromTime;
     float blendToTime;
     float blendFactor;
+    const CompiledClip* blendFromClip = nullptr;
+    const CompiledClip* blendToClip = nullptr;
+    ClipCursor blendFromCursor = {};
+    ClipCursor blendToCursor = {};
+    uint32_t updatePhase = 0u;             // Staggers throttled updates across units
+    uint32_t lastOutputOffset = UINT32_MAX; // First matrix written for this unit last frame, if any
+    float pendingTime = 0.0f;              // Seconds elapsed since the unit was last evaluated
 };
 } // namespace nc::graphics::anim
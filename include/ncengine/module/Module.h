@@ -35,6 +35,15 @@ class Module
         /** @brief Called on registered modules when the task graphs are constructed. */
         virtual void OnBuildTaskGraph(task::UpdateTasks&, task::RenderTasks&) {}
 
+        /**
+         * @brief Called on registered modules from the main thread after update tasks finish and before render tasks
+         *        begin, while no tasks are running.
+         * @note Modules with render tasks should capture any game state those tasks read here. With
+         *       EngineSettings::pipelineRender enabled, render tasks run concurrently with the next frame's update
+         *       tasks and must not read the registry or other state modified during update.
+         */
+        virtual void OnRenderSync() {}
+
         /** @brief Called on registered modules prior to loading a new scene. */
         virtual void OnBeforeSceneLoad() {}
 
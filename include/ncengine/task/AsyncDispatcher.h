@@ -6,6 +6,11 @@
 
 #include "taskflow/taskflow.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+
 namespace nc::task
 {
 /** @brief Dispatcher for running tasks on the thread pool outside of a TaskGraph. */
@@ -28,6 +33,84 @@ class AsyncDispatcher
             m_executor->silent_async(std::forward<F>(f));
         }
 
+        /**
+         * @brief Invoke func(begin, end) over contiguous chunks of [0, count) in parallel, returning once all chunks
+         *        have finished.
+         *
+         * Chunks hold at least grainSize indices, and there are at most as many as there are workers. The calling
+         * thread runs the first chunk itself. When called from a worker, the wait keeps executing other pool tasks
+         * instead of blocking, so nested parallel loops cannot starve the pool. The first exception thrown by any
+         * chunk is rethrown to the caller after every chunk has finished.
+         */
+        template<std::invocable<size_t, size_t> F>
+        void ParallelFor(size_t count, size_t grainSize, F&& func) const
+        {
+            const auto grain = std::max(grainSize, size_t{1});
+            const auto chunkCount = std::min((count + grain - 1) / grain, std::max(MaxConcurrency(), size_t{1}));
+            if (chunkCount <= 1)
+            {
+                func(size_t{0}, count);
+                return;
+            }
+
+            // Tasks share ownership of the completion state, as the last one may still notify after the caller
+            // has observed completion and returned.
+            struct State
+            {
+                std::atomic<size_t> remaining;
+                std::atomic_flag failed;
+                std::exception_ptr error;
+            };
+
+            const auto chunkSize = (count + chunkCount - 1) / chunkCount;
+            auto state = std::make_shared<State>(chunkCount - 1);
+            auto runChunk = [&func, &state = *state](size_t begin, size_t end) noexcept
+            {
+                try
+                {
+                    func(begin, end);
+                }
+                catch (...)
+                {
+                    if (!state.failed.test_and_set())
+                        state.error = std::current_exception();
+                }
+            };
+
+            for (auto chunk = size_t{1}; chunk < chunkCount; ++chunk)
+            {
+                const auto begin = std::min(chunk * chunkSize, count);
+                const auto end = std::min(begin + chunkSize, count);
+                m_executor->silent_async([runChunk, state, begin, end]()
+                {
+                    runChunk(begin, end);
+                    if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                        state->remaining.notify_all();
+                });
+            }
+
+            runChunk(size_t{0}, std::min(chunkSize, count));
+            auto& remaining = state->remaining;
+            if (IsWorkerThread())
+            {
+                m_executor->corun_until([&remaining]() { return remaining.load(std::memory_order_acquire) == 0; });
+            }
+            else
+            {
+                for (auto left = remaining.load(std::memory_order_acquire); left != 0; left = remaining.load(std::memory_order_acquire))
+                    remaining.wait(left, std::memory_order_acquire);
+            }
+
+            if (state->error)
+                std::rethrow_exception(state->error);
+        }
+
+        /** @brief Check if the calling thread is one of the thread pool's workers. */
+        auto IsWorkerThread() const -> bool
+        {
+            return m_executor->this_worker_id() != -1;
+        }
+
         /** @brief Get the number of workers in the thread pool. */
         auto MaxConcurrency() const -> size_t
         {
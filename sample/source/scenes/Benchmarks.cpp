@@ -5,6 +5,7 @@
 #include "ncengine/NcEngine.h"
 #include "ncengine/config/Config.h"
 #include "ncengine/ecs/InvokeFreeComponent.h"
+#include "ncengine/ecs/NcEcs.h"
 #include "ncengine/graphics/ParticleEmitter.h"
 #include "ncengine/graphics/NcGraphics.h"
 #include "ncengine/graphics/SceneNavigationCamera.h"
@@ -24,6 +25,12 @@ auto g_maxEntities = 0u;
 auto g_maxPointLights = 0u;
 auto g_maxSpotLights = 0u;
 auto g_currentEntities = 0u;
+auto g_ncEcs = static_cast<nc::ecs::NcEcs*>(nullptr);
+
+constexpr auto g_transformUpdateModes = std::array{
+    std::string_view{"Graph Walk"},
+    std::string_view{"Depth Ordered"}
+};
 
 constexpr auto g_assets = std::array{
     std::string_view{nc::asset::CubeMesh},
@@ -192,6 +199,7 @@ struct entity_hierarchy
     static inline unsigned SpawnCount = 1;
     static inline unsigned DestroyCount = 1;
     static inline unsigned HierarchySize = 200;
+    static inline unsigned HierarchyBranching = 1; // 1 builds a deep chain, larger values build wide trees
 
     static void Rotate(nc::Entity self, nc::ecs::Ecs world, float dt)
     {
@@ -201,22 +209,116 @@ struct entity_hierarchy
 
     static void AttachChildren(nc::ecs::Ecs world, nc::Entity root)
     {
-        auto parent = root;
+        // Attach children breadth-first so each node receives up to HierarchyBranching children.
+        auto parents = std::vector<nc::Entity>{root};
+        auto parentIndex = 0ull;
+        auto childrenOfParent = 0u;
         auto count = HierarchySize;
         while (count-- > 0)
         {
+            if (childrenOfParent == nc::Max(HierarchyBranching, 1u))
+            {
+                ++parentIndex;
+                childrenOfParent = 0u;
+            }
+
             const auto child = world.Emplace<nc::Entity>({
                 .position = nc::Vector3::Up(),
                 .rotation = nc::Quaternion::FromAxisAngle(nc::Vector3::Up(), 0.05f),
-                .parent = parent
+                .parent = parents.at(parentIndex)
             });
 
             world.Emplace<nc::graphics::MeshRenderer>(child, nc::asset::CubeMesh, RandomPbrMaterial());
-            parent = child;
+            parents.push_back(child);
+            ++childrenOfParent;
         }
     }
 };
 
+// Running average of update times while alternating between modes, so both are measured under the same load
+struct TransformUpdateComparison
+{
+    static constexpr auto SamplesPerSwitch = 30u;
+
+    bool active = false;
+    unsigned framesInMode = 0u;
+    std::array<float, 2> totalMs{};
+    std::array<unsigned, 2> samples{};
+
+    void Reset()
+    {
+        framesInMode = 0u;
+        totalMs = {};
+        samples = {};
+    }
+
+    void Sample()
+    {
+        const auto mode = g_ncEcs->GetTransformUpdateMode();
+        const auto index = static_cast<size_t>(mode);
+
+        // Skip the first frame after a switch; it still reports the previous mode's time
+        if (framesInMode++ > 0u)
+        {
+            totalMs[index] += g_ncEcs->GetTransformUpdateTime(mode);
+            ++samples[index];
+        }
+
+        if (framesInMode > SamplesPerSwitch)
+        {
+            framesInMode = 0u;
+            g_ncEcs->SetTransformUpdateMode(mode == nc::ecs::TransformUpdateMode::GraphWalk
+                ? nc::ecs::TransformUpdateMode::DepthOrdered
+                : nc::ecs::TransformUpdateMode::GraphWalk);
+        }
+    }
+
+    auto Average(size_t index) const -> float
+    {
+        return samples[index] == 0u ? 0.0f : totalMs[index] / static_cast<float>(samples[index]);
+    }
+} g_transformUpdateComparison;
+
+void TransformUpdateWidget(float itemWidth)
+{
+    IMGUI_SCOPE(nc::ui::ImGuiId, "Transform Update");
+    ImGui::Spacing();
+    ImGui::Text("Transform Update");
+
+    auto& comparison = g_transformUpdateComparison;
+    auto selection = std::string{g_transformUpdateModes.at(static_cast<size_t>(g_ncEcs->GetTransformUpdateMode()))};
+    ImGui::SetNextItemWidth(itemWidth);
+    if (nc::ui::Combobox(selection, "##transformupdatemode", g_transformUpdateModes))
+    {
+        const auto mode = selection == g_transformUpdateModes[0]
+            ? nc::ecs::TransformUpdateMode::GraphWalk
+            : nc::ecs::TransformUpdateMode::DepthOrdered;
+
+        g_ncEcs->SetTransformUpdateMode(mode);
+        comparison.framesInMode = 0u;
+    }
+
+    ImGui::SameLine();
+    if (nc::ui::Checkbox(comparison.active, "Compare"))
+        comparison.Reset();
+
+    if (comparison.active)
+        comparison.Sample();
+
+    // Compare by spawning hierarchies with a branching factor of 1 (deep) or a large value (wide)
+    for (auto i = 0ull; i < g_transformUpdateModes.size(); ++i)
+    {
+        const auto mode = static_cast<nc::ecs::TransformUpdateMode>(i);
+        if (comparison.active)
+            ImGui::Text("%s: %.3f ms avg (%u samples)", g_transformUpdateModes[i].data(), comparison.Average(i), comparison.samples[i]);
+        else
+            ImGui::Text("%s: %.3f ms", g_transformUpdateModes[i].data(), g_ncEcs->GetTransformUpdateTime(mode));
+    }
+
+    ImGui::Text("Frame Time: %.3f ms", 1000.0f / ImGui::GetIO().Framerate);
+    ImGui::Spacing();
+}
+
 template<class T>
 void InnerWidget(float buttonWidth, auto&& extension = [](){})
 {
@@ -307,11 +409,17 @@ void Widget()
             InnerWidget<entity_hierarchy>(halfCellWidth, [halfCellWidth](){
                 ImGui::SetNextItemWidth(halfCellWidth);
                 nc::ui::InputU32(entity_hierarchy::HierarchySize, "Hierarchy Size");
+                ImGui::SetNextItemWidth(halfCellWidth);
+                nc::ui::InputU32(entity_hierarchy::HierarchyBranching, "Branching");
             });
 
             ImGui::TableNextColumn();
             InnerWidget<particle_emitter>(halfCellWidth, [](){});
 
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            TransformUpdateWidget(cellWidth);
+
             ImGui::EndTable();
         }
     });
@@ -337,6 +445,7 @@ void Benchmarks::Load(ecs::Ecs world, ModuleProvider modules)
     m_sampleUI->SetWidgetCallback(::Widget);
     auto ncGraphics = modules.Get<graphics::NcGraphics>();
     auto ncRandom = modules.Get<Random>();
+    ::g_ncEcs = modules.Get<ecs::NcEcs>();
 
     ncGraphics->SetSkybox(asset::DefaultSkyboxCubeMap);
 
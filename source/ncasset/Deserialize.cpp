@@ -1,10 +1,12 @@
 #include "Deserialize.h"
 #include "ncasset/Assets.h"
+#include "ncasset/Import.h"
 
 #include "ncutility/BinarySerialization.h"
 #include "ncutility/NcError.h"
 #include "fmt/format.h"
 
+#include <algorithm>
 #include <istream>
 #include <vector>
 
@@ -46,6 +48,31 @@ auto DeserializeImpl(std::istream& stream, std::string_view magicNumber) -> nc::
     nc::serialize::Deserialize(stream, result.asset);
     return result;
 }
+
+void ValidateAudioChannelSize(size_t byteCount, size_t samplesPerChannel, nc::asset::AudioSampleFormat format)
+{
+    if (format != nc::asset::AudioSampleFormat::Int16 && format != nc::asset::AudioSampleFormat::Float32)
+    {
+        throw nc::NcError(fmt::format("Unknown audio sample format: '{}'", static_cast<uint32_t>(format)));
+    }
+
+    if (byteCount != samplesPerChannel * nc::asset::GetSampleSize(format))
+    {
+        throw nc::NcError(fmt::format(
+            "Audio channel size mismatch actual: '{}' expected: '{}'",
+            byteCount, samplesPerChannel * nc::asset::GetSampleSize(format)
+        ));
+    }
+}
+
+// Version 4 clips stored double samples; narrow them to float32 on load.
+auto ConvertLegacyAudioChannel(const std::vector<double>& samples) -> std::vector<std::byte>
+{
+    auto out = std::vector<std::byte>(samples.size() * sizeof(float));
+    auto* dst = reinterpret_cast<float*>(out.data());
+    std::ranges::transform(samples, dst, [](auto sample) { return static_cast<float>(sample); });
+    return out;
+}
 } // anonymous namespace
 
 namespace nc::asset
@@ -59,7 +86,65 @@ auto DeserializeHeader(std::istream& stream) -> NcaHeader
 
 auto DeserializeAudioClip(std::istream& stream) -> DeserializedResult<AudioClip>
 {
-    return DeserializeImpl<AudioClip>(stream, MagicNumber::audioClip);
+    auto result = DeserializedResult<AudioClip>{};
+    result.header = DeserializeHeader(stream);
+    ::ValidateHeader(result.header, MagicNumber::audioClip);
+    if (result.header.version == version4)
+    {
+        auto samplesPerChannel = size_t{};
+        auto left = std::vector<double>{};
+        auto right = std::vector<double>{};
+        nc::serialize::Deserialize(stream, samplesPerChannel);
+        nc::serialize::Deserialize(stream, left);
+        nc::serialize::Deserialize(stream, right);
+        result.asset = AudioClip{
+            samplesPerChannel,
+            AudioSampleFormat::Float32,
+            ::ConvertLegacyAudioChannel(left),
+            ::ConvertLegacyAudioChannel(right)
+        };
+
+        return result;
+    }
+
+    nc::serialize::Deserialize(stream, result.asset);
+    ::ValidateAudioChannelSize(result.asset.leftChannel.size(), result.asset.samplesPerChannel, result.asset.format);
+    ::ValidateAudioChannelSize(result.asset.rightChannel.size(), result.asset.samplesPerChannel, result.asset.format);
+    return result;
+}
+
+auto DeserializeAudioClipLayout(std::istream& stream) -> DeserializedResult<AudioClipLayout>
+{
+    auto result = DeserializedResult<AudioClipLayout>{};
+    result.header = DeserializeHeader(stream);
+    ::ValidateHeader(result.header, MagicNumber::audioClip);
+    if (result.header.version < version5)
+    {
+        throw nc::NcError(fmt::format(
+            "AudioClip layout requires asset version '{}' or later, actual: '{}'",
+            version5, result.header.version
+        ));
+    }
+
+    // Channels are serialized as a size_t byte count followed by the raw samples.
+    auto& layout = result.asset;
+    auto byteCount = size_t{};
+    nc::serialize::Deserialize(stream, layout.samplesPerChannel);
+    nc::serialize::Deserialize(stream, layout.format);
+    nc::serialize::Deserialize(stream, byteCount);
+    ::ValidateAudioChannelSize(byteCount, layout.samplesPerChannel, layout.format);
+    layout.leftChannelOffset = static_cast<size_t>(stream.tellg());
+    stream.seekg(static_cast<std::streamoff>(byteCount), std::ios::cur);
+    nc::serialize::Deserialize(stream, byteCount);
+    ::ValidateAudioChannelSize(byteCount, layout.samplesPerChannel, layout.format);
+    layout.rightChannelOffset = static_cast<size_t>(stream.tellg());
+    stream.seekg(static_cast<std::streamoff>(byteCount), std::ios::cur);
+    if (!stream)
+    {
+        throw nc::NcError("Unexpected end of AudioClip data");
+    }
+
+    return result;
 }
 
 auto DeserializeConcaveCollider(std::istream& stream) -> DeserializedResult<ConcaveCollider>
@@ -22,6 +22,9 @@ auto DeserializeHeader(std::istream& stream) -> NcaHeader;
 /** @brief Construct an AudioClip from data in a binary stream. */
 auto DeserializeAudioClip(std::istream& stream) -> DeserializedResult<AudioClip>;
 
+/** @brief Read the sample layout of an AudioClip, leaving the stream past the end of the blob. */
+auto DeserializeAudioClipLayout(std::istream& stream) -> DeserializedResult<AudioClipLayout>;
+
 /** @brief Construct a ConcaveCollider from data in a binary stream. */
 auto DeserializeConcaveCollider(std::istream& stream) -> DeserializedResult<ConcaveCollider>;
 
@@ -50,6 +50,13 @@ auto ImportAudioClip(const std::filesystem::path& ncaPath) -> AudioClip
     return ImportAudioClip(file);
 }
 
+auto ImportAudioClipLayout(const std::filesystem::path& ncaPath) -> AudioClipLayout
+{
+    auto file = ::OpenNca(ncaPath);
+    auto [header, layout] = DeserializeAudioClipLayout(file);
+    return layout;
+}
+
 auto ImportConcaveCollider(std::istream& data) -> ConcaveCollider
 {
     auto [header, asset] = DeserializeConcaveCollider(data);
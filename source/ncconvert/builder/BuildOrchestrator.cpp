@@ -32,6 +32,12 @@ auto GetOptionText(nc::asset::AssetType type, const nc::convert::Target& target)
             ? std::string_view{"[optimizeMesh: true]"}
             : std::string_view{"[optimizeMesh: false]"};
     }
+    else if (type == nc::asset::AssetType::AudioClip)
+    {
+        return target.options.audioFormat == nc::asset::AudioSampleFormat::Float32
+            ? std::string_view{"[audioFormat: float32]"}
+            : std::string_view{"[audioFormat: int16]"};
+    }
 
     return std::string_view{};
 }
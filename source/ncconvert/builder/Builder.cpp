@@ -57,7 +57,7 @@ auto Builder::Build(asset::AssetType type, const Target& target) -> bool
     {
         case asset::AssetType::AudioClip:
         {
-            const auto asset = m_audioConverter->ImportAudioClip(target.sourcePath);
+            const auto asset = m_audioConverter->ImportAudioClip(target.sourcePath, target.options.audioFormat);
             convert::Serialize(outFile, asset, asset::currentVersion);
             return true;
         }
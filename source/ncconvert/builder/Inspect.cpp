@@ -17,7 +17,8 @@ Header
 
 constexpr auto audioClipTemplate =
 R"(Data
-  samples count {})";
+  samples count {}
+  sample format {})";
 
 constexpr auto concaveColliderTemplate =
 R"(Data
@@ -76,7 +77,7 @@ void Inspect(const std::filesystem::path& ncaPath)
         case asset::AssetType::AudioClip:
         {
             const auto asset = asset::ImportAudioClip(ncaPath);
-            LOG(audioClipTemplate, asset.samplesPerChannel);
+            LOG(audioClipTemplate, asset.samplesPerChannel, ToString(asset.format));
             break;
         }
         case asset::AssetType::ConcaveCollider:
@@ -94,6 +94,7 @@ namespace nc::convert
 void from_json(const nlohmann::json& json, nc::convert::TargetOptions& options)
 {
     options.optimizeMesh = json.value("optimizeMesh", false);
+    options.audioFormat = ToAudioSampleFormat(json.value("audioFormat", std::string{"int16"}));
 }
 
 void ReadManifest(const std::filesystem::path& manifestPath, std::unordered_map<asset::AssetType, std::vector<Target>>& instructions)
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ncasset/AudioSampleFormat.h"
+
 #include <filesystem>
 #include <optional>
 
@@ -9,6 +11,7 @@ namespace nc::convert
 struct TargetOptions
 {
     bool optimizeMesh = false;
+    asset::AudioSampleFormat audioFormat = asset::AudioSampleFormat::Int16;
 };
 
 /** @brief Data describing a required asset conversion. */
@@ -5,16 +5,41 @@
 #include "ncasset/Assets.h"
 #include "ncutility/NcError.h"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstring>
 
 namespace
 {
 const auto supportedFileExtensions = std::array<std::string, 1> { ".wav" };
+
+auto EncodeChannel(const std::vector<double>& samples, nc::asset::AudioSampleFormat format) -> std::vector<std::byte>
+{
+    auto out = std::vector<std::byte>(samples.size() * nc::asset::GetSampleSize(format));
+    if (format == nc::asset::AudioSampleFormat::Int16)
+    {
+        auto encoded = std::vector<int16_t>(samples.size());
+        std::ranges::transform(samples, encoded.begin(), [](auto sample)
+        {
+            return static_cast<int16_t>(std::lround(std::clamp(sample, -1.0, 1.0) * 32767.0));
+        });
+
+        std::memcpy(out.data(), encoded.data(), out.size());
+    }
+    else
+    {
+        auto encoded = std::vector<float>(samples.begin(), samples.end());
+        std::memcpy(out.data(), encoded.data(), out.size());
+    }
+
+    return out;
 }
+} // anonymous namespace
 
 namespace nc::convert
 {
-auto AudioConverter::ImportAudioClip(const std::filesystem::path& path) -> asset::AudioClip
+auto AudioConverter::ImportAudioClip(const std::filesystem::path& path, asset::AudioSampleFormat format) -> asset::AudioClip
 {
     if (!ValidateInputFileExtension(path, supportedFileExtensions))
     {
@@ -27,19 +52,13 @@ auto AudioConverter::ImportAudioClip(const std::filesystem::path& path) -> asset
         throw NcError("Failure opening audio file: ", path.string());
     }
 
-    if (rawAsset.samples.size() == 1)
-    {
-        return asset::AudioClip{
-            rawAsset.samples.at(0).size(),
-            rawAsset.samples.at(0),
-            std::move(rawAsset.samples.at(0))
-        };
-    }
-
+    auto left = ::EncodeChannel(rawAsset.samples.at(0), format);
+    auto right = rawAsset.samples.size() == 1 ? left : ::EncodeChannel(rawAsset.samples.at(1), format);
     return asset::AudioClip{
         rawAsset.samples.at(0).size(),
-        std::move(rawAsset.samples.at(0)),
-        std::move(rawAsset.samples.at(1))
+        format,
+        std::move(left),
+        std::move(right)
     };
 }
 } // namespace nc::convert
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ncasset/AssetsFwd.h"
+#include "ncasset/AudioSampleFormat.h"
 
 #include <filesystem>
 
@@ -9,6 +10,6 @@ namespace nc::convert
 class AudioConverter
 {
     public:
-        auto ImportAudioClip(const std::filesystem::path& path) -> asset::AudioClip;
+        auto ImportAudioClip(const std::filesystem::path& path, asset::AudioSampleFormat format) -> asset::AudioClip;
 };
 } // namespace nc::convert
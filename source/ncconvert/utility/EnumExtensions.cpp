@@ -60,4 +60,33 @@ auto ToString(asset::AssetType type) -> std::string
         fmt::format("Unknown AssetType: {}", static_cast<int>(type))
     );
 }
+
+auto ToAudioSampleFormat(std::string format) -> asset::AudioSampleFormat
+{
+    std::ranges::transform(format, format.begin(), [](char c) { return std::tolower(c); });
+
+    if(format == "int16")
+        return asset::AudioSampleFormat::Int16;
+    else if(format == "float32")
+        return asset::AudioSampleFormat::Float32;
+
+    throw NcError("Failed to parse audio sample format from: " + format);
+}
+
+auto ToString(asset::AudioSampleFormat format) -> std::string
+{
+    switch(format)
+    {
+        case asset::AudioSampleFormat::Int16:
+            return "int16";
+        case asset::AudioSampleFormat::Float32:
+            return "float32";
+        default:
+            break;
+    }
+
+    throw NcError(
+        fmt::format("Unknown AudioSampleFormat: {}", static_cast<int>(format))
+    );
+}
 } // namespace nc::convert
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ncasset/AssetType.h"
+#include "ncasset/AudioSampleFormat.h"
 
 #include <string>
 
@@ -9,4 +10,6 @@ namespace nc::convert
 auto CanOutputMany(asset::AssetType type) -> bool;
 auto ToAssetType(std::string type) -> asset::AssetType;
 auto ToString(asset::AssetType type) -> std::string;
+auto ToAudioSampleFormat(std::string format) -> asset::AudioSampleFormat;
+auto ToString(asset::AudioSampleFormat format) -> std::string;
 }
@@ -10,20 +10,145 @@
 #include "manager/SkeletalAnimationAssetManager.h"
 #include "manager/TextureAssetManager.h"
 
+#include "ncasset/Assets.h"
+
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <exception>
 #include <ranges>
 
+namespace
+{
+template<class T>
+auto IsReady(const std::future<T>& future) -> bool
+{
+    return future.wait_for(std::chrono::seconds{0}) == std::future_status::ready;
+}
+} // anonymous namespace
+
+namespace nc::asset
+{
+/** @brief Imports of a single asset type that are in flight on the thread pool. */
+template<class T>
+struct PendingImports
+{
+    std::vector<std::string> paths;
+    std::vector<std::future<T>> data;
+
+    auto IsReady() const -> bool
+    {
+        return std::ranges::all_of(data, [](const auto& future) { return ::IsReady(future); });
+    }
+
+    void Wait() const noexcept
+    {
+        std::ranges::for_each(data, [](const auto& future) { if (future.valid()) future.wait(); });
+    }
+};
+
+/** @brief A batch of imports that are committed together once every file has been read. */
+struct AsyncLoad
+{
+    PendingImports<AudioClip> audioClips;
+    PendingImports<ConcaveCollider> concaveColliders;
+    PendingImports<CubeMap> cubeMaps;
+    PendingImports<HullCollider> hullColliders;
+    PendingImports<Mesh> meshes;
+    PendingImports<SkeletalAnimation> skeletalAnimations;
+    PendingImports<Texture> textures;
+    std::promise<void> committed;
+
+    auto IsReady() const -> bool
+    {
+        return audioClips.IsReady() && concaveColliders.IsReady() && cubeMaps.IsReady() && hullColliders.IsReady()
+            && meshes.IsReady() && skeletalAnimations.IsReady() && textures.IsReady();
+    }
+
+    void Wait() const noexcept
+    {
+        audioClips.Wait();
+        concaveColliders.Wait();
+        cubeMaps.Wait();
+        hullColliders.Wait();
+        meshes.Wait();
+        skeletalAnimations.Wait();
+        textures.Wait();
+    }
+};
+} // namespace nc::asset
+
+namespace
+{
+template<class Manager, class T>
+void Dispatch(nc::task::AsyncDispatcher& dispatcher,
+              const Manager& manager,
+              const nc::asset::AssetMap& assets,
+              nc::asset::AssetType type,
+              nc::asset::PendingImports<T>& out,
+              bool importInline)
+{
+    const auto pos = assets.find(type);
+    if (pos == assets.cend())
+    {
+        return;
+    }
+
+    for (const auto& path : pos->second)
+    {
+        if (manager.IsLoaded(path) || std::ranges::find(out.paths, path) != out.paths.cend())
+        {
+            continue;
+        }
+
+        auto importFile = [&manager, path]{ return manager.Import(path, false); };
+        out.paths.push_back(path);
+        if (importInline)
+        {
+            // Blocking on the pool from one of its own workers could starve it, so run in place instead.
+            auto task = std::packaged_task<T()>{std::move(importFile)};
+            out.data.push_back(task.get_future());
+            task();
+        }
+        else
+        {
+            out.data.push_back(dispatcher.Async(std::move(importFile)));
+        }
+    }
+}
+
+template<class Manager, class T>
+void Commit(Manager& manager, nc::asset::PendingImports<T>& pending)
+{
+    if (pending.paths.empty())
+    {
+        return;
+    }
+
+    auto imported = std::vector<T>{};
+    imported.reserve(pending.data.size());
+    for (auto& future : pending.data)
+    {
+        imported.push_back(future.get());
+    }
+
+    manager.Commit(pending.paths, imported);
+}
+} // anonymous namespace
+
 namespace nc::asset
 {
 auto BuildAssetModule(const config::AssetSettings& assetSettings,
                       const config::MemorySettings& memorySettings,
+                      const task::AsyncDispatcher& dispatcher,
                       AssetMap defaults) -> std::unique_ptr<NcAsset>
 {
-    return std::make_unique<NcAssetImpl>(assetSettings, memorySettings, std::move(defaults));
+    return std::make_unique<NcAssetImpl>(assetSettings, memorySettings, dispatcher, std::move(defaults));
 }
 
 NcAssetImpl::NcAssetImpl(const config::AssetSettings& assetSettings,
                          const config::MemorySettings& memorySettings,
+                         const task::AsyncDispatcher& dispatcher,
                          AssetMap defaults)
     : m_audioClipManager{std::make_unique<AudioClipAssetManager>(assetSettings.audioClipsPath)},
       m_concaveColliderManager{std::make_unique<ConcaveColliderAssetManager>(assetSettings.concaveCollidersPath)},
@@ -33,11 +158,20 @@ NcAssetImpl::NcAssetImpl(const config::AssetSettings& assetSettings,
       m_skeletalAnimationManager{std::make_unique<SkeletalAnimationAssetManager>(assetSettings.skeletalAnimationsPath, memorySettings.maxSkeletalAnimations)},
       m_textureManager{std::make_unique<TextureAssetManager>(assetSettings.texturesPath, memorySettings.maxTextures)},
       m_fontManager{std::make_unique<FontAssetManager>(assetSettings.fontsPath)},
-      m_defaults{std::move(defaults)}
+      m_defaults{std::move(defaults)},
+      m_dispatcher{dispatcher},
+      m_pendingLoads{}
 {
 }
 
-NcAssetImpl::~NcAssetImpl() noexcept = default;
+NcAssetImpl::~NcAssetImpl() noexcept
+{
+    // In-flight imports reference the managers
+    for (const auto& load : m_pendingLoads)
+    {
+        load->Wait();
+    }
+}
 
 void NcAssetImpl::OnBeforeSceneLoad()
 {
@@ -76,20 +210,73 @@ auto NcAssetImpl::OnFontUpdate() noexcept -> Signal<>&
 
 void NcAssetImpl::LoadAssets(const AssetMap& assets)
 {
-    if (assets.contains(asset::AssetType::AudioClip))
-        m_audioClipManager->Load(assets.at(asset::AssetType::AudioClip), false);
-    if (assets.contains(asset::AssetType::ConcaveCollider))
-        m_concaveColliderManager->Load(assets.at(asset::AssetType::ConcaveCollider), false);
-    if (assets.contains(asset::AssetType::CubeMap))
-        m_cubeMapManager->Load(assets.at(asset::AssetType::CubeMap), false);
-    if (assets.contains(asset::AssetType::HullCollider))
-        m_hullColliderManager->Load(assets.at(asset::AssetType::HullCollider), false);
-    if (assets.contains(asset::AssetType::Mesh))
-        m_meshManager->Load(assets.at(asset::AssetType::Mesh), false);
-    if (assets.contains(asset::AssetType::SkeletalAnimation))
-        m_skeletalAnimationManager->Load(assets.at(asset::AssetType::SkeletalAnimation), false);
-    if (assets.contains(asset::AssetType::Texture))
-        m_textureManager->Load(assets.at(asset::AssetType::Texture), false);
+    auto load = DispatchImports(assets, m_dispatcher.IsWorkerThread());
+    try
+    {
+        Commit(*load);
+    }
+    catch (...)
+    {
+        load->Wait();
+        throw;
+    }
+}
+
+auto NcAssetImpl::LoadAssetsAsync(const AssetMap& assets) -> std::future<void>
+{
+    auto& load = m_pendingLoads.emplace_back(DispatchImports(assets, false));
+    return load->committed.get_future();
+}
+
+void NcAssetImpl::CommitPendingLoads()
+{
+    auto committedCount = 0ull;
+    for (auto& load : m_pendingLoads)
+    {
+        if (!load->IsReady())
+        {
+            break;
+        }
+
+        try
+        {
+            Commit(*load);
+            load->committed.set_value();
+        }
+        catch (...)
+        {
+            load->Wait();
+            load->committed.set_exception(std::current_exception());
+        }
+
+        ++committedCount;
+    }
+
+    m_pendingLoads.erase(m_pendingLoads.begin(), m_pendingLoads.begin() + committedCount);
+}
+
+auto NcAssetImpl::DispatchImports(const AssetMap& assets, bool importInline) -> std::unique_ptr<AsyncLoad>
+{
+    auto load = std::make_unique<AsyncLoad>();
+    ::Dispatch(m_dispatcher, *m_audioClipManager, assets, AssetType::AudioClip, load->audioClips, importInline);
+    ::Dispatch(m_dispatcher, *m_concaveColliderManager, assets, AssetType::ConcaveCollider, load->concaveColliders, importInline);
+    ::Dispatch(m_dispatcher, *m_cubeMapManager, assets, AssetType::CubeMap, load->cubeMaps, importInline);
+    ::Dispatch(m_dispatcher, *m_hullColliderManager, assets, AssetType::HullCollider, load->hullColliders, importInline);
+    ::Dispatch(m_dispatcher, *m_meshManager, assets, AssetType::Mesh, load->meshes, importInline);
+    ::Dispatch(m_dispatcher, *m_skeletalAnimationManager, assets, AssetType::SkeletalAnimation, load->skeletalAnimations, importInline);
+    ::Dispatch(m_dispatcher, *m_textureManager, assets, AssetType::Texture, load->textures, importInline);
+    return load;
+}
+
+void NcAssetImpl::Commit(AsyncLoad& load)
+{
+    ::Commit(*m_audioClipManager, load.audioClips);
+    ::Commit(*m_concaveColliderManager, load.concaveColliders);
+    ::Commit(*m_cubeMapManager, load.cubeMaps);
+    ::Commit(*m_hullColliderManager, load.hullColliders);
+    ::Commit(*m_meshManager, load.meshes);
+    ::Commit(*m_skeletalAnimationManager, load.skeletalAnimations);
+    ::Commit(*m_textureManager, load.textures);
 }
 
 auto NcAssetImpl::GetLoadedAssets() const noexcept -> AssetMap
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "asset/NcAsset.h"
+#include "ncengine/task/AsyncDispatcher.h"
 
 #include <memory>
+#include <vector>
 
 namespace nc
 {
@@ -22,12 +24,14 @@ class HullColliderAssetManager;
 class MeshAssetManager;
 class SkeletalAnimationAssetManager;
 class TextureAssetManager;
+struct AsyncLoad;
 
 class NcAssetImpl : public NcAsset
 {
     public:
         NcAssetImpl(const config::AssetSettings& assetSettings,
                     const config::MemorySettings& memorySettings,
+                    const task::AsyncDispatcher& dispatcher,
                     AssetMap defaults);
         ~NcAssetImpl() noexcept;
 
@@ -40,6 +44,8 @@ class NcAssetImpl : public NcAsset
         auto OnSkeletalAnimationUpdate() noexcept -> Signal<const SkeletalAnimationUpdateEventData&>& override;
         auto OnFontUpdate() noexcept -> Signal<>& override;
         void LoadAssets(const AssetMap& assets) override;
+        auto LoadAssetsAsync(const AssetMap& assets) -> std::future<void> override;
+        void CommitPendingLoads() override;
         auto GetLoadedAssets() const noexcept -> AssetMap override;
 
     private:
@@ -52,6 +58,11 @@ class NcAssetImpl : public NcAsset
         std::unique_ptr<TextureAssetManager> m_textureManager;
         std::unique_ptr<FontAssetManager> m_fontManager;
         AssetMap m_defaults;
+        task::AsyncDispatcher m_dispatcher;
+        std::vector<std::unique_ptr<AsyncLoad>> m_pendingLoads;
+
+        auto DispatchImports(const AssetMap& assets, bool importInline) -> std::unique_ptr<AsyncLoad>;
+        void Commit(AsyncLoad& load);
 };
 } // namespace asset
 } // namespace nc
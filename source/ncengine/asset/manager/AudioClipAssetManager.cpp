@@ -3,6 +3,8 @@
 
 #include "ncasset/Import.h"
 
+#include <ranges>
+
 namespace nc::asset
 {
 AudioClipAssetManager::AudioClipAssetManager(const std::string& assetDirectory)
@@ -11,33 +13,95 @@ AudioClipAssetManager::AudioClipAssetManager(const std::string& assetDirectory)
 {
 }
 
-bool AudioClipAssetManager::Load(const std::string& path, bool isExternal, asset_flags_type)
+bool AudioClipAssetManager::Load(const std::string& path, bool isExternal, asset_flags_type flags)
 {
     if (IsLoaded(path))
     {
         return false;
     }
 
-    const auto fullPath = isExternal ? path : m_assetDirectory + path;
-    m_audioClips.emplace(path, asset::ImportAudioClip(fullPath));
+    if (flags & AssetFlags::AudioClipStream)
+    {
+        m_audioClips.emplace(path, Stream(path, isExternal));
+    }
+    else
+    {
+        m_audioClips.emplace(path, AudioClipStorage{.clip = Import(path, isExternal)});
+    }
+
     return true;
 }
 
-bool AudioClipAssetManager::Load(std::span<const std::string> paths, bool isExternal, asset_flags_type)
+bool AudioClipAssetManager::Load(std::span<const std::string> paths, bool isExternal, asset_flags_type flags)
 {
-    bool anyLoaded = false;
+    if (flags & AssetFlags::AudioClipStream)
+    {
+        auto anyLoaded = false;
+        for (const auto& path : paths)
+        {
+            anyLoaded |= Load(path, isExternal, flags);
+        }
 
-    for(const auto& path : paths)
+        return anyLoaded;
+    }
+
+    auto toLoad = std::vector<std::string>{};
+    auto imported = std::vector<AudioClip>{};
+    for (const auto& path : paths)
     {
         if (IsLoaded(path))
         {
             continue;
         }
 
-        if (Load(path, isExternal))
+        toLoad.push_back(path);
+        imported.push_back(Import(path, isExternal));
+    }
+
+    return Commit(toLoad, imported, flags);
+}
+
+auto AudioClipAssetManager::Import(const std::string& path, bool isExternal) const -> AudioClip
+{
+    const auto fullPath = isExternal ? path : m_assetDirectory + path;
+    return asset::ImportAudioClip(fullPath);
+}
+
+auto AudioClipAssetManager::Stream(const std::string& path, bool isExternal) const -> AudioClipStorage
+{
+    const auto fullPath = isExternal ? path : m_assetDirectory + path;
+    if (asset::ImportNcaHeader(fullPath).version < version5)
+    {
+        // Older files store double samples which must be converted, so they can't be read in place.
+        return AudioClipStorage{.clip = asset::ImportAudioClip(fullPath)};
+    }
+
+    const auto layout = asset::ImportAudioClipLayout(fullPath);
+    NC_ASSERT(layout.leftChannelOffset % GetSampleSize(layout.format) == 0 &&
+              layout.rightChannelOffset % GetSampleSize(layout.format) == 0,
+              "Audio clip samples are not aligned");
+
+    return AudioClipStorage{
+        .clip = AudioClip{layout.samplesPerChannel, layout.format, {}, {}},
+        .mapping = MappedFile{fullPath},
+        .leftChannelOffset = layout.leftChannelOffset,
+        .rightChannelOffset = layout.rightChannelOffset
+    };
+}
+
+bool AudioClipAssetManager::Commit(std::span<const std::string> paths, std::span<AudioClip> imported, asset_flags_type)
+{
+    NC_ASSERT(paths.size() == imported.size(), "Mismatched asset paths and data");
+    auto anyLoaded = false;
+    for (auto [path, data] : std::views::zip(paths, imported))
+    {
+        if (IsLoaded(path))
         {
-            anyLoaded = true;
+            continue;
         }
+
+        m_audioClips.emplace(path, AudioClipStorage{.clip = std::move(data)});
+        anyLoaded = true;
     }
 
     return anyLoaded;
@@ -58,13 +122,28 @@ auto AudioClipAssetManager::Acquire(const std::string& path, asset_flags_type) c
     const auto hash = m_audioClips.hash(path);
     const auto index = m_audioClips.index(hash);
     NC_ASSERT(index != m_audioClips.NullIndex, fmt::format("Asset is not loaded: '{}'", path));
-    const auto& clip = m_audioClips.at(index);
+    const auto& storage = m_audioClips.at(index);
+    const auto& clip = storage.clip;
+    if (storage.mapping.IsOpen())
+    {
+        const auto channelSize = clip.samplesPerChannel * GetSampleSize(clip.format);
+        return AudioClipView
+        {
+            .id = hash,
+            .leftChannel = storage.mapping.Bytes(storage.leftChannelOffset, channelSize),
+            .rightChannel = storage.mapping.Bytes(storage.rightChannelOffset, channelSize),
+            .samplesPerChannel = clip.samplesPerChannel,
+            .format = clip.format
+        };
+    }
+
     return AudioClipView
     {
         .id = hash,
-        .leftChannel = std::span<const double>{clip.leftChannel},
-        .rightChannel = std::span<const double>{clip.rightChannel},
-        .samplesPerChannel = clip.samplesPerChannel
+        .leftChannel = std::span<const std::byte>{clip.leftChannel},
+        .rightChannel = std::span<const std::byte>{clip.rightChannel},
+        .samplesPerChannel = clip.samplesPerChannel,
+        .format = clip.format
     };
 }
 
@@ -1,9 +1,10 @@
 #pragma once
 
+#include "MappedFile.h"
 #include "asset/AssetService.h"
 #include "utility/StringMap.h"
 
-#include "ncasset/AssetsFwd.h"
+#include "ncasset/Assets.h"
 
 #include <string>
 #include <unordered_map>
@@ -17,6 +18,8 @@ class AudioClipAssetManager : public IAssetService<AudioClipView, std::string>
 
         bool Load(const std::string& path, bool isExternal, asset_flags_type flags = AssetFlags::None) override;
         bool Load(std::span<const std::string> paths, bool isExternal, asset_flags_type flags = AssetFlags::None) override;
+        auto Import(const std::string& path, bool isExternal) const -> AudioClip;
+        bool Commit(std::span<const std::string> paths, std::span<AudioClip> imported, asset_flags_type flags = AssetFlags::None);
         bool Unload(const std::string& path, asset_flags_type flags = AssetFlags::None) override;
         void UnloadAll(asset_flags_type flags = AssetFlags::None) override;
         auto Acquire(const std::string& path, asset_flags_type flags = AssetFlags::None) const -> AudioClipView override;
@@ -26,8 +29,19 @@ class AudioClipAssetManager : public IAssetService<AudioClipView, std::string>
         auto GetAssetType() const noexcept -> AssetType override { return AssetType::AudioClip; }
 
     private:
-        StringMap<AudioClip> m_audioClips;
+        // Resident clips own their samples. Streamed clips leave the channels empty and read from the mapping.
+        struct AudioClipStorage
+        {
+            AudioClip clip;
+            MappedFile mapping;
+            size_t leftChannelOffset = 0ull;
+            size_t rightChannelOffset = 0ull;
+        };
+
+        StringMap<AudioClipStorage> m_audioClips;
         std::string m_assetDirectory;
+
+        auto Stream(const std::string& path, bool isExternal) const -> AudioClipStorage;
 };
 } // namespace nc::asset
 
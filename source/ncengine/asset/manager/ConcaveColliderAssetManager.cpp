@@ -3,6 +3,8 @@
 
 #include "ncasset/Import.h"
 
+#include <ranges>
+
 namespace nc::asset
 {
 ConcaveColliderAssetManager::ConcaveColliderAssetManager(const std::string& concaveColliderAssetDirectory)
@@ -18,26 +20,47 @@ bool ConcaveColliderAssetManager::Load(const std::string& path, bool isExternal,
         return false;
     }
 
-    const auto fullPath = isExternal ? path : m_assetDirectory + path;
-    m_concaveColliders.emplace(path, asset::ImportConcaveCollider(fullPath));
+    m_concaveColliders.emplace(path, Import(path, isExternal));
     return true;
 }
 
-bool ConcaveColliderAssetManager::Load(std::span<const std::string> paths, bool isExternal, asset_flags_type)
+bool ConcaveColliderAssetManager::Load(std::span<const std::string> paths, bool isExternal, asset_flags_type flags)
 {
-    auto anyLoaded = false;
-
-    for(const auto& path : paths)
+    auto toLoad = std::vector<std::string>{};
+    auto imported = std::vector<ConcaveCollider>{};
+    for (const auto& path : paths)
     {
         if (IsLoaded(path))
         {
             continue;
         }
 
-        if (Load(path, isExternal))
+        toLoad.push_back(path);
+        imported.push_back(Import(path, isExternal));
+    }
+
+    return Commit(toLoad, imported, flags);
+}
+
+auto ConcaveColliderAssetManager::Import(const std::string& path, bool isExternal) const -> ConcaveCollider
+{
+    const auto fullPath = isExternal ? path : m_assetDirectory + path;
+    return asset::ImportConcaveCollider(fullPath);
+}
+
+bool ConcaveColliderAssetManager::Commit(std::span<const std::string> paths, std::span<ConcaveCollider> imported, asset_flags_type)
+{
+    NC_ASSERT(paths.size() == imported.size(), "Mismatched asset paths and data");
+    auto anyLoaded = false;
+    for (auto [path, data] : std::views::zip(paths, imported))
+    {
+        if (IsLoaded(path))
         {
-            anyLoaded = true;
+            continue;
         }
+
+        m_concaveColliders.emplace(path, std::move(data));
+        anyLoaded = true;
     }
 
     return anyLoaded;
@@ -16,6 +16,8 @@ class ConcaveColliderAssetManager : public IAssetService<ConcaveColliderView, st
 
         bool Load(const std::string& path, bool isExternal, asset_flags_type flags = AssetFlags::None) override;
         bool Load(std::span<const std::string> paths, bool isExternal, asset_flags_type flags = AssetFlags::None) override;
+        auto Import(const std::string& path, bool isExternal) const -> ConcaveCollider;
+        bool Commit(std::span<const std::string> paths, std::span<ConcaveCollider> imported, asset_flags_type flags = AssetFlags::None);
         bool Unload(const std::string& path, asset_flags_type flags = AssetFlags::None) override;
         void UnloadAll(asset_flags_type flags = AssetFlags::None) override;
         auto Acquire(const std::string& path, asset_flags_type flags = AssetFlags::None) const -> ConcaveColliderView override;
@@ -8,6 +8,7 @@
 #include <cassert>
 #include <fstream>
 #include <filesystem>
+#include <ranges>
 
 namespace nc::asset
 {
@@ -26,13 +27,7 @@ bool CubeMapAssetManager::Load(const std::string& path, bool isExternal, asset_f
         return false;
     }
 
-    if (!HasValidAssetExtension(path))
-    {
-        throw nc::NcError("Invalid extension: " + path);
-    }
-
-    const auto fullPath = isExternal ? path : m_assetDirectory + path;
-    const auto data = CubeMapWithId{ImportCubeMap(fullPath), m_cubeMapIds.hash(path)};
+    const auto data = CubeMapWithId{Import(path, isExternal), m_cubeMapIds.hash(path)};
     m_cubeMapIds.emplace(path);
     m_onUpdate.Emit(CubeMapUpdateEventData{
         UpdateAction::Load,
@@ -42,16 +37,15 @@ bool CubeMapAssetManager::Load(const std::string& path, bool isExternal, asset_f
     return true;
 }
 
-bool CubeMapAssetManager::Load(std::span<const std::string> paths, bool isExternal, asset_flags_type)
+bool CubeMapAssetManager::Load(std::span<const std::string> paths, bool isExternal, asset_flags_type flags)
 {
     if (paths.size() + m_cubeMapIds.size() >= m_maxCubeMapsCount)
     {
         throw NcError("Cannot exceed max texture count.");
     }
 
-    auto loadedCubeMaps = std::vector<asset::CubeMapWithId>{};
-    loadedCubeMaps.reserve(paths.size());
-
+    auto toLoad = std::vector<std::string>{};
+    auto imported = std::vector<CubeMap>{};
     for (const auto& path : paths)
     {
         if (IsLoaded(path))
@@ -59,13 +53,42 @@ bool CubeMapAssetManager::Load(std::span<const std::string> paths, bool isExtern
             continue;
         }
 
-        if (!HasValidAssetExtension(path))
+        toLoad.push_back(path);
+        imported.push_back(Import(path, isExternal));
+    }
+
+    return Commit(toLoad, imported, flags);
+}
+
+auto CubeMapAssetManager::Import(const std::string& path, bool isExternal) const -> CubeMap
+{
+    if (!HasValidAssetExtension(path))
+    {
+        throw nc::NcError("Invalid extension: " + path);
+    }
+
+    const auto fullPath = isExternal ? path : m_assetDirectory + path;
+    return asset::ImportCubeMap(fullPath);
+}
+
+bool CubeMapAssetManager::Commit(std::span<const std::string> paths, std::span<CubeMap> imported, asset_flags_type)
+{
+    NC_ASSERT(paths.size() == imported.size(), "Mismatched asset paths and data");
+    if (paths.size() + m_cubeMapIds.size() >= m_maxCubeMapsCount)
+    {
+        throw NcError("Cannot exceed max texture count.");
+    }
+
+    auto loadedCubeMaps = std::vector<asset::CubeMapWithId>{};
+    loadedCubeMaps.reserve(paths.size());
+    for (auto [path, cubeMap] : std::views::zip(paths, imported))
+    {
+        if (IsLoaded(path))
         {
-            throw nc::NcError("Invalid extension: " + path);
+            continue;
         }
 
-        const auto fullPath = isExternal ? path : m_assetDirectory + path;
-        loadedCubeMaps.push_back(asset::CubeMapWithId{asset::ImportCubeMap(fullPath), m_cubeMapIds.hash(path)});
+        loadedCubeMaps.push_back(asset::CubeMapWithId{std::move(cubeMap), m_cubeMapIds.hash(path)});
         m_cubeMapIds.emplace(path);
     }
 
@@ -4,6 +4,8 @@
 #include "utility/StringMap.h"
 #include "ncengine/utility/Signal.h"
 
+#include "ncasset/AssetsFwd.h"
+
 #include <string>
 
 namespace nc::asset
@@ -17,6 +19,8 @@ class CubeMapAssetManager : public IAssetService<CubeMapView, std::string>
 
         bool Load(const std::string& path, bool isExternal, asset_flags_type flags = AssetFlags::None) override;
         bool Load(std::span<const std::string> paths, bool isExternal, asset_flags_type flags = AssetFlags::None) override;
+        auto Import(const std::string& path, bool isExternal) const -> CubeMap;
+        bool Commit(std::span<const std::string> paths, std::span<CubeMap> imported, asset_flags_type flags = AssetFlags::None);
         bool Unload(const std::string& path, asset_flags_type flags = AssetFlags::None) override;
         void UnloadAll(asset_flags_type flags = AssetFlags::None) override;
         auto Acquire(const std::string& path, asset_flags_type flags = AssetFlags::None) const -> CubeMapView override;
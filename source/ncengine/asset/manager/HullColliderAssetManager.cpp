@@ -3,6 +3,8 @@
 
 #include "ncasset/Import.h"
 
+#include <ranges>
+
 namespace nc::asset
 {
 HullColliderAssetManager::HullColliderAssetManager(const std::string& assetDirectory)
@@ -18,26 +20,47 @@ bool HullColliderAssetManager::Load(const std::string& path, bool isExternal, as
         return false;
     }
 
-    const auto fullPath = isExternal ? path : m_assetDirectory + path;
-    m_hullColliders.emplace(path, ImportHullCollider(fullPath));
+    m_hullColliders.emplace(path, Import(path, isExternal));
     return true;
 }
 
-bool HullColliderAssetManager::Load(std::span<const std::string> paths, bool isExternal, asset_flags_type)
+bool HullColliderAssetManager::Load(std::span<const std::string> paths, bool isExternal, asset_flags_type flags)
 {
-    bool anyLoaded = false;
-
-    for(const auto& path : paths)
+    auto toLoad = std::vector<std::string>{};
+    auto imported = std::vector<HullCollider>{};
+    for (const auto& path : paths)
     {
         if (IsLoaded(path))
         {
             continue;
         }
 
-        if (Load(path, isExternal))
+        toLoad.push_back(path);
+        imported.push_back(Import(path, isExternal));
+    }
+
+    return Commit(toLoad, imported, flags);
+}
+
+auto HullColliderAssetManager::Import(const std::string& path, bool isExternal) const -> HullCollider
+{
+    const auto fullPath = isExternal ? path : m_assetDirectory + path;
+    return ImportHullCollider(fullPath);
+}
+
+bool HullColliderAssetManager::Commit(std::span<const std::string> paths, std::span<HullCollider> imported, asset_flags_type)
+{
+    NC_ASSERT(paths.size() == imported.size(), "Mismatched asset paths and data");
+    auto anyLoaded = false;
+    for (auto [path, data] : std::views::zip(paths, imported))
+    {
+        if (IsLoaded(path))
         {
-            anyLoaded = true;
+            continue;
         }
+
+        m_hullColliders.emplace(path, std::move(data));
+        anyLoaded = true;
     }
 
     return anyLoaded;
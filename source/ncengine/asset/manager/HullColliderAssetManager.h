@@ -16,6 +16,8 @@ class HullColliderAssetManager : public IAssetService<ConvexHullView, std::strin
 
         bool Load(const std::string& path, bool isExternal, asset_flags_type flags = AssetFlags::None) override;
         bool Load(std::span<const std::string> paths, bool isExternal, asset_flags_type flags = AssetFlags::None) override;
+        auto Import(const std::string& path, bool isExternal) const -> HullCollider;
+        bool Commit(std::span<const std::string> paths, std::span<HullCollider> imported, asset_flags_type flags = AssetFlags::None);
         bool Unload(const std::string& path, asset_flags_type flags = AssetFlags::None) override;
         void UnloadAll(asset_flags_type flags = AssetFlags::None) override;
         auto Acquire(const std::string& path, asset_flags_type flags = AssetFlags::None) const -> ConvexHullView override;
@@ -0,0 +1,144 @@
+#include "MappedFile.h"
+
+#include "ncutility/NcError.h"
+#include "ncutility/platform/Platform.h"
+
+#include <utility>
+
+#if defined(NC_PLATFORM_WINDOWS)
+    // NcWin32.h filters out the kernel and memory manager APIs needed here
+    #ifndef WIN32_LEAN_AND_MEAN
+    #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+    #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace nc::asset
+{
+#if defined(NC_PLATFORM_WINDOWS)
+MappedFile::MappedFile(const std::filesystem::path& path)
+{
+    auto file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        throw NcError("Could not open file for mapping: ", path.string());
+    }
+
+    auto size = LARGE_INTEGER{};
+    if (!::GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        ::CloseHandle(file);
+        throw NcError("Could not map empty or unreadable file: ", path.string());
+    }
+
+    // The section keeps the file open, so the file handle isn't needed after this.
+    auto mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    ::CloseHandle(file);
+    if (!mapping)
+    {
+        throw NcError("Could not create file mapping: ", path.string());
+    }
+
+    auto view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view)
+    {
+        ::CloseHandle(mapping);
+        throw NcError("Could not map view of file: ", path.string());
+    }
+
+    m_data = static_cast<const std::byte*>(view);
+    m_size = static_cast<size_t>(size.QuadPart);
+    m_mapping = mapping;
+}
+
+void MappedFile::Close() noexcept
+{
+    if (m_data)
+    {
+        ::UnmapViewOfFile(m_data);
+        ::CloseHandle(m_mapping);
+    }
+}
+#else
+MappedFile::MappedFile(const std::filesystem::path& path)
+{
+    const auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1)
+    {
+        throw NcError("Could not open file for mapping: ", path.string());
+    }
+
+    struct stat info{};
+    if (::fstat(fd, &info) == -1 || info.st_size == 0)
+    {
+        ::close(fd);
+        throw NcError("Could not map empty or unreadable file: ", path.string());
+    }
+
+    // The mapping holds its own reference to the file, so the descriptor isn't needed after this.
+    const auto size = static_cast<size_t>(info.st_size);
+    auto view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (view == MAP_FAILED)
+    {
+        throw NcError("Could not map file: ", path.string());
+    }
+
+    // Clips are read front to back, so ask for aggressive read-ahead.
+    ::madvise(view, size, MADV_SEQUENTIAL);
+    m_data = static_cast<const std::byte*>(view);
+    m_size = size;
+}
+
+void MappedFile::Close() noexcept
+{
+    if (m_data)
+    {
+        ::munmap(const_cast<std::byte*>(m_data), m_size);
+    }
+}
+#endif
+
+MappedFile::~MappedFile() noexcept
+{
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_data{std::exchange(other.m_data, nullptr)},
+      m_size{std::exchange(other.m_size, 0ull)},
+      m_mapping{std::exchange(other.m_mapping, nullptr)}
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0ull);
+        m_mapping = std::exchange(other.m_mapping, nullptr);
+    }
+
+    return *this;
+}
+
+auto MappedFile::Bytes(size_t offset, size_t count) const -> std::span<const std::byte>
+{
+    if (offset > m_size || count > m_size - offset)
+    {
+        throw NcError("MappedFile range out of bounds");
+    }
+
+    return std::span<const std::byte>{m_data + offset, count};
+}
+} // namespace nc::asset
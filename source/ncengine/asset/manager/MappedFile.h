@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace nc::asset
+{
+/**
+ * @brief Read-only memory mapping of a file.
+ *
+ * Pages are faulted in by the OS as they are first touched, so only the portions of the file actually read
+ * become resident. The mapping is released on destruction; spans into it must not outlive the MappedFile.
+ */
+class MappedFile
+{
+    public:
+        MappedFile() = default;
+        explicit MappedFile(const std::filesystem::path& path);
+        ~MappedFile() noexcept;
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /** @brief Get a view of count bytes beginning at offset. */
+        auto Bytes(size_t offset, size_t count) const -> std::span<const std::byte>;
+
+        auto IsOpen() const noexcept -> bool { return m_data != nullptr; }
+        auto Size() const noexcept -> size_t { return m_size; }
+
+    private:
+        const std::byte* m_data = nullptr;
+        size_t m_size = 0ull;
+        void* m_mapping = nullptr; // section handle, only used on Windows
+
+        void Close() noexcept;
+};
+} // namespace nc::asset
@@ -4,14 +4,46 @@
 
 #include "ncasset/Import.h"
 
+#include <algorithm>
 #include <cassert>
 #include <fstream>
+#include <ranges>
+
+namespace
+{
+/** Suballocate count elements from an arena, doubling its capacity when no free block fits. */
+template<class T>
+auto Suballocate(nc::asset::RangeAllocator& allocator, std::vector<T>& arena, uint32_t count, bool& reallocated) -> uint32_t
+{
+    if (auto offset = allocator.Allocate(count))
+    {
+        return offset.value();
+    }
+
+    const auto newCapacity = std::max(allocator.RequiredCapacity(count), allocator.Capacity() * 2u);
+    allocator.Grow(newCapacity);
+    arena.resize(newCapacity);
+    reallocated = true;
+    return allocator.Allocate(count).value();
+}
+
+template<class T>
+void CopyRange(std::span<const T> source, std::vector<T>& destination, uint32_t offset)
+{
+    std::ranges::copy(source, destination.begin() + offset);
+}
+} // anonymous namespace
 
 namespace nc::asset
 {
 MeshAssetManager::MeshAssetManager(const std::string& assetDirectory)
     : m_vertexData{},
       m_indexData{},
+      m_vertexAllocator{},
+      m_indexAllocator{},
+      m_changedVertices{},
+      m_changedIndices{},
+      m_reallocate{false},
       m_accessors{},
       m_assetDirectory{assetDirectory},
       m_onBoneUpdate{},
@@ -19,24 +51,46 @@ MeshAssetManager::MeshAssetManager(const std::string& assetDirectory)
 {
 }
 
-auto MeshAssetManager::ImportMesh(const std::string& path, bool isExternal) -> asset::Mesh
+void MeshAssetManager::CommitMesh(const std::string& path, const asset::Mesh& mesh)
 {
-    const auto fullPath = isExternal ? path : m_assetDirectory + path;
-    const auto mesh = asset::ImportMesh(fullPath);
+    const auto vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+    const auto indexCount = static_cast<uint32_t>(mesh.indices.size());
+    const auto firstVertex = Suballocate(m_vertexAllocator, m_vertexData, vertexCount, m_reallocate);
+    const auto firstIndex = Suballocate(m_indexAllocator, m_indexData, indexCount, m_reallocate);
 
     auto meshView = MeshView{
         .id = m_accessors.hash(path),
-        .firstVertex = static_cast<uint32_t>(m_vertexData.size()),
-        .vertexCount = static_cast<uint32_t>(mesh.vertices.size()),
-        .firstIndex = static_cast<uint32_t>(m_indexData.size()),
-        .indexCount = static_cast<uint32_t>(mesh.indices.size()),
+        .firstVertex = firstVertex,
+        .vertexCount = vertexCount,
+        .firstIndex = firstIndex,
+        .indexCount = indexCount,
         .maxExtent = mesh.maxExtent
     };
 
-    m_vertexData.insert(m_vertexData.end(), mesh.vertices.begin(), mesh.vertices.end());
-    m_indexData.insert(m_indexData.end(), mesh.indices.begin(), mesh.indices.end());
+    CopyRange<asset::MeshVertex>(mesh.vertices, m_vertexData, firstVertex);
+    CopyRange<uint32_t>(mesh.indices, m_indexData, firstIndex);
+    m_changedVertices.push_back(MeshArenaRange{firstVertex, vertexCount});
+    m_changedIndices.push_back(MeshArenaRange{firstIndex, indexCount});
     m_accessors.emplace(path, meshView);
-    return mesh;
+}
+
+void MeshAssetManager::EmitMeshUpdate()
+{
+    /** Buffers can't be empty, so we only emit once the arena holds data. */
+    if (!m_vertexData.empty() && (m_reallocate || !m_changedVertices.empty() || !m_changedIndices.empty()))
+    {
+        m_onMeshUpdate.Emit(MeshUpdateEventData{
+            m_vertexData,
+            m_indexData,
+            m_changedVertices,
+            m_changedIndices,
+            m_reallocate
+        });
+    }
+
+    m_changedVertices.clear();
+    m_changedIndices.clear();
+    m_reallocate = false;
 }
 
 bool MeshAssetManager::Load(const std::string& path, bool isExternal, asset_flags_type)
@@ -46,7 +100,8 @@ bool MeshAssetManager::Load(const std::string& path, bool isExternal, asset_flag
         return false;
     }
 
-    auto mesh = ImportMesh(path, isExternal);
+    auto mesh = Import(path, isExternal);
+    CommitMesh(path, mesh);
     if (mesh.bonesData.has_value() && mesh.bonesData.value().vertexSpaceToBoneSpace.size() > 0)
     {
         auto& bones = mesh.bonesData.value();
@@ -57,26 +112,51 @@ bool MeshAssetManager::Load(const std::string& path, bool isExternal, asset_flag
         });
     }
 
-    m_onMeshUpdate.Emit(MeshUpdateEventData{m_vertexData, m_indexData});
+    EmitMeshUpdate();
     return true;
 }
 
-bool MeshAssetManager::Load(std::span<const std::string> paths, bool isExternal, asset_flags_type)
+bool MeshAssetManager::Load(std::span<const std::string> paths, bool isExternal, asset_flags_type flags)
+{
+    auto toLoad = std::vector<std::string>{};
+    auto imported = std::vector<Mesh>{};
+    for (const auto& path : paths)
+    {
+        if (IsLoaded(path))
+        {
+            continue;
+        }
+
+        toLoad.push_back(path);
+        imported.push_back(Import(path, isExternal));
+    }
+
+    return Commit(toLoad, imported, flags);
+}
+
+auto MeshAssetManager::Import(const std::string& path, bool isExternal) const -> Mesh
+{
+    const auto fullPath = isExternal ? path : m_assetDirectory + path;
+    return asset::ImportMesh(fullPath);
+}
+
+bool MeshAssetManager::Commit(std::span<const std::string> paths, std::span<Mesh> imported, asset_flags_type)
 {
+    NC_ASSERT(paths.size() == imported.size(), "Mismatched asset paths and data");
     auto idsToLoad = std::vector<std::string>{};
     auto bones = std::vector<BonesData>{};
     idsToLoad.reserve(paths.size());
     bool anyLoaded = false;
     bool anyBonesLoaded = false;
 
-    for (const auto& path : paths)
+    for (auto [path, mesh] : std::views::zip(paths, imported))
     {
         if (IsLoaded(path))
         {
             continue;
         }
 
-        auto mesh = ImportMesh(path, isExternal);
+        CommitMesh(path, mesh);
         if (mesh.bonesData.has_value() && mesh.bonesData.value().vertexSpaceToBoneSpace.size() > 0)
         {
             bones.push_back(std::move(mesh.bonesData.value()));
@@ -96,11 +176,11 @@ bool MeshAssetManager::Load(std::span<const std::string> paths, bool isExternal,
         });
     }
 
-    m_onMeshUpdate.Emit(MeshUpdateEventData{m_vertexData, m_indexData});
+    EmitMeshUpdate();
     return anyLoaded;
 }
 
-bool MeshAssetManager::Unload(const std::string& path, asset_flags_type)
+bool MeshAssetManager::Unload(const std::string& path, asset_flags_type flags)
 {
     const auto index = m_accessors.index(path);
     if (index == StringTable::NullIndex)
@@ -109,36 +189,17 @@ bool MeshAssetManager::Unload(const std::string& path, asset_flags_type)
     const auto [id, firstVertex, vertexCount, firstIndex, indexCount, unused] = m_accessors.at(index);
     m_accessors.erase(path);
 
-    auto indBeg = m_indexData.begin() + firstIndex;
-    auto indEnd = indBeg + indexCount;
-    assert(indEnd <= m_indexData.end());
-    m_indexData.erase(indBeg, indEnd);
+    /** Freed ranges are never referenced, so other meshes stay put and nothing needs uploading. */
+    assert(firstVertex + vertexCount <= m_vertexData.size());
+    assert(firstIndex + indexCount <= m_indexData.size());
+    m_vertexAllocator.Free(firstVertex, vertexCount);
+    m_indexAllocator.Free(firstIndex, indexCount);
 
-    auto vertBeg = m_vertexData.begin() + firstVertex;
-    auto vertEnd = vertBeg + vertexCount;
-    assert(vertEnd <= m_vertexData.end());
-    m_vertexData.erase(vertBeg, vertEnd);
-
-    for(auto& accessor : m_accessors)
+    if (flags & AssetFlags::MeshDefragment)
     {
-        if(accessor.firstVertex > firstVertex)
-            accessor.firstVertex -= vertexCount;
-
-        if(accessor.firstIndex > firstIndex)
-            accessor.firstIndex -= indexCount;
+        Defragment();
     }
 
-    if(m_vertexData.size() != 0)
-    {
-        m_onMeshUpdate.Emit
-        (
-            MeshUpdateEventData
-            {
-                m_vertexData,
-                m_indexData
-            }
-        );
-    }
     return true;
 }
 
@@ -148,6 +209,40 @@ void MeshAssetManager::UnloadAll(asset_flags_type)
     m_accessors.clear();
     m_vertexData.clear();
     m_indexData.clear();
+    m_vertexAllocator.Reset(0u, 0u);
+    m_indexAllocator.Reset(0u, 0u);
+    m_changedVertices.clear();
+    m_changedIndices.clear();
+    m_reallocate = false;
+}
+
+void MeshAssetManager::Defragment()
+{
+    auto vertices = std::vector<asset::MeshVertex>{};
+    auto indices = std::vector<uint32_t>{};
+    vertices.reserve(m_vertexData.size() - m_vertexAllocator.FreeCount());
+    indices.reserve(m_indexData.size() - m_indexAllocator.FreeCount());
+
+    for (auto& accessor : m_accessors)
+    {
+        const auto vertBeg = m_vertexData.cbegin() + accessor.firstVertex;
+        const auto indBeg = m_indexData.cbegin() + accessor.firstIndex;
+        accessor.firstVertex = static_cast<uint32_t>(vertices.size());
+        accessor.firstIndex = static_cast<uint32_t>(indices.size());
+        vertices.insert(vertices.end(), vertBeg, vertBeg + accessor.vertexCount);
+        indices.insert(indices.end(), indBeg, indBeg + accessor.indexCount);
+    }
+
+    m_vertexData = std::move(vertices);
+    m_indexData = std::move(indices);
+    const auto vertexCount = static_cast<uint32_t>(m_vertexData.size());
+    const auto indexCount = static_cast<uint32_t>(m_indexData.size());
+    m_vertexAllocator.Reset(vertexCount, vertexCount);
+    m_indexAllocator.Reset(indexCount, indexCount);
+    m_changedVertices.clear();
+    m_changedIndices.clear();
+    m_reallocate = true;
+    EmitMeshUpdate();
 }
 
 auto MeshAssetManager::Acquire(const std::string& path, asset_flags_type) const -> MeshView
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "asset/AssetService.h"
+#include "RangeAllocator.h"
 #include "utility/StringMap.h"
 #include "ncengine/utility/Signal.h"
 
@@ -18,6 +19,8 @@ class MeshAssetManager : public IAssetService<MeshView, std::string>
 
         bool Load(const std::string& path, bool isExternal, asset_flags_type flags = AssetFlags::None) override;
         bool Load(std::span<const std::string> paths, bool isExternal, asset_flags_type flags = AssetFlags::None) override;
+        auto Import(const std::string& path, bool isExternal) const -> Mesh;
+        bool Commit(std::span<const std::string> paths, std::span<Mesh> imported, asset_flags_type flags = AssetFlags::None);
         bool Unload(const std::string& path, asset_flags_type flags = AssetFlags::None) override;
         void UnloadAll(asset_flags_type flags = AssetFlags::None) override;
         auto Acquire(const std::string& path, asset_flags_type flags = AssetFlags::None) const -> MeshView override;
@@ -28,14 +31,23 @@ class MeshAssetManager : public IAssetService<MeshView, std::string>
         auto OnBoneUpdate() -> Signal<const asset::BoneUpdateEventData&>&;
         auto OnMeshUpdate() -> Signal<const asset::MeshUpdateEventData&>&;
 
+        /** @brief Compact all loaded meshes to the front of the arena, invalidating existing MeshViews. */
+        void Defragment();
+
     private:
         std::vector<asset::MeshVertex> m_vertexData;
         std::vector<uint32_t> m_indexData;
+        RangeAllocator m_vertexAllocator;
+        RangeAllocator m_indexAllocator;
+        std::vector<MeshArenaRange> m_changedVertices;
+        std::vector<MeshArenaRange> m_changedIndices;
+        bool m_reallocate;
         StringMap<MeshView> m_accessors;
         std::string m_assetDirectory;
         Signal<const asset::BoneUpdateEventData&> m_onBoneUpdate;
         Signal<const asset::MeshUpdateEventData&> m_onMeshUpdate;
 
-        asset::Mesh ImportMesh(const std::string& path, bool isExternal);
+        void CommitMesh(const std::string& path, const asset::Mesh& mesh);
+        void EmitMeshUpdate();
 };
 } // namespace nc::asset
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "asset/AssetData.h"
+
+#include <algorithm>
+#include <cassert>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace nc::asset
+{
+/**
+ * @brief First-fit suballocator for element ranges within a growable arena.
+ *
+ * Free blocks are kept sorted by offset and adjacent blocks are coalesced on release, so
+ * allocation and release are linear in the number of free blocks rather than in the arena size.
+ */
+class RangeAllocator
+{
+    public:
+        /** @brief Allocate count contiguous elements, returning nullopt if no free block is large enough. */
+        auto Allocate(uint32_t count) -> std::optional<uint32_t>
+        {
+            if (count == 0)
+                return m_capacity;
+
+            auto pos = std::ranges::find_if(m_freeList, [count](const auto& block) { return block.count >= count; });
+            if (pos == m_freeList.end())
+                return std::nullopt;
+
+            const auto offset = pos->offset;
+            pos->offset += count;
+            pos->count -= count;
+            if (pos->count == 0)
+                m_freeList.erase(pos);
+
+            m_freeCount -= count;
+            return offset;
+        }
+
+        /** @brief Return a previously allocated range to the free list. */
+        void Free(uint32_t offset, uint32_t count)
+        {
+            if (count == 0)
+                return;
+
+            assert(offset + count <= m_capacity);
+            auto next = std::ranges::lower_bound(m_freeList, offset, {}, &MeshArenaRange::offset);
+            assert(next == m_freeList.end() || offset + count <= next->offset);
+            next = m_freeList.insert(next, MeshArenaRange{offset, count});
+            m_freeCount += count;
+
+            if (auto after = next + 1; after != m_freeList.end() && next->offset + next->count == after->offset)
+            {
+                next->count += after->count;
+                next = m_freeList.erase(after) - 1;
+            }
+
+            if (next != m_freeList.begin())
+            {
+                if (auto before = next - 1; before->offset + before->count == next->offset)
+                {
+                    before->count += next->count;
+                    m_freeList.erase(next);
+                }
+            }
+        }
+
+        /** @brief Extend the arena, making the new tail space available for allocation. */
+        void Grow(uint32_t newCapacity)
+        {
+            assert(newCapacity >= m_capacity);
+            const auto oldCapacity = m_capacity;
+            m_capacity = newCapacity;
+            Free(oldCapacity, newCapacity - oldCapacity);
+        }
+
+        /** @brief Get the capacity needed to guarantee a subsequent allocation of count elements succeeds. */
+        auto RequiredCapacity(uint32_t count) const noexcept -> uint32_t
+        {
+            const auto tailFree = !m_freeList.empty() && m_freeList.back().offset + m_freeList.back().count == m_capacity
+                ? m_freeList.back().count
+                : 0u;
+
+            return m_capacity + count - std::min(count, tailFree);
+        }
+
+        /** @brief Reset to a single allocated block of size used followed by free space up to capacity. */
+        void Reset(uint32_t used, uint32_t capacity)
+        {
+            assert(used <= capacity);
+            m_freeList.clear();
+            m_capacity = used;
+            m_freeCount = 0u;
+            Grow(capacity);
+        }
+
+        auto Capacity() const noexcept -> uint32_t { return m_capacity; }
+        auto FreeCount() const noexcept -> uint32_t { return m_freeCount; }
+        auto FreeBlocks() const noexcept -> std::span<const MeshArenaRange> { return m_freeList; }
+
+    private:
+        std::vector<MeshArenaRange> m_freeList;
+        uint32_t m_capacity = 0u;
+        uint32_t m_freeCount = 0u;
+};
+} // namespace nc::asset
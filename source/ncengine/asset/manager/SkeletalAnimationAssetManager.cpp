@@ -5,6 +5,7 @@
 #include "ncasset/Import.h"
 
 #include <algorithm>
+#include <ranges>
 
 namespace nc::asset
 {
@@ -28,9 +29,8 @@ bool SkeletalAnimationAssetManager::Load(const std::string& path, bool isExterna
         return false;
     }
 
+    auto animation = Import(path, isExternal);
     m_table.emplace(path);
-    const auto fullPath = isExternal ? path : m_assetDirectory + path;
-    auto animation = ImportSkeletalAnimation(fullPath);
     m_onUpdate.Emit(SkeletalAnimationUpdateEventData{
         std::span<const std::string>{m_table.keys().begin() + previousTableSize, m_table.keys().end()},
         std::span<const SkeletalAnimation>{&animation, 1},
@@ -39,8 +39,38 @@ bool SkeletalAnimationAssetManager::Load(const std::string& path, bool isExterna
     return true;
 }
 
-bool SkeletalAnimationAssetManager::Load(std::span<const std::string> paths, bool isExternal, asset_flags_type)
+bool SkeletalAnimationAssetManager::Load(std::span<const std::string> paths, bool isExternal, asset_flags_type flags)
+{
+    if (m_table.size() + paths.size() >= m_maxSkeletalAnimationCount)
+    {
+        throw NcError("Cannot exceed max skeletal animations count.");
+    }
+
+    auto toLoad = std::vector<std::string>{};
+    auto imported = std::vector<SkeletalAnimation>{};
+    for (const auto& path : paths)
+    {
+        if (IsLoaded(path))
+        {
+            continue;
+        }
+
+        toLoad.push_back(path);
+        imported.push_back(Import(path, isExternal));
+    }
+
+    return Commit(toLoad, imported, flags);
+}
+
+auto SkeletalAnimationAssetManager::Import(const std::string& path, bool isExternal) const -> SkeletalAnimation
+{
+    const auto fullPath = isExternal ? path : m_assetDirectory + path;
+    return ImportSkeletalAnimation(fullPath);
+}
+
+bool SkeletalAnimationAssetManager::Commit(std::span<const std::string> paths, std::span<SkeletalAnimation> imported, asset_flags_type)
 {
+    NC_ASSERT(paths.size() == imported.size(), "Mismatched asset paths and data");
     auto previousTableSize = m_table.size();
     if (m_table.size() + paths.size() >= m_maxSkeletalAnimationCount)
     {
@@ -48,7 +78,7 @@ bool SkeletalAnimationAssetManager::Load(std::span<const std::string> paths, boo
     }
 
     auto animations = std::vector<SkeletalAnimation>{};
-    for(const auto& path : paths)
+    for (auto [path, animation] : std::views::zip(paths, imported))
     {
         if (IsLoaded(path))
         {
@@ -56,8 +86,7 @@ bool SkeletalAnimationAssetManager::Load(std::span<const std::string> paths, boo
         }
 
         m_table.emplace(path);
-        const auto fullPath = isExternal ? path : m_assetDirectory + path;
-        animations.push_back(ImportSkeletalAnimation(fullPath));
+        animations.push_back(std::move(animation));
     }
 
     if (!animations.empty())
@@ -5,6 +5,8 @@
 
 #include "ncasset/Import.h"
 
+#include <ranges>
+
 namespace nc::asset
 {
 TextureAssetManager::TextureAssetManager(const std::string& texturesAssetDirectory, uint32_t maxTextures)
@@ -26,8 +28,7 @@ bool TextureAssetManager::Load(const std::string& path, bool isExternal, asset_f
         return false;
     }
 
-    const auto fullPath = isExternal ? path : m_assetDirectory + path;
-    auto texture = asset::TextureWithId{asset::ImportTexture(fullPath), m_table.hash(path), flags};
+    auto texture = asset::TextureWithId{Import(path, isExternal), m_table.hash(path), flags};
     m_table.emplace(path);
     m_onUpdate.Emit(asset::TextureUpdateEventData{
         asset::UpdateAction::Load,
@@ -44,10 +45,40 @@ bool TextureAssetManager::Load(std::span<const std::string> paths, bool isExtern
         throw NcError("Cannot exceed max texture count.");
     }
 
+    auto toLoad = std::vector<std::string>{};
+    auto imported = std::vector<Texture>{};
+    for (const auto& path : paths)
+    {
+        if (IsLoaded(path))
+        {
+            continue;
+        }
+
+        toLoad.push_back(path);
+        imported.push_back(Import(path, isExternal));
+    }
+
+    Commit(toLoad, imported, flags);
+    return true;
+}
+
+auto TextureAssetManager::Import(const std::string& path, bool isExternal) const -> Texture
+{
+    const auto fullPath = isExternal ? path : m_assetDirectory + path;
+    return ImportTexture(fullPath);
+}
+
+bool TextureAssetManager::Commit(std::span<const std::string> paths, std::span<Texture> imported, asset_flags_type flags)
+{
+    NC_ASSERT(paths.size() == imported.size(), "Mismatched asset paths and data");
+    if (m_table.size() + paths.size() >= m_maxTextureCount)
+    {
+        throw NcError("Cannot exceed max texture count.");
+    }
+
     auto textures = std::vector<TextureWithId>{};
     textures.reserve(paths.size());
-
-    for (const auto& path : paths)
+    for (auto [path, texture] : std::views::zip(paths, imported))
     {
         if (IsLoaded(path))
         {
@@ -55,18 +86,19 @@ bool TextureAssetManager::Load(std::span<const std::string> paths, bool isExtern
         }
 
         m_table.emplace(path);
-        const auto fullPath = isExternal ? path : m_assetDirectory + path;
-        textures.emplace_back(ImportTexture(fullPath), m_table.hash(path), flags);
+        textures.emplace_back(std::move(texture), m_table.hash(path), flags);
     }
 
-    if (!textures.empty())
+    if (textures.empty())
     {
-        m_onUpdate.Emit(TextureUpdateEventData{
-            UpdateAction::Load,
-            std::span<const TextureWithId>{textures}
-        });
+        return false;
     }
 
+    m_onUpdate.Emit(TextureUpdateEventData{
+        UpdateAction::Load,
+        std::span<const TextureWithId>{textures}
+    });
+
     return true;
 }
 
@@ -4,6 +4,8 @@
 #include "utility/StringMap.h"
 #include "ncengine/utility/Signal.h"
 
+#include "ncasset/AssetsFwd.h"
+
 #include <string>
 
 namespace nc::asset
@@ -18,6 +20,8 @@ class TextureAssetManager : public IAssetService<TextureView, std::string>
 
         bool Load(const std::string& path, bool isExternal, asset_flags_type flags = AssetFlags::None) override;
         bool Load(std::span<const std::string> paths, bool isExternal, asset_flags_type flags = AssetFlags::None) override;
+        auto Import(const std::string& path, bool isExternal) const -> Texture;
+        bool Commit(std::span<const std::string> paths, std::span<Texture> imported, asset_flags_type flags = AssetFlags::None);
         bool Unload(const std::string& path, asset_flags_type flags = AssetFlags::None) override;
         void UnloadAll(asset_flags_type flags = AssetFlags::None) override;
         auto Acquire(const std::string& path, asset_flags_type flags = AssetFlags::None) const -> TextureView override;
@@ -1,5 +1,6 @@
 #include "ncengine/audio/AudioSource.h"
 #include "ncengine/ecs/Registry.h"
+#include "MixKernel.h"
 
 namespace
 {
@@ -24,6 +25,17 @@ auto CalculateAttenuation(double innerRadius, double outerRadius, double squareD
     double distanceRatio = (distance - innerRadius) / (outerRadius - innerRadius);
     return nc::Clamp(1.0 - distanceRatio, 0.0, 1.0);
 }
+
+template<class Input, class Sample>
+void MixClipRun(Sample* out, const nc::asset::AudioClipView& clip, size_t first, size_t frames, const nc::audio::GainRamp& ramp, bool downmix) noexcept
+{
+    nc::audio::MixRun(out,
+                      reinterpret_cast<const Input*>(clip.leftChannel.data()) + first,
+                      reinterpret_cast<const Input*>(clip.rightChannel.data()) + first,
+                      frames,
+                      ramp,
+                      downmix);
+}
 } // anonymous namespace
 
 namespace nc::audio
@@ -94,14 +106,12 @@ void AudioSource::RemoveClip(uint32_t clipIndex)
     }
 }
 
-void AudioSource::WriteSpatialSamples(double* buffer, size_t frames, const Vector3& sourcePosition, const Vector3& listenerPosition, const Vector3& rightEar)
+auto AudioSource::ComputeGain(const Vector3& sourcePosition, const Vector3& listenerPosition, const Vector3& rightEar) const noexcept -> StereoGain
 {
     const auto squareDistance = SquareDistance(sourcePosition, listenerPosition);
     const auto squareOuterRadius = m_properties.outerRadius * m_properties.outerRadius;
-
-    /** @todo may want to 'advance' sound even if it can't be heard */
     if(squareDistance > squareOuterRadius)
-        return;
+        return StereoGain{};
 
     const auto sourceToListener = Normalize(listenerPosition - sourcePosition);
     const double dotRight = Dot(sourceToListener, rightEar);
@@ -110,45 +120,79 @@ void AudioSource::WriteSpatialSamples(double* buffer, size_t frames, const Vecto
     const double leftPresence = dotLeft <= 0.0 ? 1.0 : Clamp(1.0 - dotLeft, 0.2, 1.0);
     const double attenuation = CalculateAttenuation(m_properties.innerRadius, m_properties.outerRadius, squareDistance);
     const double gain = 0.5 * attenuation * m_properties.gain;
+    return StereoGain{gain * leftPresence, gain * rightPresence};
+}
+
+auto AudioSource::ComputeGain() const noexcept -> StereoGain
+{
+    const double gain = 0.5 * m_properties.gain;
+    return StereoGain{gain, gain};
+}
+
+template<class Sample>
+void AudioSource::WriteSamples(Sample* buffer, size_t frames, const StereoGain& gain)
+{
     const auto& clip = m_clips.at(m_currentClipIndex);
+    if (clip.samplesPerChannel == 0)
+    {
+        SetStopped();
+        return;
+    }
 
-    for(size_t i = 0u; i < frames; ++i)
+    const auto ramp = GainRamp::Between(StereoGain{m_lastLeftGain, m_lastRightGain}, gain, frames);
+    const auto downmix = IsSpatial();
+    m_lastLeftGain = static_cast<float>(gain.left);
+    m_lastRightGain = static_cast<float>(gain.right);
+
+    // Mix whole runs up to the end of the clip, then wrap, rather than testing the position every frame
+    auto written = size_t{0};
+    while (written < frames)
     {
-        if(++m_currentSampleIndex >= clip.samplesPerChannel)
+        const auto run = std::min(frames - written, clip.samplesPerChannel - m_currentSampleIndex);
+        if (clip.format == asset::AudioSampleFormat::Int16)
+            ::MixClipRun<int16_t>(buffer + 2 * written, clip, m_currentSampleIndex, run, ramp.Offset(written), downmix);
+        else
+            ::MixClipRun<float>(buffer + 2 * written, clip, m_currentSampleIndex, run, ramp.Offset(written), downmix);
+
+        written += run;
+        m_currentSampleIndex += static_cast<uint32_t>(run);
+        if (m_currentSampleIndex >= clip.samplesPerChannel)
         {
-            m_currentSampleIndex = 0;
+            m_currentSampleIndex = 0u;
             if (!IsLooping())
             {
+                m_lastLeftGain = 0.0f;
+                m_lastRightGain = 0.0f;
                 SetStopped();
                 return;
             }
         }
-
-        const double sample = gain * (clip.leftChannel[m_currentSampleIndex] + clip.rightChannel[m_currentSampleIndex]);
-        *buffer++ += sample * leftPresence;
-        *buffer++ += sample * rightPresence;
     }
 }
 
-void AudioSource::WriteNonSpatialSamples(double* buffer, size_t frames)
+void AudioSource::Advance(size_t frames) noexcept
 {
-    const double gain = 0.5 * m_properties.gain;
-    const auto& clip = m_clips.at(m_currentClipIndex);
-
-    for(size_t i = 0u; i < frames; ++i)
+    // Start from silence so the source fades in if it becomes audible again
+    m_lastLeftGain = 0.0f;
+    m_lastRightGain = 0.0f;
+    const auto samplesPerChannel = m_clips[m_currentClipIndex].samplesPerChannel;
+    const auto position = m_currentSampleIndex + frames;
+    if (position < samplesPerChannel)
     {
-        *buffer++ += gain * clip.leftChannel[m_currentSampleIndex];
-        *buffer++ += gain * clip.rightChannel[m_currentSampleIndex];
+        m_currentSampleIndex = static_cast<uint32_t>(position);
+        return;
+    }
 
-        if(++m_currentSampleIndex >= clip.samplesPerChannel)
-        {
-            m_currentSampleIndex = 0;
-            if (!IsLooping())
-            {
-                SetStopped();
-                return;
-            }
-        }
+    if (!IsLooping() || samplesPerChannel == 0)
+    {
+        m_currentSampleIndex = 0u;
+        SetStopped();
+        return;
     }
+
+    m_currentSampleIndex = static_cast<uint32_t>(position % samplesPerChannel);
 }
+
+template void AudioSource::WriteSamples<float>(float*, size_t, const StereoGain&);
+template void AudioSource::WriteSamples<double>(double*, size_t, const StereoGain&);
 } // namespace nc::audio
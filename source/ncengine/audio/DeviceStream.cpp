@@ -7,7 +7,6 @@
 
 namespace
 {
-constexpr auto g_format = RTAUDIO_FLOAT64;
 const auto g_nullDevice = nc::audio::AudioDevice{"NoDevice", nc::audio::InvalidDeviceId};
 
 auto ToString(RtAudioErrorType type) noexcept -> std::string_view
@@ -98,13 +97,15 @@ auto DeviceStream::OpenStream(const StreamParameters& params) -> bool
 
     NC_LOG_TRACE("Audio stream parameters:\n"
                  "\tsample rate: {}\n"
-                 "\tbuffer frames: {}",
+                 "\tbuffer frames: {}\n"
+                 "\tsample format: {}",
                  params.sampleRate,
-                 params.bufferFrames);
+                 params.bufferFrames,
+                 params.floatSamples ? "float32" : "float64");
 
     const auto result = m_rtAudio->openStream(&rtParams,
                                               nullptr,
-                                              g_format,
+                                              params.floatSamples ? RTAUDIO_FLOAT32 : RTAUDIO_FLOAT64,
                                               params.sampleRate,
                                               &m_bufferFrames,
                                               params.callback,
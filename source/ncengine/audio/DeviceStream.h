@@ -17,6 +17,7 @@ struct StreamParameters
     uint32_t bufferFrames;
     uint32_t channelCount;
     uint32_t sampleRate;
+    bool floatSamples;
     StreamCallback callback;
     void* userData;
 };
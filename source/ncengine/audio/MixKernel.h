@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace nc::audio
+{
+/** @brief Per-channel gain applied when mixing a source. */
+struct StereoGain
+{
+    double left = 0.0;
+    double right = 0.0;
+};
+
+/** @brief Linear gain ramp across a block. Gain for frame i is start + step * i. */
+struct GainRamp
+{
+    StereoGain start;
+    StereoGain step;
+
+    /** @brief Create a ramp moving from one gain to another over a number of frames. */
+    static auto Between(const StereoGain& from, const StereoGain& to, size_t frames) noexcept -> GainRamp
+    {
+        const auto invFrames = frames == 0 ? 0.0 : 1.0 / static_cast<double>(frames);
+        return GainRamp{
+            from,
+            StereoGain{(to.left - from.left) * invFrames, (to.right - from.right) * invFrames}
+        };
+    }
+
+    /** @brief Get the ramp beginning a number of frames later. */
+    auto Offset(size_t frames) const noexcept -> GainRamp
+    {
+        const auto f = static_cast<double>(frames);
+        return GainRamp{StereoGain{start.left + step.left * f, start.right + step.right * f}, step};
+    }
+};
+
+/** @brief Factor converting a stored clip sample to the [-1, 1] range. */
+template<class Input>
+inline constexpr double g_sampleScale = std::is_same_v<Input, int16_t> ? 1.0 / 32768.0 : 1.0;
+
+/**
+ * @brief Accumulate a contiguous run of stereo clip samples into an interleaved buffer.
+ *
+ * Kernels never branch per frame and never wrap - callers split runs at the clip boundary - so the
+ * loops vectorize. When downmix is set, left and right are summed before applying per-channel gain,
+ * which is how spatial sources are panned. Integer input is normalized by folding its scale into the
+ * gain ramp, so decoding costs nothing beyond the conversion itself.
+ */
+template<class Sample, class Input>
+void MixRun(Sample* out, const Input* left, const Input* right, size_t frames, const GainRamp& ramp, bool downmix) noexcept
+{
+    constexpr auto scale = g_sampleScale<Input>;
+    const auto l0 = ramp.start.left * scale;
+    const auto r0 = ramp.start.right * scale;
+    const auto dl = ramp.step.left * scale;
+    const auto dr = ramp.step.right * scale;
+
+    if (downmix)
+    {
+        for (size_t i = 0; i < frames; ++i)
+        {
+            const auto t = static_cast<double>(i);
+            const auto mono = static_cast<double>(left[i]) + static_cast<double>(right[i]);
+            out[2 * i]     += static_cast<Sample>(mono * (l0 + dl * t));
+            out[2 * i + 1] += static_cast<Sample>(mono * (r0 + dr * t));
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < frames; ++i)
+        {
+            const auto t = static_cast<double>(i);
+            out[2 * i]     += static_cast<Sample>(static_cast<double>(left[i]) * (l0 + dl * t));
+            out[2 * i + 1] += static_cast<Sample>(static_cast<double>(right[i]) * (r0 + dr * t));
+        }
+    }
+}
+
+/** @brief Sum count samples from src into dst. */
+template<class Sample>
+void Accumulate(Sample* dst, const Sample* src, size_t count) noexcept
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        dst[i] += src[i];
+    }
+}
+} // namespace nc::audio
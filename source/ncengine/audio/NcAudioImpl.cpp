@@ -5,49 +5,37 @@
 #include "ncengine/ecs/View.h"
 #include "ncengine/utility/Log.h"
 
-#include <cstring>
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <functional>
 
 namespace
 {
 constexpr auto g_outputChannelCount = 2u;
 constexpr auto g_sampleRate = 44100u;
 constexpr auto g_bufferCount = 3u;
+constexpr auto g_maxMixSlices = size_t{8};
+constexpr auto g_minVoicesPerSlice = size_t{16};
 
 auto IndividualBufferSize(uint32_t bufferFrames) -> uint32_t
 {
     return bufferFrames * g_outputChannelCount;
 }
 
-auto BuildBufferPool(uint32_t bufferFrames) -> std::vector<double>
+template<class Sample>
+auto BuildSamplePool(uint32_t bufferFrames, size_t bufferCount, bool enabled) -> std::vector<Sample>
 {
-    return std::vector<double>(IndividualBufferSize(bufferFrames) * g_bufferCount, 0.0);
-}
-
-auto BuildBufferQueue(std::span<double> bufferPool) -> std::queue<std::span<double>>
-{
-    if (bufferPool.size() % g_bufferCount != 0)
-    {
-        throw nc::NcError("Invalid buffer pool size");
-    }
-
-    const auto bufferLength = bufferPool.size() / g_bufferCount;
-    auto queue = std::queue<std::span<double>>{};
-    for(auto i = 0ull; i < g_bufferCount; ++i)
-    {
-        auto begin = bufferPool.begin() + i * bufferLength;
-        queue.emplace(begin, bufferLength);
-    }
-
-    return queue;
+    return enabled ? std::vector<Sample>(IndividualBufferSize(bufferFrames) * bufferCount, Sample{0}) : std::vector<Sample>{};
 }
 
 int AudioSystemCallback(void* outputBuffer, void*, unsigned nBufferFrames, double, unsigned, void* userData)
 {
     auto* system = static_cast<nc::audio::NcAudioImpl*>(userData);
-    return system->WriteToDeviceBuffer(static_cast<double*>(outputBuffer), nBufferFrames);
+    return system->WriteToDeviceBuffer(outputBuffer, nBufferFrames);
 }
 
-auto CreateStreamParams(uint32_t deviceId, uint32_t bufferFrames, nc::audio::NcAudioImpl* impl) -> nc::audio::StreamParameters
+auto CreateStreamParams(uint32_t deviceId, uint32_t bufferFrames, bool floatSamples, nc::audio::NcAudioImpl* impl) -> nc::audio::StreamParameters
 {
     return nc::audio::StreamParameters
     {
@@ -55,6 +43,7 @@ auto CreateStreamParams(uint32_t deviceId, uint32_t bufferFrames, nc::audio::NcA
         bufferFrames,
         g_outputChannelCount,
         g_sampleRate,
+        floatSamples,
         ::AudioSystemCallback,
         static_cast<void*>(impl)
     };
@@ -100,15 +89,31 @@ auto BuildAudioModule(const config::AudioSettings& settings, ecs::ExplicitEcs<En
 
 NcAudioImpl::NcAudioImpl(const config::AudioSettings& settings, ecs::ExplicitEcs<Entity, Transform, AudioSource> gameState)
     : m_gameState{gameState},
-      m_deviceStream{::CreateStreamParams(DefaultDeviceId, settings.bufferFrames, this)},
-      m_bufferMemory(::BuildBufferPool(m_deviceStream.GetBufferFrames())),
       m_readyBuffers{},
-      m_staleBuffers{::BuildBufferQueue(m_bufferMemory)},
-      m_readyMutex{},
-      m_staleMutex{},
+      m_staleBuffers{},
+      m_flushRequested{false},
+      m_floatSamples{settings.floatSamples},
+      m_deviceStream{::CreateStreamParams(DefaultDeviceId, settings.bufferFrames, settings.floatSamples, this)},
+      m_doubleMemory{
+          ::BuildSamplePool<double>(m_deviceStream.GetBufferFrames(), g_bufferCount, !m_floatSamples),
+          ::BuildSamplePool<double>(m_deviceStream.GetBufferFrames(), g_bufferCount * (g_maxMixSlices - 1), !m_floatSamples)
+      },
+      m_floatMemory{
+          ::BuildSamplePool<float>(m_deviceStream.GetBufferFrames(), g_bufferCount, m_floatSamples),
+          ::BuildSamplePool<float>(m_deviceStream.GetBufferFrames(), g_bufferCount * (g_maxMixSlices - 1), m_floatSamples)
+      },
+      m_voices{},
+      m_pendingBuffers{},
+      m_sliceCount{0},
+      m_maxVoices{settings.maxVoices},
       m_listener{Entity::Null()},
       m_configBufferFrames{settings.bufferFrames}
 {
+    m_pendingBuffers.reserve(g_bufferCount);
+    for (auto i = 0u; i < g_bufferCount; ++i)
+    {
+        m_staleBuffers.TryPush(i);
+    }
 }
 
 NcAudioImpl::~NcAudioImpl() noexcept
@@ -118,13 +123,9 @@ NcAudioImpl::~NcAudioImpl() noexcept
 
 void NcAudioImpl::Clear() noexcept
 {
+    // Only the device callback may consume ready buffers, so ask it to discard them
     m_listener = Entity::Null();
-    auto lock = std::lock_guard{m_readyMutex};
-    while(!m_readyBuffers.empty())
-    {
-        m_staleBuffers.push(m_readyBuffers.front());
-        m_readyBuffers.pop();
-    }
+    m_flushRequested.store(true, std::memory_order_release);
 }
 
 void NcAudioImpl::OnBuildTaskGraph(task::UpdateTasks& update, task::RenderTasks&)
@@ -133,7 +134,7 @@ void NcAudioImpl::OnBuildTaskGraph(task::UpdateTasks& update, task::RenderTasks&
     update.Add(
         update_task_id::AudioSourceUpdate,
         "AudioSourceUpdate",
-        [this]{ Run(); }
+        BuildMixGraph(update.GetExceptionContext())
     );
 }
 
@@ -155,7 +156,7 @@ auto NcAudioImpl::GetOutputDevice() const noexcept -> const AudioDevice&
 
 auto NcAudioImpl::SetOutputDevice(uint32_t deviceId) noexcept -> bool
 {
-    const auto result = m_deviceStream.OpenStream(::CreateStreamParams(deviceId, m_configBufferFrames, this));
+    const auto result = m_deviceStream.OpenStream(::CreateStreamParams(deviceId, m_configBufferFrames, m_floatSamples, this));
     if (result)
     {
         m_outputDeviceChanged.Emit(m_deviceStream.GetDevice());
@@ -179,38 +180,98 @@ void NcAudioImpl::SetStreamTime(double time) noexcept
     m_deviceStream.SetStreamTime(time);
 }
 
-int NcAudioImpl::WriteToDeviceBuffer(double* output, uint32_t bufferFrames)
+auto NcAudioImpl::WriteToDeviceBuffer(void* output, uint32_t bufferFrames) noexcept -> int
 {
-    assert(bufferFrames == m_deviceStream.GetBufferFrames());
-    const auto bufferSizeInBytes = ::IndividualBufferSize(bufferFrames) * sizeof(double);
-    // empty check before lock is only safe with 1 consumer
-    if(m_readyBuffers.empty())
-    {
-        std::memset(output, 0, bufferSizeInBytes);
-        return 0;
-    }
+    return m_floatSamples
+        ? WriteToDeviceBuffer(static_cast<float*>(output), bufferFrames)
+        : WriteToDeviceBuffer(static_cast<double*>(output), bufferFrames);
+}
 
-    auto buffer = std::span<double>{};
+template<class Sample>
+auto NcAudioImpl::GetMemory() noexcept -> MixMemory<Sample>&
+{
+    if constexpr (std::same_as<Sample, float>)
+        return m_floatMemory;
+    else
+        return m_doubleMemory;
+}
+
+template<class Sample>
+auto NcAudioImpl::GetBuffer(uint32_t index) noexcept -> std::span<Sample>
+{
+    auto& pool = GetMemory<Sample>().buffers;
+    const auto bufferLength = pool.size() / g_bufferCount;
+    return std::span<Sample>{pool.data() + index * bufferLength, bufferLength};
+}
 
+template<class Sample>
+auto NcAudioImpl::GetMixTarget(size_t slice, size_t pendingIndex) noexcept -> std::span<Sample>
+{
+    if (slice == 0)
     {
-        std::lock_guard lock{m_readyMutex};
-        buffer = m_readyBuffers.front();
-        m_readyBuffers.pop();
+        return GetBuffer<Sample>(m_pendingBuffers[pendingIndex]);
     }
 
-    std::memcpy(output, buffer.data(), bufferSizeInBytes);
+    auto& pool = GetMemory<Sample>().accumulators;
+    const auto bufferLength = pool.size() / (g_bufferCount * (g_maxMixSlices - 1));
+    const auto offset = ((slice - 1) * g_bufferCount + pendingIndex) * bufferLength;
+    return std::span<Sample>{pool.data() + offset, bufferLength};
+}
 
+template<class Sample>
+auto NcAudioImpl::WriteToDeviceBuffer(Sample* output, uint32_t bufferFrames) noexcept -> int
+{
+    // Runs on the real-time device thread: no locks, allocations, or logging
+    assert(bufferFrames == m_deviceStream.GetBufferFrames());
+    const auto sampleCount = ::IndividualBufferSize(bufferFrames);
+    auto index = 0u;
+    if (m_flushRequested.exchange(false, std::memory_order_acq_rel))
     {
-        std::lock_guard lock{m_staleMutex};
-        m_staleBuffers.push(buffer);
+        while (m_readyBuffers.TryPop(index))
+        {
+            m_staleBuffers.TryPush(index);
+        }
+    }
+    else if (m_readyBuffers.TryPop(index))
+    {
+        std::copy_n(GetBuffer<Sample>(index).data(), sampleCount, output);
+        m_staleBuffers.TryPush(index);
+        return 0;
     }
 
+    std::fill_n(output, sampleCount, Sample{0});
     return 0;
 }
 
-void NcAudioImpl::Run()
+auto NcAudioImpl::BuildMixGraph(task::ExceptionContext& exceptionContext) -> std::unique_ptr<tf::Taskflow>
+{
+    auto graph = std::make_unique<tf::Taskflow>();
+    auto begin = graph->emplace(task::Guard(exceptionContext, [this] { BeginMix(); }))
+                       .name("BeginAudioMix");
+
+    auto mix = graph->for_each_index(
+        size_t{0},
+        std::ref(m_sliceCount),
+        size_t{1},
+        [this, &exceptionContext](size_t i)
+        {
+            task::Guard(exceptionContext, [this, i] { MixSlice(i); })();
+        }
+    ).name("MixAudioSlices");
+
+    auto end = graph->emplace(task::Guard(exceptionContext, [this] { EndMix(); }))
+                     .name("EndAudioMix");
+
+    begin.precede(mix);
+    mix.precede(end);
+    return graph;
+}
+
+void NcAudioImpl::BeginMix()
 {
     NC_PROFILE_TASK("AudioModule", ProfileCategory::Audio);
+    m_sliceCount = 0;
+    m_pendingBuffers.clear();
     if(!m_listener.Valid())
     {
         return;
@@ -222,36 +283,25 @@ void NcAudioImpl::Run()
         return;
     }
 
-    auto buffer = std::span<double>{};
-
-    for(auto i = 0u; i < g_bufferCount; ++i)
+    auto index = 0u;
+    while (m_staleBuffers.TryPop(index))
     {
-        if(m_staleBuffers.empty())
-        {
-            return;
-        }
-
-        {
-            auto lock = std::lock_guard{m_staleMutex};
-            buffer = m_staleBuffers.front();
-            m_staleBuffers.pop();
-        }
-
-        MixToBuffer(buffer.data());
+        m_pendingBuffers.push_back(index);
+    }
 
-        {
-            auto lock = std::lock_guard{m_readyMutex};
-            m_readyBuffers.push(buffer);
-        }
+    if (m_pendingBuffers.empty())
+    {
+        return;
     }
+
+    SelectVoices(m_deviceStream.GetBufferFrames() * m_pendingBuffers.size());
+    const auto sliceCount = (m_voices.size() + g_minVoicesPerSlice - 1) / g_minVoicesPerSlice;
+    m_sliceCount = std::clamp(sliceCount, size_t{1}, g_maxMixSlices);
 }
 
-void NcAudioImpl::MixToBuffer(double* buffer)
+void NcAudioImpl::SelectVoices(size_t blockFrames)
 {
-    const auto bufferFrames = m_deviceStream.GetBufferFrames();
-    const auto bufferSizeInBytes = ::IndividualBufferSize(bufferFrames) * sizeof(double);
-    std::memset(buffer, 0, bufferSizeInBytes);
-
+    m_voices.clear();
     const auto& listenerTransform = m_gameState.Get<Transform>(m_listener);
     const auto listenerPosition = listenerTransform.Position();
     const auto rightEar = listenerTransform.Right();
@@ -263,15 +313,95 @@ void NcAudioImpl::MixToBuffer(double* buffer)
             continue;
         }
 
-        if(source.IsSpatial())
+        const auto gain = source.IsSpatial()
+            ? source.ComputeGain(m_gameState.Get<Transform>(source.ParentEntity()).Position(), listenerPosition, rightEar)
+            : source.ComputeGain();
+
+        if (gain.left > 0.0 || gain.right > 0.0 || source.IsAudible())
+        {
+            m_voices.push_back(Voice{&source, gain});
+        }
+        else
+        {
+            source.Advance(blockFrames);
+        }
+    }
+
+    if (m_voices.size() <= m_maxVoices)
+    {
+        return;
+    }
+
+    // Keep the loudest voices. The rest are virtualized, but any still audible from the last block
+    // are mixed once more ramping down to silence so they don't click off.
+    std::ranges::nth_element(m_voices, m_voices.begin() + m_maxVoices, std::ranges::greater{}, [](const Voice& voice)
+    {
+        return std::max(voice.gain.left, voice.gain.right);
+    });
+
+    auto keep = m_voices.begin() + m_maxVoices;
+    for (auto voice = keep; voice != m_voices.end(); ++voice)
+    {
+        if (voice->source->IsAudible())
         {
-            auto& transform = m_gameState.Get<Transform>(source.ParentEntity());
-            source.WriteSpatialSamples(buffer, bufferFrames, transform.Position(), listenerPosition, rightEar);
+            *keep++ = Voice{voice->source, StereoGain{}};
         }
         else
         {
-            source.WriteNonSpatialSamples(buffer, bufferFrames);
+            voice->source->Advance(blockFrames);
         }
     }
+
+    m_voices.erase(keep, m_voices.end());
+}
+
+void NcAudioImpl::MixSlice(size_t slice)
+{
+    m_floatSamples ? MixSlice<float>(slice) : MixSlice<double>(slice);
+}
+
+template<class Sample>
+void NcAudioImpl::MixSlice(size_t slice)
+{
+    NC_PROFILE_TASK("AudioMixSlice", ProfileCategory::Audio);
+    const auto frames = m_deviceStream.GetBufferFrames();
+    const auto voicesPerSlice = (m_voices.size() + m_sliceCount - 1) / m_sliceCount;
+    const auto first = std::min(slice * voicesPerSlice, m_voices.size());
+    const auto last = std::min(first + voicesPerSlice, m_voices.size());
+    const auto voices = std::span<const Voice>{m_voices}.subspan(first, last - first);
+
+    for (auto pending = 0ull; pending < m_pendingBuffers.size(); ++pending)
+    {
+        auto target = GetMixTarget<Sample>(slice, pending);
+        std::ranges::fill(target, Sample{0});
+        for (const auto& [source, gain] : voices)
+        {
+            if (source->IsPlaying())
+            {
+                source->WriteSamples(target.data(), frames, gain);
+            }
+        }
+    }
+}
+
+void NcAudioImpl::EndMix()
+{
+    m_floatSamples ? EndMix<float>() : EndMix<double>();
+}
+
+template<class Sample>
+void NcAudioImpl::EndMix()
+{
+    for (auto pending = 0ull; pending < m_pendingBuffers.size(); ++pending)
+    {
+        auto buffer = GetBuffer<Sample>(m_pendingBuffers[pending]);
+        for (auto slice = 1ull; slice < m_sliceCount; ++slice)
+        {
+            Accumulate(buffer.data(), GetMixTarget<Sample>(slice, pending).data(), buffer.size());
+        }
+
+        // Can't fail - the rings have room for every buffer in the pool
+        m_readyBuffers.TryPush(m_pendingBuffers[pending]);
+    }
 }
 } // namespace nc::audio
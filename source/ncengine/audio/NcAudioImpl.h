@@ -1,14 +1,17 @@
 #pragma once
 
 #include "DeviceStream.h"
+#include "MixKernel.h"
+#include "SpscRing.h"
 #include "ncengine/audio/NcAudio.h"
 #include "ncengine/audio/AudioSource.h"
 #include "ncengine/ecs/Ecs.h"
 #include "ncengine/ecs/Registry.h"
 #include "ncengine/task/TaskGraph.h"
 
-#include <mutex>
-#include <queue>
+#include <atomic>
+#include <memory>
+#include <span>
 
 namespace nc::audio
 {
@@ -32,21 +35,66 @@ class NcAudioImpl final : public NcAudio
         void OnBuildTaskGraph(task::UpdateTasks& update, task::RenderTasks&) override;
         void Clear() noexcept override;
 
-        void Run();
-        auto WriteToDeviceBuffer(double* output, uint32_t bufferFrames) -> int;
+        /** Build a graph that mixes voices in parallel slices, each into its own accumulator, then
+         *  reduces the slices into the device buffers. */
+        auto BuildMixGraph(task::ExceptionContext& exceptionContext) -> std::unique_ptr<tf::Taskflow>;
+        auto WriteToDeviceBuffer(void* output, uint32_t bufferFrames) noexcept -> int;
 
     private:
+        // Indices into the buffer pool. Mixed buffers flow update -> device and are returned device -> update.
+        using BufferRing = SpscRing<uint32_t, 4>;
+
+        // Device buffers plus scratch accumulators for every mix slice but the first, which mixes in place.
+        template<class Sample>
+        struct MixMemory
+        {
+            std::vector<Sample> buffers;
+            std::vector<Sample> accumulators;
+        };
+
+        struct Voice
+        {
+            AudioSource* source;
+            StereoGain gain;
+        };
+
         ecs::ExplicitEcs<Entity, Transform, AudioSource> m_gameState;
+        BufferRing m_readyBuffers;
+        BufferRing m_staleBuffers;
+        std::atomic<bool> m_flushRequested;
+        bool m_floatSamples;
         DeviceStream m_deviceStream;
-        std::vector<double> m_bufferMemory;
-        std::queue<std::span<double>> m_readyBuffers;
-        std::queue<std::span<double>> m_staleBuffers;
-        std::mutex m_readyMutex;
-        std::mutex m_staleMutex;
+        MixMemory<double> m_doubleMemory;
+        MixMemory<float> m_floatMemory;
+        std::vector<Voice> m_voices;
+        std::vector<uint32_t> m_pendingBuffers;
+        size_t m_sliceCount;
+        unsigned m_maxVoices;
         Entity m_listener;
         Signal<const AudioDevice&> m_outputDeviceChanged;
         unsigned m_configBufferFrames;
 
-        void MixToBuffer(double* buffer);
+        template<class Sample>
+        auto GetMemory() noexcept -> MixMemory<Sample>&;
+
+        template<class Sample>
+        auto GetBuffer(uint32_t index) noexcept -> std::span<Sample>;
+
+        template<class Sample>
+        auto GetMixTarget(size_t slice, size_t pendingIndex) noexcept -> std::span<Sample>;
+
+        template<class Sample>
+        auto WriteToDeviceBuffer(Sample* output, uint32_t bufferFrames) noexcept -> int;
+
+        void BeginMix();
+        void SelectVoices(size_t blockFrames);
+        void MixSlice(size_t slice);
+        void EndMix();
+
+        template<class Sample>
+        void MixSlice(size_t slice);
+
+        template<class Sample>
+        void EndMix();
 };
 } // namespace nc::audio
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <type_traits>
+
+namespace nc::audio
+{
+/**
+ * @brief Wait-free ring buffer with a single producer thread and a single consumer thread.
+ *
+ * Neither side ever blocks or takes a lock, so it is safe to use from the real-time device callback. Head and
+ * tail are free-running counters kept on separate cache lines; the element at a counter value is found by masking.
+ */
+template<class T, size_t Capacity>
+class SpscRing
+{
+    static_assert(std::has_single_bit(Capacity), "SpscRing capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "SpscRing elements must be trivially copyable");
+
+    public:
+        /** @brief Push a value from the producer thread. Returns false if the ring is full. */
+        auto TryPush(const T& value) noexcept -> bool
+        {
+            const auto tail = m_tail.load(std::memory_order_relaxed);
+            if (tail - m_head.load(std::memory_order_acquire) == Capacity)
+            {
+                return false;
+            }
+
+            m_data[tail & Mask] = value;
+            m_tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        /** @brief Pop a value from the consumer thread. Returns false if the ring is empty. */
+        auto TryPop(T& out) noexcept -> bool
+        {
+            const auto head = m_head.load(std::memory_order_relaxed);
+            if (head == m_tail.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            out = m_data[head & Mask];
+            m_head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /** @brief Get the number of queued values. Only a snapshot when called concurrently with push/pop. */
+        auto Size() const noexcept -> size_t
+        {
+            return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+        }
+
+        auto Empty() const noexcept -> bool { return Size() == 0ull; }
+
+    private:
+        static constexpr auto Mask = Capacity - 1ull;
+        static constexpr auto CacheLineSize = 64ull;
+
+        alignas(CacheLineSize) std::atomic<size_t> m_head = 0ull;
+        alignas(CacheLineSize) std::atomic<size_t> m_tail = 0ull;
+        alignas(CacheLineSize) std::array<T, Capacity> m_data = {};
+};
+} // namespace nc::audio
@@ -22,8 +22,11 @@ constexpr auto ProjectNameKey = "project_name"sv;
 // engine
 constexpr auto TimeStepKey = "time_step"sv;
 constexpr auto MaxTimeStepKey = "max_time_step"sv;
+constexpr auto MaxStepsPerTickKey = "max_steps_per_tick"sv;
+constexpr auto FramePacingKey = "frame_pacing"sv;
 constexpr auto ThreadCountKey = "thread_count"sv;
 constexpr auto BuildTasksOnInitKey = "build_tasks_on_init"sv;
+constexpr auto PipelineRenderKey = "pipeline_render"sv;
 
 // asset
 constexpr auto AudioClipsPathKey = "audio_clips_path"sv;
@@ -61,6 +64,9 @@ constexpr auto SpeculativeContactDistanceKey = "speculative_contact_distance"sv;
 constexpr auto PenetrationSlopKey = "penetration_slop"sv;
 constexpr auto TimeBeforeSleepKey = "time_before_sleep"sv;
 constexpr auto SleepThresholdKey = "sleep_threshold"sv;
+constexpr auto GroupContactEventsKey = "group_contact_events"sv;
+constexpr auto FixedTimeStepKey = "fixed_time_step"sv;
+constexpr auto MaxSubstepsKey = "max_substeps"sv;
 
 // graphics
 constexpr auto GraphicsEnabledKey = "graphics_enabled"sv;
@@ -80,6 +86,8 @@ constexpr auto UseValidationLayersKey = "use_validation_layers"sv;
 // audio
 constexpr auto AudioEnabledKey = "audio_enabled"sv;
 constexpr auto BufferFramesKey = "buffer_frames"sv;
+constexpr auto FloatSamplesKey = "float_samples"sv;
+constexpr auto MaxVoicesKey = "max_voices"sv;
 
 auto ValidateBufferFrames(unsigned frames)
 {
@@ -100,7 +108,9 @@ auto ValidatePhysicsSettings(const nc::config::PhysicsSettings& settings) -> boo
 {
     return settings.velocitySteps >= 2u &&
            settings.baumgarteStabilization >= 0.0f &&
-           settings.baumgarteStabilization <= 1.0f;
+           settings.baumgarteStabilization <= 1.0f &&
+           settings.fixedTimeStep >= 0.0f &&
+           settings.maxSubsteps >= 1u;
 }
 
 auto TrimWhiteSpace(const std::string& str) -> std::string
@@ -192,8 +202,11 @@ auto BuildFromConfigMap(const std::unordered_map<std::string, std::string>& kvPa
     {
         ParseValueIfExists(out.timeStep, TimeStepKey, kvPairs);
         ParseValueIfExists(out.maxTimeStep, MaxTimeStepKey, kvPairs);
+        ParseValueIfExists(out.maxStepsPerTick, MaxStepsPerTickKey, kvPairs);
+        ParseValueIfExists(out.framePacing, FramePacingKey, kvPairs);
         ParseValueIfExists(out.threadCount, ThreadCountKey, kvPairs);
         ParseValueIfExists(out.buildTasksOnInit, BuildTasksOnInitKey, kvPairs);
+        ParseValueIfExists(out.pipelineRender, PipelineRenderKey, kvPairs);
     }
     else if constexpr (std::same_as<Struct_t, nc::config::AssetSettings>)
     {
@@ -250,11 +263,16 @@ auto BuildFromConfigMap(const std::unordered_map<std::string, std::string>& kvPa
         ParseValueIfExists(out.penetrationSlop, PenetrationSlopKey, kvPairs);
         ParseValueIfExists(out.timeBeforeSleep, TimeBeforeSleepKey, kvPairs);
         ParseValueIfExists(out.sleepThreshold, SleepThresholdKey, kvPairs);
+        ParseValueIfExists(out.groupContactEvents, GroupContactEventsKey, kvPairs);
+        ParseValueIfExists(out.fixedTimeStep, FixedTimeStepKey, kvPairs);
+        ParseValueIfExists(out.maxSubsteps, MaxSubstepsKey, kvPairs);
     }
     else if constexpr (std::same_as<Struct_t, nc::config::AudioSettings>)
     {
         ParseValueIfExists(out.enabled, AudioEnabledKey, kvPairs);
         ParseValueIfExists(out.bufferFrames, BufferFramesKey, kvPairs);
+        ParseValueIfExists(out.floatSamples, FloatSamplesKey, kvPairs);
+        ParseValueIfExists(out.maxVoices, MaxVoicesKey, kvPairs);
     }
 
     return out;
@@ -349,8 +367,11 @@ void Write(std::ostream& stream, const Config& config, bool writeSections)
     if (writeSections) stream << "[engine_settings]\n";
     ::WriteKVPair(stream, TimeStepKey, config.engineSettings.timeStep);
     ::WriteKVPair(stream, MaxTimeStepKey, config.engineSettings.maxTimeStep);
+    ::WriteKVPair(stream, MaxStepsPerTickKey, config.engineSettings.maxStepsPerTick);
+    ::WriteKVPair(stream, FramePacingKey, config.engineSettings.framePacing);
     ::WriteKVPair(stream, ThreadCountKey, config.engineSettings.threadCount);
     ::WriteKVPair(stream, BuildTasksOnInitKey, config.engineSettings.buildTasksOnInit);
+    ::WriteKVPair(stream, PipelineRenderKey, config.engineSettings.pipelineRender);
 
     if (writeSections) stream << "[asset_settings]\n";
     ::WriteKVPair(stream, AudioClipsPathKey, config.assetSettings.audioClipsPath);
@@ -388,6 +409,9 @@ void Write(std::ostream& stream, const Config& config, bool writeSections)
     ::WriteKVPair(stream, PenetrationSlopKey, config.physicsSettings.penetrationSlop);
     ::WriteKVPair(stream, TimeBeforeSleepKey, config.physicsSettings.timeBeforeSleep);
     ::WriteKVPair(stream, SleepThresholdKey, config.physicsSettings.sleepThreshold);
+    ::WriteKVPair(stream, GroupContactEventsKey, config.physicsSettings.groupContactEvents);
+    ::WriteKVPair(stream, FixedTimeStepKey, config.physicsSettings.fixedTimeStep);
+    ::WriteKVPair(stream, MaxSubstepsKey, config.physicsSettings.maxSubsteps);
 
     if (writeSections) stream << "[graphics_settings]\n";
     ::WriteKVPair(stream, GraphicsEnabledKey, config.graphicsSettings.enabled);
@@ -407,6 +431,8 @@ void Write(std::ostream& stream, const Config& config, bool writeSections)
     if (writeSections) stream << "[audio_settings]\n";
     ::WriteKVPair(stream, AudioEnabledKey, config.audioSettings.enabled);
     ::WriteKVPair(stream, BufferFramesKey, config.audioSettings.bufferFrames);
+    ::WriteKVPair(stream, FloatSamplesKey, config.audioSettings.floatSamples);
+    ::WriteKVPair(stream, MaxVoicesKey, config.audioSettings.maxVoices);
 }
 
 bool Validate(const Config& config)
@@ -414,6 +440,7 @@ bool Validate(const Config& config)
     return (config.projectSettings.projectName != "") &&
            (config.engineSettings.timeStep >= 0.0f) &&
            (config.engineSettings.maxTimeStep > 0.0f) &&
+           (config.engineSettings.maxStepsPerTick >= 1u) &&
            (config.assetSettings.audioClipsPath != "") &&
            (config.assetSettings.concaveCollidersPath != "") &&
            (config.assetSettings.hullCollidersPath != "") &&
@@ -430,7 +457,8 @@ bool Validate(const Config& config)
            (config.graphicsSettings.farClip > 0.0f) &&
            (config.graphicsSettings.antialiasing > 0) &&
            ValidatePhysicsSettings(config.physicsSettings) &&
-           ValidateBufferFrames(config.audioSettings.bufferFrames);
+           ValidateBufferFrames(config.audioSettings.bufferFrames) &&
+           (config.audioSettings.maxVoices != 0);
 }
 
 // Implementation from ConfigInternal.h
@@ -0,0 +1,117 @@
+#include "LogicScheduler.h"
+
+#include <algorithm>
+#include <mutex>
+#include <tuple>
+
+namespace nc::ecs
+{
+void LogicScheduler::Run(Ecs world, float dt)
+{
+    m_recorded.clear();
+    auto& pool = world.GetPool<FrameLogic>();
+    for (auto& logic : pool.GetComponents())
+    {
+        if (!logic.IsParallel())
+            logic.Run(world, dt);
+    }
+
+    BuildBatches(pool.GetComponents());
+    auto recordMutex = std::mutex{};
+    for (auto batchIndex = 0ull; batchIndex < m_batchCount; ++batchIndex)
+    {
+        auto& batch = m_batches[batchIndex];
+        auto runRange = [&, batchIndex](size_t begin, size_t end)
+        {
+            auto commands = CommandBuffer{};
+            for (auto i = begin; i < end; ++i)
+            {
+                batch.logic[i]->Run(world, commands, dt);
+            }
+
+            if (commands.empty())
+                return;
+
+            auto lock = std::lock_guard{recordMutex};
+            m_recorded.emplace_back(batchIndex, begin, std::move(commands));
+        };
+
+        if (batch.concurrent)
+            m_dispatcher.ParallelFor(batch.logic.size(), m_grainSize, runRange);
+        else
+            runRange(0ull, batch.logic.size());
+    }
+
+    // Chunks finish in any order, so restore visitation order before applying changes.
+    std::ranges::sort(m_recorded, [](const auto& lhs, const auto& rhs)
+    {
+        return std::tie(lhs.batch, lhs.begin) < std::tie(rhs.batch, rhs.begin);
+    });
+
+    for (auto& recorded : m_recorded)
+    {
+        recorded.commands.Playback(world);
+    }
+
+    m_recorded.clear();
+}
+
+void LogicScheduler::BuildBatches(std::span<FrameLogic> logic)
+{
+    for (auto i = 0ull; i < m_batchCount; ++i)
+    {
+        m_batches[i].access.reads.clear();
+        m_batches[i].access.writes.clear();
+        m_batches[i].logic.clear();
+    }
+
+    m_batchCount = 0;
+
+    // Few distinct declarations are expected, so remember which batch each one went to.
+    auto assignments = std::vector<std::pair<const detail::AccessSet*, size_t>>{};
+    for (auto& item : logic)
+    {
+        const auto* access = item.GetAccess();
+        if (!access)
+            continue;
+
+        auto pos = std::ranges::find(assignments, access, [](const auto& assignment) { return assignment.first; });
+        if (pos == assignments.end())
+        {
+            auto batchIndex = 0ull;
+            if (access->ConflictsWith(*access))
+            {
+                batchIndex = m_batchCount;
+                AcquireBatch().concurrent = false;
+            }
+            else
+            {
+                auto compatible = [access](const auto& batch)
+                {
+                    return batch.concurrent && !batch.access.ConflictsWith(*access);
+                };
+
+                const auto batches = std::span{m_batches}.first(m_batchCount);
+                batchIndex = static_cast<size_t>(std::ranges::find_if(batches, compatible) - batches.begin());
+                if (batchIndex == m_batchCount)
+                    AcquireBatch();
+            }
+
+            m_batches[batchIndex].access.Merge(*access);
+            pos = assignments.emplace(assignments.end(), access, batchIndex);
+        }
+
+        m_batches[pos->second].logic.push_back(&item);
+    }
+}
+
+auto LogicScheduler::AcquireBatch() -> Batch&
+{
+    if (m_batchCount == m_batches.size())
+        m_batches.emplace_back();
+
+    auto& batch = m_batches[m_batchCount++];
+    batch.concurrent = true;
+    return batch;
+}
+} // namespace nc::ecs
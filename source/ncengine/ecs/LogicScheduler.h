@@ -0,0 +1,59 @@
+#pragma once
+
+#include "ncengine/ecs/CommandBuffer.h"
+#include "ncengine/ecs/FrameLogic.h"
+#include "ncengine/task/AsyncDispatcher.h"
+
+#include <span>
+#include <vector>
+
+namespace nc::ecs
+{
+/**
+ * Runs FrameLogic components, spreading logic with declared access across the thread pool.
+ *
+ * Serial logic runs first, in pool order, on the calling thread. Parallel logic is then bucketed by declaration and
+ * buckets are packed greedily into batches whose combined access doesn't conflict. Each batch is split into chunks
+ * across workers, and batches run one after another. Logic conflicting with itself (e.g. writing a type it also
+ * reads from other entities) runs alone on the calling thread. Commands recorded by parallel logic are applied once
+ * every batch has finished, in the order the logic was visited.
+ */
+class LogicScheduler
+{
+    public:
+        static constexpr auto DefaultGrainSize = 64ull;
+
+        explicit LogicScheduler(const task::AsyncDispatcher& dispatcher, size_t grainSize = DefaultGrainSize) noexcept
+            : m_dispatcher{dispatcher}, m_grainSize{grainSize} {}
+
+        /** Run serial logic, then parallel logic, then apply deferred commands. */
+        void Run(Ecs world, float dt);
+
+        /** Get the number of parallel batches built by the last Run() call. */
+        auto BatchCount() const noexcept -> size_t { return m_batchCount; }
+
+    private:
+        struct Batch
+        {
+            detail::AccessSet access;
+            std::vector<FrameLogic*> logic;
+            bool concurrent = true;
+        };
+
+        struct RecordedCommands
+        {
+            size_t batch;
+            size_t begin;
+            CommandBuffer commands;
+        };
+
+        task::AsyncDispatcher m_dispatcher;
+        std::vector<Batch> m_batches;
+        std::vector<RecordedCommands> m_recorded;
+        size_t m_batchCount = 0;
+        size_t m_grainSize;
+
+        void BuildBatches(std::span<FrameLogic> logic);
+        auto AcquireBatch() -> Batch&;
+};
+} // namespace nc::ecs
@@ -9,16 +9,27 @@
 #include "ncengine/time/Time.h"
 #include "ncengine/utility/Log.h"
 
+#include <functional>
+
+namespace
+{
+// Minimum number of Transforms processed by a single worker during a depth-ordered sweep
+constexpr auto g_transformGrainSize = 1024ull;
+} // anonymous namespace
+
 namespace nc::ecs
 {
-auto BuildEcsModule(ComponentRegistry& registry, SystemEvents& events) -> std::unique_ptr<NcEcs>
+auto BuildEcsModule(ComponentRegistry& registry,
+                    const task::AsyncDispatcher& dispatcher,
+                    SystemEvents& events) -> std::unique_ptr<NcEcs>
 {
     NC_LOG_TRACE("Creating ECS Module");
-    return std::make_unique<EcsModule>(registry, events);
+    return std::make_unique<EcsModule>(registry, dispatcher, events);
 }
 
-EcsModule::EcsModule(ComponentRegistry& registry, SystemEvents& events) noexcept
+EcsModule::EcsModule(ComponentRegistry& registry, const task::AsyncDispatcher& dispatcher, SystemEvents& events) noexcept
     : m_registry{&registry},
+      m_logicScheduler{dispatcher},
       m_rebuildStaticConnection{events.rebuildStatics.Connect(
           [this](){ UpdateStaticWorldSpaceMatrices(); }
       )}
@@ -35,21 +46,54 @@ void EcsModule::OnBuildTaskGraph(task::UpdateTasks& update, task::RenderTasks&)
         [this] { RunFrameLogic(); }
     );
 
+    // CommitStagedChanges is composed from a small graph so the depth-ordered Transform update can fan out
+    // across workers. The first condition selects the update mode, then the depth-ordered branch loops one
+    // parallel sweep per hierarchy level.
+    auto& exceptionContext = update.GetExceptionContext();
+    auto graph = std::make_unique<tf::Taskflow>();
+    auto commit = graph->emplace(task::Guard(exceptionContext, [this] { CommitStagedChanges(); }))
+                        .name("CommitPendingChanges");
+
+    auto selectMode = graph->emplace([this]() noexcept
+    {
+        return m_transformUpdateMode == TransformUpdateMode::DepthOrdered ? 1 : 0;
+    }).name("SelectTransformUpdateMode");
+
+    auto graphWalk = graph->emplace(task::Guard(exceptionContext, [this] { UpdateWorldSpaceMatrices(); }))
+                           .name("UpdateWorldSpaceMatrices");
+
+    auto buildOrder = graph->emplace(task::Guard(exceptionContext, [this] { BeginDepthOrderedUpdate(); }))
+                            .name("BuildDepthOrder");
+
+    auto firstLevel = graph->emplace([this]() noexcept { return NextDepthLevel(); })
+                            .name("FirstDepthLevel");
+
+    auto sweepLevel = graph->for_each_index(
+        std::ref(m_levelBegin),
+        std::ref(m_levelEnd),
+        size_t{1},
+        [this](size_t i) { m_depthOrder.UpdateNode(i); },
+        tf::GuidedPartitioner{g_transformGrainSize}
+    ).name("SweepDepthLevel");
+
+    auto nextLevel = graph->emplace([this]() noexcept { return NextDepthLevel(); })
+                           .name("NextDepthLevel");
+
+    auto done = graph->emplace([this]() noexcept { EndDepthOrderedUpdate(); })
+                      .name("TransformUpdateDone");
+
+    commit.precede(selectMode);
+    selectMode.precede(graphWalk, buildOrder);
+    buildOrder.precede(firstLevel);
+    firstLevel.precede(sweepLevel, done);
+    sweepLevel.precede(nextLevel);
+    nextLevel.precede(sweepLevel, done);
+
     update.Add
     (
         update_task_id::CommitStagedChanges,
         "CommitStagedChanges",
-        [this]
-        {
-            m_registry->CommitPendingChanges();
-            auto groups = m_registry->GetPool<ecs::detail::FreeComponentGroup>().GetComponents();
-            for (auto& group : groups)
-            {
-                group.CommitStagedComponents();
-            }
-
-            UpdateWorldSpaceMatrices();
-        },
+        std::move(graph),
         {
             update_task_id::AudioSourceUpdate,
             update_task_id::ParticleEmitterUpdate,
@@ -61,83 +105,55 @@ void EcsModule::OnBuildTaskGraph(task::UpdateTasks& update, task::RenderTasks&)
 void EcsModule::RunFrameLogic()
 {
     NC_PROFILE_TASK("RunFrameLogic", ProfileCategory::GameLogic);
-    const float dt = time::DeltaTime();
-    auto world = ecs::Ecs{*m_registry};
-    for(auto& logic : m_registry->GetPool<FrameLogic>().GetComponents())
+    m_logicScheduler.Run(ecs::Ecs{*m_registry}, time::DeltaTime());
+}
+
+void EcsModule::CommitStagedChanges()
+{
+    NC_PROFILE_TASK("CommitStagedChanges", ProfileCategory::GameLogic);
+    m_registry->CommitPendingChanges();
+    auto groups = m_registry->GetPool<ecs::detail::FreeComponentGroup>().GetComponents();
+    for (auto& group : groups)
     {
-        logic.Run(world, dt);
+        group.CommitStagedComponents();
     }
 }
 
 void EcsModule::UpdateWorldSpaceMatrices()
 {
     NC_PROFILE_TASK("UpdateWorldSpaceMatrices", ProfileCategory::GameLogic);
-    auto world = Ecs{*m_registry};
-
-#if 1 // normal update using graph traversal
-    struct ParentInfo
-    {
-        Transform* transform;
-        std::span<Entity> children;
-    };
+    const auto start = std::chrono::steady_clock::now();
+    UpdateWorldMatricesGraphWalk(Ecs{*m_registry});
+    RecordTransformUpdateTime(TransformUpdateMode::GraphWalk, start);
+}
 
-    auto stack = std::vector<ParentInfo>{};
-    for (auto entity : world.GetAll<Entity>())
-    {
-        if (entity.IsStatic())
-            continue;
+void EcsModule::BeginDepthOrderedUpdate()
+{
+    m_depthOrderedStart = std::chrono::steady_clock::now();
+    m_depthOrder.Refresh(Ecs{*m_registry});
+    m_currentLevel = 0;
+}
 
-        auto& hierarchy = world.Get<Hierarchy>(entity);
-        if (hierarchy.parent.Valid()) // process root nodes first
-            continue;
+auto EcsModule::NextDepthLevel() noexcept -> int
+{
+    if (m_currentLevel >= m_depthOrder.LevelCount())
+        return 1;
 
-        auto& transform = world.Get<Transform>(entity);
-        auto dirty = transform.IsDirty();
-        if (dirty)
-            transform.UpdateWorldMatrix();
+    m_levelBegin = m_depthOrder.LevelBegin(m_currentLevel);
+    m_levelEnd = m_depthOrder.LevelEnd(m_currentLevel);
+    ++m_currentLevel;
+    return 0;
+}
 
-        if (hierarchy.children.empty())
-            continue;
+void EcsModule::EndDepthOrderedUpdate() noexcept
+{
+    RecordTransformUpdateTime(TransformUpdateMode::DepthOrdered, m_depthOrderedStart);
+}
 
-        stack.emplace_back(&transform, hierarchy.children);
-        while (!stack.empty())
-        {
-            auto& children = stack.back().children;
-            if (children.empty())
-            {
-                stack.pop_back();
-                continue;
-            }
-
-            if (!children.front().IsStatic())
-            {
-                auto& child = world.Get<Transform>(children.front());
-                dirty = dirty || child.IsDirty();
-                if (dirty)
-                    child.UpdateWorldMatrix(stack.back().transform->TransformationMatrix());
-
-                auto& childHierarchy = world.Get<Hierarchy>(children.front());
-                if (!childHierarchy.children.empty())
-                    stack.emplace_back(&child, childHierarchy.children);
-            }
-
-            children = children.subspan(1);
-        }
-    }
-#else // debug update
-    for (auto entity : world.GetAll<Entity>())
-    {
-        auto& hierarchy = world.Get<Hierarchy>(entity);
-        auto& transform = world.Get<Transform>(entity);
-        if (!hierarchy.parent.Valid())
-            transform.UpdateWorldMatrix();
-        else
-        {
-            auto& parentTransform = world.Get<Transform>(hierarchy.parent);
-            transform.UpdateWorldMatrix(parentTransform.TransformationMatrix());
-        }
-    }
-#endif
+void EcsModule::RecordTransformUpdateTime(TransformUpdateMode mode, std::chrono::steady_clock::time_point start) noexcept
+{
+    const auto elapsed = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start);
+    m_transformUpdateTimes[static_cast<size_t>(mode)] = elapsed.count();
 }
 
 void EcsModule::UpdateStaticWorldSpaceMatrices()
@@ -1,8 +1,12 @@
 #pragma once
 
+#include "LogicScheduler.h"
+#include "TransformUpdate.h"
 #include "ncengine/ecs/NcEcs.h"
 #include "ncengine/utility/Signal.h"
 
+#include <array>
+#include <chrono>
 #include <memory>
 
 namespace nc
@@ -17,18 +21,41 @@ namespace nc::ecs
 class EcsModule : public NcEcs
 {
     public:
-        EcsModule(ComponentRegistry& registry, SystemEvents& events) noexcept;
+        EcsModule(ComponentRegistry& registry, const task::AsyncDispatcher& dispatcher, SystemEvents& events) noexcept;
 
         void OnBuildTaskGraph(task::UpdateTasks& update, task::RenderTasks&) override;
         void RunFrameLogic();
 
+        auto GetTransformUpdateMode() const noexcept -> TransformUpdateMode override { return m_transformUpdateMode; }
+        void SetTransformUpdateMode(TransformUpdateMode mode) noexcept override { m_transformUpdateMode = mode; }
+
+        auto GetTransformUpdateTime(TransformUpdateMode mode) const noexcept -> float override
+        {
+            return m_transformUpdateTimes[static_cast<size_t>(mode)];
+        }
+
     private:
         ComponentRegistry* m_registry;
+        LogicScheduler m_logicScheduler;
         Connection m_rebuildStaticConnection;
-
+        TransformUpdateMode m_transformUpdateMode = TransformUpdateMode::GraphWalk;
+        DepthOrderedTransforms m_depthOrder;
+        std::array<float, 2> m_transformUpdateTimes{};
+        std::chrono::steady_clock::time_point m_depthOrderedStart;
+        size_t m_currentLevel = 0;
+        size_t m_levelBegin = 0;
+        size_t m_levelEnd = 0;
+
+        void CommitStagedChanges();
         void UpdateWorldSpaceMatrices();
         void UpdateStaticWorldSpaceMatrices();
+        void BeginDepthOrderedUpdate();
+        auto NextDepthLevel() noexcept -> int;
+        void EndDepthOrderedUpdate() noexcept;
+        void RecordTransformUpdateTime(TransformUpdateMode mode, std::chrono::steady_clock::time_point start) noexcept;
 };
 
-auto BuildEcsModule(ComponentRegistry* registry, SystemEvents& events) -> std::unique_ptr<NcEcs>;
+auto BuildEcsModule(ComponentRegistry* registry,
+                    const task::AsyncDispatcher& dispatcher,
+                    SystemEvents& events) -> std::unique_ptr<NcEcs>;
 } // namespace nc::ecs
@@ -44,118 +44,91 @@ namespace nc
     void Transform::Set(const Vector3& pos, const Quaternion& quat, const Vector3& scale)
     {
         NC_ASSERT(!HasAnyZeroElement(scale), "Invalid scale(elements cannot be 0)");
-        m_localMatrix = ToScaleMatrix(scale) * ToRotMatrix(quat) * ToTransMatrix(pos);
+        m_localPosition = ToXMVectorHomogeneous(pos);
+        m_localRotation = ToXMVector(quat);
+        m_localScale = ToXMVector(scale);
         m_dirty = true;
     }
 
     void Transform::Set(const Vector3& pos, const Vector3& angles, const Vector3& scale)
     {
         NC_ASSERT(!HasAnyZeroElement(scale), "Invalid scale(elements cannot be 0)");
-        m_localMatrix = ToScaleMatrix(scale) * ToRotMatrix(angles) * ToTransMatrix(pos);
+        m_localPosition = ToXMVectorHomogeneous(pos);
+        m_localRotation = XMQuaternionRotationRollPitchYaw(angles.x, angles.y, angles.z);
+        m_localScale = ToXMVector(scale);
         m_dirty = true;
     }
 
     void Transform::SetPosition(const Vector3& pos)
     {
-        m_localMatrix.r[3] = ToXMVectorHomogeneous(pos);
+        m_localPosition = ToXMVectorHomogeneous(pos);
         m_dirty = true;
     }
 
     void Transform::SetRotation(const Quaternion& quat)
     {
-        DirectX::XMVECTOR scl_v, rot_v, pos_v;
-        DirectX::XMMatrixDecompose(&scl_v, &rot_v, &pos_v, m_localMatrix);
-        m_localMatrix = DirectX::XMMatrixScalingFromVector(scl_v) *
-                        ToRotMatrix(quat) *
-                        DirectX::XMMatrixTranslationFromVector(pos_v);
+        m_localRotation = ToXMVector(quat);
         m_dirty = true;
     }
 
     void Transform::SetRotation(const Vector3& angles)
     {
-        DirectX::XMVECTOR scl_v, rot_v, pos_v;
-        DirectX::XMMatrixDecompose(&scl_v, &rot_v, &pos_v, m_localMatrix);
-        m_localMatrix = DirectX::XMMatrixScalingFromVector(scl_v) *
-                        ToRotMatrix(angles) *
-                        DirectX::XMMatrixTranslationFromVector(pos_v);
+        m_localRotation = XMQuaternionRotationRollPitchYaw(angles.x, angles.y, angles.z);
         m_dirty = true;
     }
 
     void Transform::SetScale(const Vector3& scale)
     {
         NC_ASSERT(!HasAnyZeroElement(scale), "Invalid scale(elements cannot be 0)");
-        DirectX::XMVECTOR scl_v, rot_v, pos_v;
-        DirectX::XMMatrixDecompose(&scl_v, &rot_v, &pos_v, m_localMatrix);
-        m_localMatrix = ToScaleMatrix(scale) *
-                        DirectX::XMMatrixRotationQuaternion(rot_v) *
-                        DirectX::XMMatrixTranslationFromVector(pos_v);
+        m_localScale = ToXMVector(scale);
         m_dirty = true;
     }
 
     void Transform::Translate(const Vector3& translation)
     {
-        const auto trans_v = ToXMVector(translation);
-        auto& localPos = m_localMatrix.r[3];
-        localPos = XMVectorAdd(localPos, trans_v);
+        m_localPosition = XMVectorAdd(m_localPosition, ToXMVector(translation));
         m_dirty = true;
     }
 
     void Transform::Translate(DirectX::FXMVECTOR translation)
     {
-        auto& localPos = m_localMatrix.r[3];
-        localPos = XMVectorAdd(localPos, translation);
+        m_localPosition = XMVectorAdd(m_localPosition, translation);
         m_dirty = true;
     }
 
     void Transform::TranslateLocalSpace(const Vector3& translation)
     {
         auto trans_v = ToXMVector(translation);
-        DirectX::XMVECTOR pos_v, rot_v, scl_v;
-        DirectX::XMMatrixDecompose(&scl_v, &rot_v, &pos_v, m_worldMatrix);
-        trans_v = DirectX::XMVector3Transform(trans_v, DirectX::XMMatrixRotationQuaternion(rot_v));
+        trans_v = DirectX::XMVector3Rotate(trans_v, DecomposeRotation(m_worldMatrix));
         trans_v = DirectX::XMVectorAndInt(trans_v, DirectX::g_XMMask3); //zero w component
-        m_localMatrix.r[3] = XMVectorAdd(m_localMatrix.r[3], trans_v);
+        m_localPosition = XMVectorAdd(m_localPosition, trans_v);
         m_dirty = true;
     }
 
     void Transform::Rotate(const Quaternion& quat)
     {
-        auto pos_v = m_localMatrix.r[3];
-        m_localMatrix.r[3] = DirectX::g_XMIdentityR3;
-        m_localMatrix *= ToRotMatrix(quat);
-        m_localMatrix.r[3] = pos_v;
-        m_dirty = true;
+        Rotate(ToXMVector(quat));
     }
 
     void Transform::Rotate(DirectX::FXMVECTOR quaternion)
     {
-        auto pos_v = m_localMatrix.r[3];
-        m_localMatrix.r[3] = DirectX::g_XMIdentityR3;
-        m_localMatrix *= DirectX::XMMatrixRotationQuaternion(quaternion);
-        m_localMatrix.r[3] = pos_v;
+        /** @note Renormalize so repeated incremental rotations don't accumulate drift. */
+        m_localRotation = XMQuaternionNormalize(XMQuaternionMultiply(m_localRotation, quaternion));
         m_dirty = true;
     }
 
     void Transform::Rotate(const Vector3& axis, float radians)
     {
-        auto pos_v = m_localMatrix.r[3];
-        m_localMatrix.r[3] = DirectX::g_XMIdentityR3;
-        m_localMatrix *= ToRotMatrix(axis, radians);
-        m_localMatrix.r[3] = pos_v;
-        m_dirty = true;
+        Rotate(XMQuaternionRotationAxis(ToXMVector(axis), radians));
     }
 
     void Transform::RotateAround(const Vector3& point, const Vector3& axis, float radians)
     {
-        using namespace DirectX;
         const auto rotationPoint = XMLoadVector3(&point);
-        const auto translation = XMVectorSubtract(m_localMatrix.r[3], rotationPoint);
-        const auto rotationMatrix = ToRotMatrix(axis, radians);
-        auto rotatedTranslation = XMVector3TransformCoord(translation, rotationMatrix);
-        rotatedTranslation = XMVectorAdd(rotatedTranslation, rotationPoint);
-        m_localMatrix.r[3] = g_XMIdentityR3;
-        XMMatrixMultiply(m_localMatrix, rotationMatrix);
-        m_localMatrix.r[3] = rotatedTranslation;
+        const auto translation = XMVectorSubtract(m_localPosition, rotationPoint);
+        const auto rotation = XMQuaternionRotationAxis(ToXMVector(axis), radians);
+        const auto rotatedTranslation = XMVector3Rotate(translation, rotation);
+        m_localPosition = XMVectorSetW(XMVectorAdd(rotatedTranslation, rotationPoint), 1.0f);
         m_dirty = true;
     }
 
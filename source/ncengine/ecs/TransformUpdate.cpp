@@ -0,0 +1,139 @@
+#include "TransformUpdate.h"
+#include "ncengine/debug/Profile.h"
+
+#include <span>
+
+namespace nc::ecs
+{
+void UpdateWorldMatricesGraphWalk(Ecs world)
+{
+    struct ParentInfo
+    {
+        Transform* transform;
+        std::span<Entity> children;
+    };
+
+    auto stack = std::vector<ParentInfo>{};
+    for (auto entity : world.GetAll<Entity>())
+    {
+        if (entity.IsStatic())
+            continue;
+
+        auto& hierarchy = world.Get<Hierarchy>(entity);
+        if (hierarchy.parent.Valid()) // process root nodes first
+            continue;
+
+        auto& transform = world.Get<Transform>(entity);
+        auto dirty = transform.IsDirty();
+        if (dirty)
+            transform.UpdateWorldMatrix();
+
+        if (hierarchy.children.empty())
+            continue;
+
+        stack.emplace_back(&transform, hierarchy.children);
+        while (!stack.empty())
+        {
+            auto& children = stack.back().children;
+            if (children.empty())
+            {
+                stack.pop_back();
+                continue;
+            }
+
+            if (!children.front().IsStatic())
+            {
+                auto& child = world.Get<Transform>(children.front());
+                dirty = dirty || child.IsDirty();
+                if (dirty)
+                    child.UpdateWorldMatrix(stack.back().transform->TransformationMatrix());
+
+                auto& childHierarchy = world.Get<Hierarchy>(children.front());
+                if (!childHierarchy.children.empty())
+                    stack.emplace_back(&child, childHierarchy.children);
+            }
+
+            children = children.subspan(1);
+        }
+    }
+}
+
+auto DepthOrderedTransforms::Refresh(Ecs world) -> bool
+{
+    const auto transformVersion = world.GetPool<Transform>().Version();
+    const auto hierarchyVersion = world.GetPool<Hierarchy>().Version();
+    if (transformVersion == m_transformVersion && hierarchyVersion == m_hierarchyVersion)
+        return false;
+
+    NC_PROFILE_TASK("BuildDepthOrder", ProfileCategory::GameLogic);
+    m_transforms.clear();
+    m_parents.clear();
+    m_levelOffsets.clear();
+
+    // Hierarchies are only needed while building, so they're kept out of the persistent state.
+    auto hierarchies = std::vector<const Hierarchy*>{};
+    hierarchies.reserve(m_transforms.capacity());
+    auto addNode = [&](Entity entity, uint32_t parent)
+    {
+        m_transforms.push_back(&world.Get<Transform>(entity));
+        m_parents.push_back(parent);
+        hierarchies.push_back(&world.Get<Hierarchy>(entity));
+    };
+
+    for (auto entity : world.GetAll<Entity>())
+    {
+        if (!entity.IsStatic() && !world.Get<Hierarchy>(entity).parent.Valid())
+            addNode(entity, NullParent);
+    }
+
+    auto levelBegin = 0ull;
+    m_levelOffsets.push_back(0u);
+    while (levelBegin != m_transforms.size())
+    {
+        const auto levelEnd = m_transforms.size();
+        for (auto i = levelBegin; i < levelEnd; ++i)
+        {
+            for (auto child : hierarchies[i]->children)
+            {
+                if (!child.IsStatic())
+                    addNode(child, static_cast<uint32_t>(i));
+            }
+        }
+
+        m_levelOffsets.push_back(static_cast<uint32_t>(levelEnd));
+        levelBegin = levelEnd;
+    }
+
+    m_dirty.resize(m_transforms.size());
+    m_transformVersion = transformVersion;
+    m_hierarchyVersion = hierarchyVersion;
+    return true;
+}
+
+void DepthOrderedTransforms::UpdateNode(size_t index) noexcept
+{
+    auto& transform = *m_transforms[index];
+    const auto parent = m_parents[index];
+    if (parent == NullParent)
+    {
+        m_dirty[index] = transform.IsDirty();
+        if (m_dirty[index])
+            transform.UpdateWorldMatrix();
+
+        return;
+    }
+
+    // The parent's level was fully processed by the previous sweep, so its flag is final.
+    m_dirty[index] = transform.IsDirty() || m_dirty[parent];
+    if (m_dirty[index])
+        transform.UpdateWorldMatrix(m_transforms[parent]->TransformationMatrix());
+}
+
+void DepthOrderedTransforms::UpdateAll() noexcept
+{
+    for (auto i = 0ull; i < m_transforms.size(); ++i)
+    {
+        UpdateNode(i);
+    }
+}
+} // namespace nc::ecs
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "ncengine/ecs/Ecs.h"
+
+#include <limits>
+#include <vector>
+
+namespace nc::ecs
+{
+/** Update world space matrices of non-static Transforms with a serial depth-first traversal from each root. */
+void UpdateWorldMatricesGraphWalk(Ecs world);
+
+/**
+ * Breadth-first ordering of non-static Transforms, grouped by their depth in the scene graph.
+ *
+ * The ordering is cached and only rebuilt when the Transform or Hierarchy pools report a change through their
+ * versions. Nodes within a level are independent, so each level may be swept in parallel once the previous one is
+ * finished.
+ */
+class DepthOrderedTransforms
+{
+    public:
+        static constexpr auto NullParent = std::numeric_limits<uint32_t>::max();
+
+        /** Rebuild the ordering if the scene graph changed since the last call. Returns true if it was rebuilt. */
+        auto Refresh(Ecs world) -> bool;
+
+        /** Get the number of depth levels. */
+        auto LevelCount() const noexcept -> size_t { return m_levelOffsets.empty() ? 0ull : m_levelOffsets.size() - 1; }
+
+        /** Get the [begin, end) node range for a depth level. */
+        auto LevelBegin(size_t level) const noexcept -> size_t { return m_levelOffsets[level]; }
+        auto LevelEnd(size_t level) const noexcept -> size_t { return m_levelOffsets[level + 1]; }
+
+        /** Get the total number of ordered Transforms. */
+        auto size() const noexcept -> size_t { return m_transforms.size(); }
+
+        /** Update a node's world matrix if it, or an ancestor, is dirty. Requires all shallower levels be updated. */
+        void UpdateNode(size_t index) noexcept;
+
+        /** Serially update every level. */
+        void UpdateAll() noexcept;
+
+    private:
+        std::vector<Transform*> m_transforms;  // nodes sorted by depth, parents always precede children
+        std::vector<uint32_t> m_parents;       // index of each node's parent in m_transforms, or NullParent for roots
+        std::vector<uint8_t> m_dirty;          // whether each node's world matrix was updated this frame
+        std::vector<uint32_t> m_levelOffsets;  // start index of each depth level, followed by the total node count
+        uint64_t m_transformVersion = std::numeric_limits<uint64_t>::max();
+        uint64_t m_hierarchyVersion = std::numeric_limits<uint64_t>::max();
+};
+} // namespace nc::ecs
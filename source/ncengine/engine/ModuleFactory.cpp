@@ -48,6 +48,7 @@ auto BuildModuleRegistry(Registry* registry,
     moduleRegistry->Register(nc::BuildSceneModule());
     moduleRegistry->Register(nc::asset::BuildAssetModule(config.assetSettings,
                                                          config.memorySettings,
+                                                         dispatcher,
                                                          BuildDefaultAssetMap()));
 
     moduleRegistry->Register(nc::graphics::BuildGraphicsModule(config.projectSettings,
@@ -55,6 +56,7 @@ auto BuildModuleRegistry(Registry* registry,
                                                                config.memorySettings,
                                                                ModuleProvider{moduleRegistry.get()},
                                                                registry,
+                                                               dispatcher,
                                                                events));
 
     moduleRegistry->Register(nc::BuildPhysicsModule(config.memorySettings,
@@ -64,7 +66,7 @@ auto BuildModuleRegistry(Registry* registry,
                                                     events));
 
     moduleRegistry->Register(nc::audio::BuildAudioModule(config.audioSettings, registry->GetEcs()));
-    moduleRegistry->Register(nc::ecs::BuildEcsModule(registry->GetImpl(), events));
+    moduleRegistry->Register(nc::ecs::BuildEcsModule(registry->GetImpl(), dispatcher, events));
     moduleRegistry->Register(std::make_unique<nc::Random>());
     return moduleRegistry;
 }
@@ -1,6 +1,7 @@
 #include "NcEngineImpl.h"
 #include "ModuleFactory.h"
 #include "RegistryFactory.h"
+#include "asset/NcAsset.h"
 #include "config/ConfigInternal.h"
 #include "config/Version.h"
 #include "input/InputInternal.h"
@@ -44,8 +45,8 @@ auto BuildTimer(const nc::config::EngineSettings& settings) -> nc::time::StepTim
         return nc::time::StepTimer{settings.maxTimeStep};
     }
 
-    NC_LOG_INFO("Building fixed step timer");
-    return nc::time::StepTimer{settings.timeStep, settings.maxTimeStep};
+    NC_LOG_INFO("Building fixed step timer{}", settings.framePacing ? " with frame pacing" : "");
+    return nc::time::StepTimer{settings.timeStep, settings.maxTimeStep, settings.maxStepsPerTick, settings.framePacing};
 }
 
 auto BuildExecutor(const nc::config::EngineSettings& settings) -> nc::task::Executor
@@ -79,7 +80,8 @@ NcEngineImpl::NcEngineImpl(const config::Config& config)
       m_executor{::BuildExecutor(config.engineSettings)},
       m_modules{BuildModuleRegistry(&m_legacyRegistry, GetAsyncDispatcher(), m_events, config)},
       m_onQuitConnection{m_events.quit.Connect(this, &NcEngineImpl::Stop, SignalPriority::Lowest)},
-      m_isRunning{false}
+      m_isRunning{false},
+      m_pipelineRender{config.engineSettings.pipelineRender}
 {
     if (config.engineSettings.buildTasksOnInit)
     {
@@ -120,6 +122,7 @@ void NcEngineImpl::Shutdown() noexcept
     NC_LOG_INFO("Shutting down engine");
     try
     {
+        m_executor.WaitRenderTasks();
         ClearScene();
         m_registry->Clear();
     }
@@ -167,9 +170,18 @@ void NcEngineImpl::ClearScene()
     m_registry->ClearSceneData();
 }
 
+void NcEngineImpl::SyncRender()
+{
+    for (auto& module : m_modules->GetAllModules())
+    {
+        module->OnRenderSync();
+    }
+}
+
 void NcEngineImpl::Run()
 {
     auto* ncScene = m_modules->Get<NcScene>();
+    auto* ncAsset = m_modules->Get<asset::NcAsset>();
     auto update = [this, ncWindow = m_modules->Get<window::NcWindow>()](float dt)
     {
         OPTICK_FRAME("Main Thread");
@@ -181,14 +193,32 @@ void NcEngineImpl::Run()
 
     while(m_isRunning)
     {
-        if (m_timer.Tick(update))
+        if (!m_timer.Tick(update))
+        {
+            continue;
+        }
+
+        if (m_pipelineRender)
+        {
+            // Finish the previous frame's render before touching state it may be reading, then let this frame's
+            // render overlap the next update.
+            m_executor.WaitRenderTasks();
+            ncAsset->CommitPendingLoads();
+            SyncRender();
+            m_executor.BeginRenderTasks();
+        }
+        else
         {
+            SyncRender();
             m_executor.RunRenderTasks();
-            if (ncScene->IsTransitionScheduled())
-            {
-                ClearScene();
-                ncScene->LoadQueuedScene(ecs::Ecs{*m_registry}, *m_modules);
-            }
+            ncAsset->CommitPendingLoads();
+        }
+
+        if (ncScene->IsTransitionScheduled())
+        {
+            m_executor.WaitRenderTasks();
+            ClearScene();
+            ncScene->LoadQueuedScene(ecs::Ecs{*m_registry}, *m_modules);
         }
     }
 
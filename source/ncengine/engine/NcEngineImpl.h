@@ -32,8 +32,10 @@ namespace nc
             std::unique_ptr<ModuleRegistry> m_modules;
             Connection m_onQuitConnection;
             bool m_isRunning;
+            bool m_pipelineRender;
 
             void ClearScene();
+            void SyncRender();
             void Run();
     };
 }
@@ -1,4 +1,5 @@
 #include "GraphicsTypes.h"
+#include "ncengine/ecs/Transform.h"
 #include "ncengine/graphics/Camera.h"
 #include "ncengine/graphics/MeshRenderer.h"
 #include "ncengine/graphics/ParticleEmitter.h"
@@ -23,6 +24,9 @@ void RegisterGraphicsTypes(ecs::ComponentRegistry& registry, size_t maxEntities)
         DeserializeMeshRenderer
     );
 
+    // Renderers are gathered with their Transforms every frame, so keep them in matching order.
+    registry.RegisterGroup<graphics::MeshRenderer, Transform>();
+
     Register<graphics::ToonRenderer>(
         registry,
         maxEntities,
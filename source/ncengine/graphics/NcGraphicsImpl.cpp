@@ -15,6 +15,7 @@
 #include "window/NcWindowImpl.h"
 
 #include "imgui/imgui.h"
+#include "ncutility/ScopeExit.h"
 
 namespace
 {
@@ -70,6 +71,7 @@ namespace nc::graphics
                              const config::MemorySettings& memorySettings,
                              ModuleProvider modules,
                              Registry* registry,
+                             const task::AsyncDispatcher& dispatcher,
                              SystemEvents& events) -> std::unique_ptr<NcGraphics>
     {
         if (graphicsSettings.enabled)
@@ -93,7 +95,7 @@ namespace nc::graphics
             auto graphicsApi = GraphicsFactory(projectSettings, graphicsSettings, ncAsset, *ncWindow);
 
             NC_LOG_TRACE("Building NcGraphics module");
-            return std::make_unique<NcGraphicsImpl>(graphicsSettings, memorySettings, registry, modules, events, std::move(graphicsApi), *ncWindow);
+            return std::make_unique<NcGraphicsImpl>(graphicsSettings, memorySettings, registry, modules, dispatcher, events, std::move(graphicsApi), *ncWindow);
         }
 
         NC_LOG_TRACE("Graphics disabled - building NcGraphics stub");
@@ -104,13 +106,14 @@ namespace nc::graphics
                                    const config::MemorySettings& memorySettings,
                                    Registry* registry,
                                    ModuleProvider modules,
+                                   const task::AsyncDispatcher& dispatcher,
                                    SystemEvents& events,
                                    std::unique_ptr<IGraphics> graphics,
                                    window::NcWindow& window)
         : m_registry{registry},
           m_graphics{std::move(graphics)},
           m_assetResources{AssetResourcesConfig{memorySettings}, m_graphics->ResourceBus(), modules.Get<asset::NcAsset>()},
-          m_systemResources{SystemResourcesConfig{graphicsSettings, memorySettings}, m_registry, m_graphics->ResourceBus(), modules, events, std::bind_front(&NcGraphics::GetCamera, this)},
+          m_systemResources{SystemResourcesConfig{graphicsSettings, memorySettings}, m_registry, m_graphics->ResourceBus(), modules, dispatcher, events, std::bind_front(&NcGraphics::GetCamera, this)},
           m_onResizeConnection{window.OnResize().Connect(this, &NcGraphicsImpl::OnResize)}
     {
 #if NC_DEBUG_RENDERING_ENABLED
@@ -161,6 +164,7 @@ namespace nc::graphics
         m_systemResources.environment.Clear();
         m_systemResources.lights.Clear();
         m_systemResources.skeletalAnimations.Clear();
+        m_preparedFrame.reset();
     }
 
     void NcGraphicsImpl::OnBuildTaskGraph(task::UpdateTasks& update, task::RenderTasks& render)
@@ -181,7 +185,7 @@ namespace nc::graphics
         update.Add(
             update_task_id::ParticleEmitterUpdate,
             "ParticleEmitterUpdate",
-            [this]{ m_systemResources.particleEmitters.UpdateParticles(); }
+            m_systemResources.particleEmitters.BuildUpdateGraph(update.GetExceptionContext())
         );
 
         update.Add(
@@ -198,9 +202,23 @@ namespace nc::graphics
         );
     }
 
-    void NcGraphicsImpl::Run()
+    void NcGraphicsImpl::OnRenderSync()
     {
-        NC_PROFILE_TASK("Render", ProfileCategory::Rendering);
+        NC_PROFILE_TASK("RenderSync", ProfileCategory::Rendering);
+
+        // Resizes are deferred to here since render tasks may still be in flight when window events are processed.
+        if (m_pendingResize)
+        {
+            m_systemResources.cameras.Get()->UpdateProjectionMatrix(m_pendingResize->dimensions.x, m_pendingResize->dimensions.y);
+            m_graphics->OnResize(m_pendingResize->dimensions, m_pendingResize->isMinimized);
+            m_pendingResize.reset();
+        }
+
+        // Asset updates made while the previous frame was rendering were queued, since backend buffers can only be
+        // modified once it's finished with them.
+        m_assetResources.ApplyPendingUpdates();
+
+        m_preparedFrame.reset();
 
         // Wait until the frame is ready to be rendered, begin accepting ImGui commands
         if (!m_graphics->PrepareFrame())
@@ -210,12 +228,13 @@ namespace nc::graphics
 
         auto currentFrameIndex = m_graphics->CurrentFrameIndex();
 
-        // Run all the systems to generate this frame's resource data.
+        // Run all the systems to generate this frame's resource data. This is the only point where rendering reads
+        // the registry, so the results are a snapshot render tasks can consume while the next update runs.
         m_systemResources.ui.Execute(ecs::Ecs(m_registry->GetImpl()));
         auto cameraState = m_systemResources.cameras.Execute(m_registry);
         auto widgetState = m_systemResources.widgets.Execute(m_registry->GetEcs());
         auto environmentState = m_systemResources.environment.Execute(cameraState, currentFrameIndex);
-        auto skeletalAnimationState = m_systemResources.skeletalAnimations.Execute(currentFrameIndex);
+        auto skeletalAnimationState = m_systemResources.skeletalAnimations.Execute(currentFrameIndex, cameraState, m_systemResources.objects.VisibleEntities());
         auto objectState = m_systemResources.objects.Execute(currentFrameIndex, MultiView<MeshRenderer, Transform>{m_registry}, MultiView<ToonRenderer, Transform>{m_registry},
                                                                         cameraState, environmentState, skeletalAnimationState);
         auto lightState = m_systemResources.lights.Execute(currentFrameIndex, MultiView<PointLight, Transform>{m_registry}, MultiView<SpotLight, Transform>{m_registry});
@@ -237,12 +256,30 @@ namespace nc::graphics
             state.environmentState.useSkybox,
             state.lightState.omniDirectionalLightCount,
             state.lightState.uniDirectionalLightCount,
-            static_cast<uint32_t>(state.objectState.pbrMeshes.size()),
-            static_cast<uint32_t>(state.objectState.toonMeshes.size()),
+            state.objectState.pbrInstanceCount,
+            state.objectState.toonInstanceCount,
             static_cast<uint32_t>(state.widgetState.wireframeData.size()),
             state.particleState.count
         };
 
+        m_preparedFrame = PreparedFrame{std::move(state), stateData, currentFrameIndex};
+        m_assetResources.renderInFlight = true;
+    }
+
+    void NcGraphicsImpl::Run()
+    {
+        NC_PROFILE_TASK("Render", ProfileCategory::Rendering);
+
+        // Nothing was prepared if PrepareFrame() failed (e.g. while minimized)
+        if (!m_preparedFrame)
+        {
+            return;
+        }
+
+        SCOPE_EXIT(m_preparedFrame.reset());
+        SCOPE_EXIT(m_assetResources.renderInFlight = false);
+        auto& [state, stateData, currentFrameIndex] = *m_preparedFrame;
+
         // Build the pipelines and renderpasses depending on which render state was generated.
         m_graphics->BuildRenderGraph(stateData);
 
@@ -264,7 +301,6 @@ namespace nc::graphics
 
     void NcGraphicsImpl::OnResize(const Vector2& dimensions, bool isMinimized)
     {
-        m_systemResources.cameras.Get()->UpdateProjectionMatrix(dimensions.x, dimensions.y);
-        m_graphics->OnResize(dimensions, isMinimized);
+        m_pendingResize = PendingResize{dimensions, isMinimized};
     }
 } // namespace nc::graphics
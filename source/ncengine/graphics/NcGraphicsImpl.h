@@ -1,11 +1,13 @@
 #pragma once
 
 #include "IGraphics.h"
+#include "graphics/PerFrameRenderState.h"
 #include "graphics/shader_resource/ResourceInstances.h"
 #include "ncengine/graphics/NcGraphics.h"
 #include "ncengine/module/ModuleProvider.h"
 
 #include <memory>
+#include <optional>
 
 namespace nc
 {
@@ -27,6 +29,7 @@ class NcGraphicsImpl : public NcGraphics
                        const config::MemorySettings& memorySettings,
                        Registry* registry,
                        ModuleProvider modules,
+                       const task::AsyncDispatcher& dispatcher,
                        SystemEvents& events,
                        std::unique_ptr<IGraphics> graphics,
                        window::NcWindow& window);
@@ -39,14 +42,31 @@ class NcGraphicsImpl : public NcGraphics
         void ClearEnvironment() override;
         void OnBuildTaskGraph(task::UpdateTasks& update, task::RenderTasks& render) override;
         void Clear() noexcept override;
+        void OnRenderSync() override;
         void Run();
         void OnResize(const Vector2& dimensions, bool isMinimized);
 
     private:
+        // Render state extracted from the registry, consumed by the next Run() call.
+        struct PreparedFrame
+        {
+            PerFrameRenderState state;
+            PerFrameRenderStateData stateData;
+            uint32_t frameIndex;
+        };
+
+        struct PendingResize
+        {
+            Vector2 dimensions;
+            bool isMinimized;
+        };
+
         Registry* m_registry;
         std::unique_ptr<IGraphics> m_graphics;
         AssetResources m_assetResources;
         SystemResources m_systemResources;
+        std::optional<PreparedFrame> m_preparedFrame;
+        std::optional<PendingResize> m_pendingResize;
         Connection m_onResizeConnection;
     };
 } // namespace graphics
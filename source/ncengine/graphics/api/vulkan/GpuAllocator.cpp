@@ -82,6 +82,14 @@ namespace nc::graphics::vulkan
         });
     }
 
+    void GpuAllocator::CopyBuffer(const vk::Buffer& sourceBuffer, const vk::Buffer& destinationBuffer, std::span<const vk::BufferCopy> regions)
+    {
+        m_device->ExecuteCommand([sourceBuffer, destinationBuffer, regions](vk::CommandBuffer cmd)
+        {
+            cmd.copyBuffer(sourceBuffer, destinationBuffer, static_cast<uint32_t>(regions.size()), regions.data());
+        });
+    }
+
     auto GpuAllocator::CreateBuffer(uint32_t size, vk::BufferUsageFlags usageFlags, VmaMemoryUsage usageType) -> GpuAllocation<vk::Buffer>
     {
         auto bufferInfo = VkBufferCreateInfo{};
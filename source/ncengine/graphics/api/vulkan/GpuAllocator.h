@@ -5,6 +5,7 @@
 #include "ncmath/Vector.h"
 
 #include "utility/Memory.h"
+#include <span>
 #include <utility>
 
 namespace nc::graphics::vulkan
@@ -54,6 +55,7 @@ namespace nc::graphics::vulkan
             void Unmap(VmaAllocation allocation) const;
 
             void CopyBuffer(const vk::Buffer& sourceBuffer, const vk::Buffer& destinationBuffer, const vk::DeviceSize size);
+            void CopyBuffer(const vk::Buffer& sourceBuffer, const vk::Buffer& destinationBuffer, std::span<const vk::BufferCopy> regions);
             auto CreateBuffer(uint32_t size, vk::BufferUsageFlags usageFlags, VmaMemoryUsage usageType) -> GpuAllocation<vk::Buffer>;
             auto CreateImage(vk::Format format, Vector2 dimensions, vk::ImageUsageFlags usageFlags, vk::ImageCreateFlags imageFlags, uint32_t arrayLayers, uint32_t mipLevels, vk::SampleCountFlagBits numSamples) -> GpuAllocation<vk::Image>;
             auto CreateTexture(const unsigned char* pixels, uint32_t width, uint32_t height, uint32_t mipLevels, bool isNormal) -> GpuAllocation<vk::Image>;
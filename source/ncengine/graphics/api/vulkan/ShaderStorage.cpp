@@ -200,6 +200,14 @@ void ShaderStorage::UpdateMeshArrayBuffer(const MabUpdateEventData& eventData)
             m_staticMabStorage.buffer.indices = MeshBuffer(m_allocator, eventData.indices);
             break;
         }
+        case MabUpdateAction::Update:
+        {
+            OPTICK_CATEGORY("MabUpdateAction::Update", Optick::Category::Rendering);
+
+            m_staticMabStorage.buffer.vertices.Update(m_allocator, eventData.vertices, eventData.changedVertices);
+            m_staticMabStorage.buffer.indices.Update(m_allocator, eventData.indices, eventData.changedIndices);
+            break;
+        }
         case MabUpdateAction::Bind:
         {
             OPTICK_CATEGORY("MabUpdateAction::Bind", Optick::Category::Rendering);
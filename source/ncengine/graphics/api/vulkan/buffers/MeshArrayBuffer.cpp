@@ -1,6 +1,9 @@
 #include "MeshArrayBuffer.h"
 
 #include "ncasset/Assets.h"
+#include "ncutility/NcError.h"
+
+#include <vector>
 
 namespace
 {
@@ -43,6 +46,37 @@ auto CreateBuffer(nc::graphics::vulkan::GpuAllocator* allocator, std::span<const
 
     return buffer;
 }
+
+template<class T>
+void UpdateBuffer(nc::graphics::vulkan::GpuAllocator* allocator, vk::Buffer buffer, std::span<const T> data, std::span<const nc::asset::MeshArenaRange> changed)
+{
+    auto regions = std::vector<vk::BufferCopy>{};
+    regions.reserve(changed.size());
+    auto stagingSize = vk::DeviceSize{0};
+    for (const auto& range : changed)
+    {
+        if (range.count == 0)
+            continue;
+
+        const auto size = static_cast<vk::DeviceSize>(sizeof(T) * range.count);
+        regions.emplace_back(stagingSize, sizeof(T) * range.offset, size);
+        stagingSize += size;
+    }
+
+    if (regions.empty())
+        return;
+
+    // The changed ranges arrive packed in the same order as the regions, so they can be staged with a single copy.
+    NC_ASSERT(stagingSize == data.size_bytes(), "Packed mesh data does not match the changed ranges.");
+    auto stagingBuffer = allocator->CreateBuffer(static_cast<uint32_t>(stagingSize), vk::BufferUsageFlagBits::eTransferSrc, VMA_MEMORY_USAGE_CPU_ONLY);
+    void* mappedData = allocator->Map(stagingBuffer.Allocation());
+    memcpy(mappedData, data.data(), stagingSize);
+    allocator->Unmap(stagingBuffer.Allocation());
+
+    // Scatter each range to its location in the existing buffer.
+    allocator->CopyBuffer(stagingBuffer, buffer, regions);
+    stagingBuffer.Release();
+}
 } // anonymous namespace
 
 namespace nc::graphics::vulkan
@@ -62,6 +96,16 @@ MeshBuffer::MeshBuffer(GpuAllocator* allocator, std::span<const asset::MeshVerte
 {
 }
 
+void MeshBuffer::Update(GpuAllocator* allocator, std::span<const uint32_t> data, std::span<const asset::MeshArenaRange> changed)
+{
+    UpdateBuffer(allocator, m_buffer.Data(), data, changed);
+}
+
+void MeshBuffer::Update(GpuAllocator* allocator, std::span<const asset::MeshVertex> data, std::span<const asset::MeshArenaRange> changed)
+{
+    UpdateBuffer(allocator, m_buffer.Data(), data, changed);
+}
+
 void MeshBuffer::Clear() noexcept
 {
     m_buffer.Release();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "graphics/api/vulkan/GpuAllocator.h"
+#include "asset/AssetData.h"
 
 #include "ncasset/AssetsFwd.h"
 
@@ -19,6 +20,10 @@ class MeshBuffer
         MeshBuffer& operator=(const MeshBuffer&) = delete;
         MeshBuffer(const MeshBuffer&) = delete;
 
+        /** @brief Copy only the changed ranges of data into the existing buffer. */
+        void Update(GpuAllocator* allocator, std::span<const uint32_t> data, std::span<const asset::MeshArenaRange> changed);
+        void Update(GpuAllocator* allocator, std::span<const asset::MeshVertex> data, std::span<const asset::MeshArenaRange> changed);
+
         auto GetBuffer() const noexcept -> vk::Buffer { return m_buffer; }
         void Clear() noexcept;
 
@@ -99,11 +99,9 @@ void OutlinePipeline::Bind(uint32_t frameIndex, vk::CommandBuffer* cmd)
 void OutlinePipeline::Record(vk::CommandBuffer* cmd, const PerFrameRenderState& frameData, const PerFrameInstanceData&)
 {
     OPTICK_CATEGORY("OutlinePipeline::Record", Optick::Category::Rendering);
-    uint32_t objectInstance = 0;
-    for (const auto& mesh : frameData.objectState.toonMeshes)
+    for (const auto& [mesh, firstInstance, instanceCount] : frameData.objectState.toonBatches)
     {
-        cmd->drawIndexed(mesh.indexCount, 1, mesh.firstIndex, mesh.firstVertex, objectInstance + frameData.objectState.toonMeshStartingIndex); // indexCount, instanceCount, firstIndex, vertexOffset, firstInstance
-        ++objectInstance;
+        cmd->drawIndexed(mesh.indexCount, instanceCount, mesh.firstIndex, mesh.firstVertex, firstInstance); // indexCount, instanceCount, firstIndex, vertexOffset, firstInstance
     }
 }
 
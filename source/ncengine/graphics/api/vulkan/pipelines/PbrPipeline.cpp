@@ -101,11 +101,9 @@ namespace nc::graphics::vulkan
     void PbrPipeline::Record(vk::CommandBuffer* cmd, const PerFrameRenderState& frameData, const PerFrameInstanceData&)
     {
         OPTICK_CATEGORY("PbrPipeline::Record", Optick::Category::Rendering);
-        uint32_t objectInstance = 0;
-        for (const auto& mesh : frameData.objectState.pbrMeshes)
+        for (const auto& [mesh, firstInstance, instanceCount] : frameData.objectState.pbrBatches)
         {
-            cmd->drawIndexed(mesh.indexCount, 1, mesh.firstIndex, mesh.firstVertex, objectInstance + frameData.objectState.pbrMeshStartingIndex); // indexCount, instanceCount, firstIndex, vertexOffset, firstInstance
-            ++objectInstance;
+            cmd->drawIndexed(mesh.indexCount, instanceCount, mesh.firstIndex, mesh.firstVertex, firstInstance); // indexCount, instanceCount, firstIndex, vertexOffset, firstInstance
         }
     }
 
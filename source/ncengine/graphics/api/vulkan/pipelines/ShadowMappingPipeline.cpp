@@ -121,16 +121,13 @@ namespace nc::graphics::vulkan
 
             cmd->pushConstants(m_pipelineLayout.get(), vk::ShaderStageFlagBits::eVertex, 0, sizeof(ShadowMappingPushConstants), &pushConstants);
 
-            uint32_t objectInstance = 0;
-            for (const auto& mesh : frameData.objectState.pbrMeshes)
+            for (const auto& [mesh, firstInstance, instanceCount] : frameData.objectState.pbrBatches)
             {
-                cmd->drawIndexed(mesh.indexCount, 1, mesh.firstIndex, mesh.firstVertex, objectInstance); // indexCount, instanceCount, firstIndex, vertexOffset, firstInstance
-                objectInstance++;
+                cmd->drawIndexed(mesh.indexCount, instanceCount, mesh.firstIndex, mesh.firstVertex, firstInstance); // indexCount, instanceCount, firstIndex, vertexOffset, firstInstance
             }
-            for (const auto& mesh : frameData.objectState.toonMeshes)
+            for (const auto& [mesh, firstInstance, instanceCount] : frameData.objectState.toonBatches)
             {
-                cmd->drawIndexed(mesh.indexCount, 1, mesh.firstIndex, mesh.firstVertex, objectInstance); // indexCount, instanceCount, firstIndex, vertexOffset, firstInstance
-                objectInstance++;
+                cmd->drawIndexed(mesh.indexCount, instanceCount, mesh.firstIndex, mesh.firstVertex, firstInstance); // indexCount, instanceCount, firstIndex, vertexOffset, firstInstance
             }
             return;
         }
@@ -140,16 +137,13 @@ namespace nc::graphics::vulkan
 
         cmd->pushConstants(m_pipelineLayout.get(), vk::ShaderStageFlagBits::eVertex, 0, sizeof(ShadowMappingPushConstants), &pushConstants);
 
-        uint32_t objectInstance = 0;
-        for (const auto& mesh : frameData.objectState.pbrMeshes)
+        for (const auto& [mesh, firstInstance, instanceCount] : frameData.objectState.pbrBatches)
         {
-            cmd->drawIndexed(mesh.indexCount, 1, mesh.firstIndex, mesh.firstVertex, objectInstance); // indexCount, instanceCount, firstIndex, vertexOffset, firstInstance
-            objectInstance++;
+            cmd->drawIndexed(mesh.indexCount, instanceCount, mesh.firstIndex, mesh.firstVertex, firstInstance); // indexCount, instanceCount, firstIndex, vertexOffset, firstInstance
         }
-        for (const auto& mesh : frameData.objectState.toonMeshes)
+        for (const auto& [mesh, firstInstance, instanceCount] : frameData.objectState.toonBatches)
         {
-            cmd->drawIndexed(mesh.indexCount, 1, mesh.firstIndex, mesh.firstVertex, objectInstance); // indexCount, instanceCount, firstIndex, vertexOffset, firstInstance
-            objectInstance++;
+            cmd->drawIndexed(mesh.indexCount, instanceCount, mesh.firstIndex, mesh.firstVertex, firstInstance); // indexCount, instanceCount, firstIndex, vertexOffset, firstInstance
         }
     }
 } // namespace nc::graphics::vulkan
@@ -0,0 +1,123 @@
+#include "AssetUpdateQueue.h"
+#include "graphics/shader_resource/CubeMapArrayBufferHandle.h"
+#include "graphics/shader_resource/MeshArrayBufferHandle.h"
+#include "graphics/shader_resource/TextureArrayBufferHandle.h"
+
+#include <algorithm>
+
+namespace
+{
+template<class Handle, class T>
+void Forward(Handle& handle, nc::asset::UpdateAction action, std::span<const T> data)
+{
+    switch (action)
+    {
+        case nc::asset::UpdateAction::Load:
+        {
+            handle.Add(data);
+            break;
+        }
+        case nc::asset::UpdateAction::Unload:
+        {
+            handle.Remove(data);
+            break;
+        }
+        case nc::asset::UpdateAction::UnloadAll:
+        {
+            handle.Clear();
+            break;
+        }
+    }
+}
+
+template<class T>
+void Pack(std::span<const T> arena, std::span<const nc::asset::MeshArenaRange> ranges, std::vector<T>& out)
+{
+    for (const auto& range : ranges)
+    {
+        const auto data = arena.subspan(range.offset, range.count);
+        out.insert(out.end(), data.begin(), data.end());
+    }
+}
+
+template<class T>
+void Patch(std::span<const T> arena, std::span<const nc::asset::MeshArenaRange> ranges, std::vector<T>& out)
+{
+    for (const auto& range : ranges)
+    {
+        std::ranges::copy(arena.subspan(range.offset, range.count), out.begin() + range.offset);
+    }
+}
+} // anonymous namespace
+
+namespace nc::graphics
+{
+void AssetUpdateQueue::Push(const asset::MeshUpdateEventData& eventData)
+{
+    // A reallocated arena must be uploaded whole, which supersedes anything queued before it.
+    if (eventData.reallocate)
+    {
+        m_meshUpdates.clear();
+        m_meshArena = MeshArena{
+            {eventData.vertices.begin(), eventData.vertices.end()},
+            {eventData.indices.begin(), eventData.indices.end()}
+        };
+
+        return;
+    }
+
+    if (m_meshArena)
+    {
+        ::Patch(eventData.vertices, eventData.changedVertices, m_meshArena->vertices);
+        ::Patch(eventData.indices, eventData.changedIndices, m_meshArena->indices);
+        return;
+    }
+
+    auto& update = m_meshUpdates.emplace_back();
+    ::Pack(eventData.vertices, eventData.changedVertices, update.vertices);
+    ::Pack(eventData.indices, eventData.changedIndices, update.indices);
+    update.changedVertices.assign(eventData.changedVertices.begin(), eventData.changedVertices.end());
+    update.changedIndices.assign(eventData.changedIndices.begin(), eventData.changedIndices.end());
+}
+
+void AssetUpdateQueue::Push(const asset::CubeMapUpdateEventData& eventData)
+{
+    m_cubeMaps.emplace_back(eventData.updateAction, std::vector<asset::CubeMapWithId>{eventData.data.begin(), eventData.data.end()});
+}
+
+void AssetUpdateQueue::Push(const asset::TextureUpdateEventData& eventData)
+{
+    m_textures.emplace_back(eventData.updateAction, std::vector<asset::TextureWithId>{eventData.data.begin(), eventData.data.end()});
+}
+
+void AssetUpdateQueue::Apply(MeshArrayBufferHandle& meshes,
+                             CubeMapArrayBufferHandle& cubeMaps,
+                             TextureArrayBufferHandle& textures)
+{
+    if (m_meshArena)
+    {
+        meshes.Initialize(m_meshArena->vertices, m_meshArena->indices);
+        m_meshArena.reset();
+    }
+
+    // Ranges from separate updates may overlap if a freed range was reused, so each is uploaded in turn.
+    for (const auto& update : m_meshUpdates)
+    {
+        meshes.Update(update.vertices, update.indices, update.changedVertices, update.changedIndices);
+    }
+
+    for (const auto& [action, data] : m_cubeMaps)
+    {
+        ::Forward(cubeMaps, action, std::span<const asset::CubeMapWithId>{data});
+    }
+
+    for (const auto& [action, data] : m_textures)
+    {
+        ::Forward(textures, action, std::span<const asset::TextureWithId>{data});
+    }
+
+    m_meshUpdates.clear();
+    m_cubeMaps.clear();
+    m_textures.clear();
+}
+} // namespace nc::graphics
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "asset/AssetData.h"
+
+#include <optional>
+#include <vector>
+
+namespace nc::graphics
+{
+class CubeMapArrayBufferHandle;
+class MeshArrayBufferHandle;
+class TextureArrayBufferHandle;
+
+/**
+ * @brief Holds asset updates until they can be forwarded to the backend without racing an in-flight render.
+ *
+ * Asset modules emit updates whenever assets are loaded or unloaded, which may be while a previous frame is still
+ * being recorded. Event data only references storage owned by the asset managers, so it is copied on Push(). Mesh
+ * updates only copy their changed ranges, packed back to back, unless the arena was reallocated, in which case the
+ * whole arena is captured and later changes are patched into it. All updates are replayed in order.
+ */
+class AssetUpdateQueue
+{
+    public:
+        void Push(const asset::MeshUpdateEventData& eventData);
+        void Push(const asset::CubeMapUpdateEventData& eventData);
+        void Push(const asset::TextureUpdateEventData& eventData);
+
+        /** @brief Forward all queued updates to the backend. Must not be called while rendering is in progress. */
+        void Apply(MeshArrayBufferHandle& meshes,
+                   CubeMapArrayBufferHandle& cubeMaps,
+                   TextureArrayBufferHandle& textures);
+
+        auto empty() const noexcept -> bool
+        {
+            return !m_meshArena && m_meshUpdates.empty() && m_cubeMaps.empty() && m_textures.empty();
+        }
+
+    private:
+        struct MeshArena
+        {
+            std::vector<asset::MeshVertex> vertices;
+            std::vector<uint32_t> indices;
+        };
+
+        struct PendingMeshUpdate
+        {
+            std::vector<asset::MeshVertex> vertices; // packed changed vertex ranges
+            std::vector<uint32_t> indices;           // packed changed index ranges
+            std::vector<asset::MeshArenaRange> changedVertices;
+            std::vector<asset::MeshArenaRange> changedIndices;
+        };
+
+        template<class T>
+        struct PendingUpdate
+        {
+            asset::UpdateAction action;
+            std::vector<T> data;
+        };
+
+        std::optional<MeshArena> m_meshArena;
+        std::vector<PendingMeshUpdate> m_meshUpdates;
+        std::vector<PendingUpdate<asset::CubeMapWithId>> m_cubeMaps;
+        std::vector<PendingUpdate<asset::TextureWithId>> m_textures;
+};
+} // namespace nc::graphics
@@ -16,11 +16,30 @@ void MeshArrayBufferHandle::Initialize(std::span<const asset::MeshVertex> vertic
             std::numeric_limits<uint32_t>::max(),
             vertices,
             indices,
+            std::span<const asset::MeshArenaRange>{},
+            std::span<const asset::MeshArenaRange>{},
             MabUpdateAction::Initialize
         }
     );
 }
 
+void MeshArrayBufferHandle::Update(std::span<const asset::MeshVertex> vertices,
+                                   std::span<const uint32_t> indices,
+                                   std::span<const asset::MeshArenaRange> changedVertices,
+                                   std::span<const asset::MeshArenaRange> changedIndices)
+{
+    m_backendPort->Emit(
+        MabUpdateEventData
+        {
+            std::numeric_limits<uint32_t>::max(),
+            vertices,
+            indices,
+            changedVertices,
+            changedIndices,
+            MabUpdateAction::Update
+        }
+    );
+}
 
 void MeshArrayBufferHandle::Bind(uint32_t frameIndex)
 {
@@ -30,6 +49,8 @@ void MeshArrayBufferHandle::Bind(uint32_t frameIndex)
             frameIndex,
             std::span<const asset::MeshVertex>{},
             std::span<const uint32_t>{},
+            std::span<const asset::MeshArenaRange>{},
+            std::span<const asset::MeshArenaRange>{},
             MabUpdateAction::Bind
         }
     );
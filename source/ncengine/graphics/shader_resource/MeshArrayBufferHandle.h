@@ -15,14 +15,21 @@ namespace nc::graphics
 enum class MabUpdateAction : uint8_t
 {
     Initialize,
+    Update,
     Bind
 };
 
+/**
+ * @brief Mesh buffer update data. For Initialize, vertices and indices hold the entire arena. For Update, they only
+ *        hold the data for the changed ranges, packed back to back in range order.
+ */
 struct MabUpdateEventData
 {
     uint32_t frameIndex;
     std::span<const asset::MeshVertex> vertices;
     std::span<const uint32_t> indices;
+    std::span<const asset::MeshArenaRange> changedVertices;
+    std::span<const asset::MeshArenaRange> changedIndices;
     MabUpdateAction action;
 };
 
@@ -31,6 +38,10 @@ class MeshArrayBufferHandle
     public:
         MeshArrayBufferHandle(Signal<const MabUpdateEventData&>* backendPort);
         void Initialize(std::span<const asset::MeshVertex> vertices, std::span<const uint32_t> indices);
+        void Update(std::span<const asset::MeshVertex> vertices,
+                    std::span<const uint32_t> indices,
+                    std::span<const asset::MeshArenaRange> changedVertices,
+                    std::span<const asset::MeshArenaRange> changedIndices);
         void Bind(uint32_t frameIndex);
 
     private:
@@ -20,51 +20,28 @@ AssetResources::AssetResources(AssetResourcesConfig config, ShaderResourceBus* r
 
 void AssetResources::ForwardMeshAssetData(const asset::MeshUpdateEventData& assetData)
 {
-    meshes.Initialize(assetData.vertices, assetData.indices);
+    pendingUpdates.Push(assetData);
+    if (!renderInFlight)
+        ApplyPendingUpdates();
 }
 
 void AssetResources::ForwardTextureAssetData(const asset::TextureUpdateEventData& assetData)
 {
-    switch (assetData.updateAction)
-    {
-        case asset::UpdateAction::Load:
-        {
-            textures.Add(assetData.data);
-            break;
-        }
-        case asset::UpdateAction::Unload:
-        {
-            textures.Remove(assetData.data);
-            break;
-        }
-        case asset::UpdateAction::UnloadAll:
-        {
-            textures.Clear();
-            break;
-        }
-    }
+    pendingUpdates.Push(assetData);
+    if (!renderInFlight)
+        ApplyPendingUpdates();
 }
 
 void AssetResources::ForwardCubeMapAssetData(const asset::CubeMapUpdateEventData& assetData)
 {
-    switch (assetData.updateAction)
-    {
-        case asset::UpdateAction::Load:
-        {
-            cubeMaps.Add(assetData.data);
-            break;
-        }
-        case asset::UpdateAction::Unload:
-        {
-            cubeMaps.Remove(assetData.data);
-            break;
-        }
-        case asset::UpdateAction::UnloadAll:
-        {
-            cubeMaps.Clear();
-            break;
-        }
-    }
+    pendingUpdates.Push(assetData);
+    if (!renderInFlight)
+        ApplyPendingUpdates();
+}
+
+void AssetResources::ApplyPendingUpdates()
+{
+    pendingUpdates.Apply(meshes, cubeMaps, textures);
 }
 
 SystemResourcesConfig::SystemResourcesConfig(const config::GraphicsSettings& graphicsSettings, const config::MemorySettings& memorySettings)
@@ -81,13 +58,14 @@ SystemResources::SystemResources(SystemResourcesConfig config,
                                 Registry* registry,
                                 ShaderResourceBus* resourceBus,
                                 ModuleProvider modules,
+                                const task::AsyncDispatcher& dispatcher,
                                 SystemEvents& events,
                                 std::function<graphics::Camera* ()> getCamera)
     : cameras{},
       environment{resourceBus},
       lights{resourceBus, config.maxPointLights, config.maxSpotLights, config.useShadows},
-      objects{resourceBus, config.maxRenderers},
-      skeletalAnimations{registry, resourceBus, config.maxSkeletalAnimations, modules.Get<asset::NcAsset>()->OnSkeletalAnimationUpdate(), modules.Get<asset::NcAsset>()->OnBoneUpdate()},
+      objects{registry, resourceBus, config.maxRenderers, dispatcher, events},
+      skeletalAnimations{registry, resourceBus, config.maxSkeletalAnimations, dispatcher, modules.Get<asset::NcAsset>()->OnSkeletalAnimationUpdate(), modules.Get<asset::NcAsset>()->OnBoneUpdate()},
       widgets{},
       ui{registry->GetEcs(), modules, events},
       particleEmitters{registry, resourceBus, getCamera, config.maxParticles}
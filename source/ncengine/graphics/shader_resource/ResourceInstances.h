@@ -1,5 +1,6 @@
 #pragma once
 
+#include "graphics/shader_resource/AssetUpdateQueue.h"
 #include "graphics/shader_resource/CubeMapArrayBufferHandle.h"
 #include "graphics/shader_resource/MeshArrayBufferHandle.h"
 #include "graphics/shader_resource/TextureArrayBufferHandle.h"
@@ -17,6 +18,8 @@
 #include "ncengine/graphics/NcGraphics.h"
 #include "ncengine/module/ModuleProvider.h"
 
+#include <atomic>
+
 namespace config
 {
 struct GraphicsSettings;
@@ -48,6 +51,12 @@ struct AssetResources
     TextureArrayBufferHandle textures;
     nc::Connection onTextureArrayBufferUpdate;
     void ForwardTextureAssetData(const asset::TextureUpdateEventData& assetData);
+
+    // Asset updates may arrive while a frame is rendering (with EngineSettings::pipelineRender), in which case they're
+    // held until the next render sync point. Otherwise they're forwarded immediately.
+    AssetUpdateQueue pendingUpdates;
+    std::atomic<bool> renderInFlight = false;
+    void ApplyPendingUpdates();
 };
 
 struct SystemResourcesConfig
@@ -69,6 +78,7 @@ struct SystemResources
                     Registry* registry,
                     ShaderResourceBus* resourceBus,
                     ModuleProvider modules,
+                    const task::AsyncDispatcher& dispatcher,
                     SystemEvents& events,
                     std::function<graphics::Camera* ()> getCamera);
     CameraSystem cameras;
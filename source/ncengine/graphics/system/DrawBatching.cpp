@@ -0,0 +1,68 @@
+#include "DrawBatching.h"
+
+#include <array>
+#include <utility>
+
+namespace
+{
+constexpr auto g_digitBits = 8u;
+constexpr auto g_digitCount = size_t{1} << g_digitBits;
+constexpr auto g_passCount = 64u / g_digitBits;
+
+auto Digit(uint64_t key, unsigned pass) -> size_t
+{
+    return static_cast<size_t>((key >> (pass * g_digitBits)) & (g_digitCount - 1));
+}
+} // anonymous namespace
+
+namespace nc::graphics
+{
+void RadixSort(std::vector<DrawKey>& keys, std::vector<DrawKey>& scratch)
+{
+    const auto count = keys.size();
+    if (count < 2)
+    {
+        return;
+    }
+
+    // Histogram every digit in a single read of the keys
+    auto histograms = std::array<std::array<uint32_t, g_digitCount>, g_passCount>{};
+    for (const auto& [key, object] : keys)
+    {
+        for (auto pass = 0u; pass < g_passCount; ++pass)
+        {
+            ++histograms[pass][Digit(key, pass)];
+        }
+    }
+
+    scratch.resize(count);
+    auto* src = &keys;
+    auto* dst = &scratch;
+    for (auto pass = 0u; pass < g_passCount; ++pass)
+    {
+        auto& histogram = histograms[pass];
+        if (histogram[Digit(src->front().key, pass)] == count)
+        {
+            continue;
+        }
+
+        auto offset = uint32_t{0};
+        for (auto& bucket : histogram)
+        {
+            offset += std::exchange(bucket, offset);
+        }
+
+        for (const auto& item : *src)
+        {
+            (*dst)[histogram[Digit(item.key, pass)]++] = item;
+        }
+
+        std::swap(src, dst);
+    }
+
+    if (src != &keys)
+    {
+        keys.swap(scratch);
+    }
+}
+} // namespace nc::graphics
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "ncengine/asset/AssetViews.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace nc::graphics
+{
+/** A run of consecutive instances sharing a mesh, recorded as a single instanced draw. */
+struct DrawBatch
+{
+    asset::MeshView mesh;
+    uint32_t firstInstance;
+    uint32_t instanceCount;
+};
+
+/** Sort key paired with the index of the object it was built from. */
+struct DrawKey
+{
+    uint64_t key;
+    uint32_t object;
+};
+
+/** Build a key grouping objects by mesh, then by material within a mesh. Meshes are suballocated from a shared
+ *  vertex arena, so a mesh's first vertex identifies it. */
+constexpr auto MakeDrawKey(const asset::MeshView& mesh, uint32_t material) noexcept -> uint64_t
+{
+    return (static_cast<uint64_t>(mesh.firstVertex) << 32) | material;
+}
+
+/** Stable LSD radix sort on DrawKey::key. Byte passes where every key shares a digit are skipped, so sorting a few
+ *  distinct meshes costs only the passes their keys differ in. scratch is used as a swap buffer. */
+void RadixSort(std::vector<DrawKey>& keys, std::vector<DrawKey>& scratch);
+
+/** Append an instance to batches, extending the last batch if it draws the same mesh and directly precedes it. */
+inline void AppendInstance(std::vector<DrawBatch>& batches, const asset::MeshView& mesh, uint32_t instance)
+{
+    if (!batches.empty())
+    {
+        auto& last = batches.back();
+        if (last.mesh.firstVertex == mesh.firstVertex &&
+            last.mesh.firstIndex == mesh.firstIndex &&
+            last.firstInstance + last.instanceCount == instance)
+        {
+            ++last.instanceCount;
+            return;
+        }
+    }
+
+    batches.push_back(DrawBatch{mesh, instance, 1u});
+}
+} // namespace nc::graphics
@@ -0,0 +1,102 @@
+#include "FrustumCulling.h"
+
+#include "ncmath/MatrixUtilities.h"
+
+#include <cassert>
+#include <limits>
+
+namespace
+{
+constexpr auto g_invalidRevision = std::numeric_limits<uint64_t>::max();
+
+auto Splat(const nc::Plane& plane) -> nc::graphics::CullingFrustum::SplatPlane
+{
+    return nc::graphics::CullingFrustum::SplatPlane
+    {
+        DirectX::XMVectorReplicate(plane.normal.x),
+        DirectX::XMVectorReplicate(plane.normal.y),
+        DirectX::XMVectorReplicate(plane.normal.z),
+        DirectX::XMVectorReplicate(plane.d)
+    };
+}
+} // anonymous namespace
+
+namespace nc::graphics
+{
+auto BuildCullingFrustum(const Frustum& frustum) -> CullingFrustum
+{
+    return CullingFrustum
+    {{
+        ::Splat(frustum.front),
+        ::Splat(frustum.left),
+        ::Splat(frustum.right),
+        ::Splat(frustum.top),
+        ::Splat(frustum.bottom),
+        ::Splat(frustum.back)
+    }};
+}
+
+void CullSpheres(const CullingFrustum& frustum,
+                 const float* x,
+                 const float* y,
+                 const float* z,
+                 const float* radius,
+                 size_t count,
+                 uint8_t* visible) noexcept
+{
+    using namespace DirectX;
+    assert(count % CullingLaneCount == 0);
+    const auto zero = XMVectorZero();
+    for (auto i = size_t{0}; i < count; i += CullingLaneCount)
+    {
+        const auto cx = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(x + i));
+        const auto cy = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(y + i));
+        const auto cz = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(z + i));
+        const auto r = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(radius + i));
+
+        // A sphere is culled only if it lies entirely behind some plane: dot(n, c) - d < -r
+        auto inside = XMVectorTrueInt();
+        for (const auto& plane : frustum.planes)
+        {
+            const auto distance = XMVectorMultiplyAdd(plane.x, cx,
+                                  XMVectorMultiplyAdd(plane.y, cy,
+                                  XMVectorMultiplyAdd(plane.z, cz, XMVectorSubtract(r, plane.d))));
+            inside = XMVectorAndInt(inside, XMVectorGreaterOrEqual(distance, zero));
+        }
+
+        auto mask = XMUINT4{};
+        XMStoreUInt4(&mask, inside);
+        visible[i] = static_cast<uint8_t>(mask.x & 1u);
+        visible[i + 1] = static_cast<uint8_t>(mask.y & 1u);
+        visible[i + 2] = static_cast<uint8_t>(mask.z & 1u);
+        visible[i + 3] = static_cast<uint8_t>(mask.w & 1u);
+    }
+}
+
+auto ComputeBoundingSphere(float meshExtent, DirectX::FXMMATRIX worldMatrix) noexcept -> Sphere
+{
+    auto sphere = Sphere{};
+    DirectX::XMStoreVector3(&sphere.center, worldMatrix.r[3]);
+    sphere.radius = GetMaxScaleExtent(worldMatrix) * meshExtent;
+    return sphere;
+}
+
+void BoundingSphereCache::Resize(size_t count)
+{
+    m_keys.resize(count, SphereKey{g_invalidRevision, 0.0f});
+    m_spheres.resize(count);
+}
+
+auto BoundingSphereCache::Update(size_t index, uint64_t revision, float meshExtent, DirectX::FXMMATRIX worldMatrix) -> bool
+{
+    auto& key = m_keys[index];
+    if (key.revision == revision && key.meshExtent == meshExtent)
+    {
+        return false;
+    }
+
+    key = SphereKey{revision, meshExtent};
+    m_spheres[index] = ComputeBoundingSphere(meshExtent, worldMatrix);
+    return true;
+}
+} // namespace nc::graphics
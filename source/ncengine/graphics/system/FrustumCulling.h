@@ -0,0 +1,76 @@
+#pragma once
+
+#include "ncmath/Geometry.h"
+
+#include "DirectXMath.h"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace nc::graphics
+{
+/** Number of spheres tested against a plane at once. */
+constexpr auto CullingLaneCount = size_t{4};
+
+/** Frustum planes splatted across SIMD lanes so a plane can be tested against four spheres at once. */
+struct CullingFrustum
+{
+    struct SplatPlane
+    {
+        DirectX::XMVECTOR x;
+        DirectX::XMVECTOR y;
+        DirectX::XMVECTOR z;
+        DirectX::XMVECTOR d;
+    };
+
+    std::array<SplatPlane, 6> planes;
+};
+
+auto BuildCullingFrustum(const Frustum& frustum) -> CullingFrustum;
+
+/** Write a visibility flag for each sphere in packed coordinate arrays. count must be a multiple of
+ *  CullingLaneCount; pad with a radius of std::numeric_limits<float>::lowest() to guarantee a lane is culled. */
+void CullSpheres(const CullingFrustum& frustum,
+                 const float* x,
+                 const float* y,
+                 const float* z,
+                 const float* radius,
+                 size_t count,
+                 uint8_t* visible) noexcept;
+
+/** Get the world space bounding sphere of a mesh with the given max extent. */
+auto ComputeBoundingSphere(float meshExtent, DirectX::FXMMATRIX worldMatrix) noexcept -> Sphere;
+
+/**
+ * World space bounding spheres for renderers.
+ *
+ * Each slot remembers the Transform revision and mesh extent it was built from, so it is only recomputed when one
+ * of them changes.
+ */
+class BoundingSphereCache
+{
+    public:
+        /** Set the number of spheres, discarding slots past count. */
+        void Resize(size_t count);
+
+        /** Refresh the sphere at index if the revision or mesh extent differ from what it was built from.
+         *  @return True if the sphere was recomputed. */
+        auto Update(size_t index, uint64_t revision, float meshExtent, DirectX::FXMMATRIX worldMatrix) -> bool;
+
+        auto GetSphere(size_t index) const noexcept -> const Sphere& { return m_spheres[index]; }
+        auto Spheres() const noexcept -> std::span<const Sphere> { return m_spheres; }
+        auto Size() const noexcept -> size_t { return m_spheres.size(); }
+
+    private:
+        struct SphereKey
+        {
+            uint64_t revision;
+            float meshExtent;
+        };
+
+        std::vector<Sphere> m_spheres;
+        std::vector<SphereKey> m_keys;
+};
+} // namespace nc::graphics
@@ -3,61 +3,20 @@
 #include "EnvironmentSystem.h"
 #include "SkeletalAnimationSystem.h"
 #include "graphics/Camera.h"
+#include "ncengine/Events.h"
 
-#include "ncmath/MatrixUtilities.h"
 #include "optick.h"
 
-namespace
-{
-enum class HalfspaceContainment
-{
-    Intersecting,
-    Positive,
-    Negative
-};
+#include <algorithm>
+#include <array>
 
-auto TestHalfspace(const nc::Plane& plane, const nc::Sphere& sphere) -> HalfspaceContainment
-{
-    float dist = nc::Dot(plane.normal, sphere.center) - plane.d;
-
-    if(std::abs(dist) <= sphere.radius)
-        return HalfspaceContainment::Intersecting;
-    else if(dist > 0.0f)
-        return HalfspaceContainment::Positive;
-    
-    return HalfspaceContainment::Negative;
-}
-
-bool Intersect(const nc::Frustum& a, const nc::Sphere& b)
+namespace
 {
-    if(auto space = TestHalfspace(a.front, b); space != HalfspaceContainment::Positive)
-        return space == HalfspaceContainment::Intersecting ? true : false;
+// Trees with fewer items than this are queried on the calling thread.
+constexpr auto g_parallelQueryThreshold = size_t{8192};
 
-    if(auto space = TestHalfspace(a.left, b); space != HalfspaceContainment::Positive)
-        return space == HalfspaceContainment::Intersecting ? true : false;
-
-    if(auto space = TestHalfspace(a.right, b); space != HalfspaceContainment::Positive)
-        return space == HalfspaceContainment::Intersecting ? true : false;
-
-    if(auto space = TestHalfspace(a.top, b); space != HalfspaceContainment::Positive)
-        return space == HalfspaceContainment::Intersecting ? true : false;
-
-    if(auto space = TestHalfspace(a.bottom, b); space != HalfspaceContainment::Positive)
-        return space == HalfspaceContainment::Intersecting ? true : false;
-
-    if(auto space = TestHalfspace(a.back, b); space != HalfspaceContainment::Positive)
-        return space == HalfspaceContainment::Intersecting ? true : false;
-
-    return true;
-}
-
-bool IsViewedByFrustum(const nc::Frustum& frustum, float maxMeshExtent, DirectX::FXMMATRIX transform)
-{
-    const auto maxScaleExtent = nc::GetMaxScaleExtent(transform);
-    auto sphere = nc::Sphere{ .center = nc::Vector3::Zero(), .radius = maxScaleExtent * maxMeshExtent };
-    DirectX::XMStoreVector3(&sphere.center, transform.r[3]);
-    return Intersect(frustum, sphere);
-}
+// Refitting keeps the dynamic tree's structure, which degrades as objects move apart. Rebuild it periodically.
+constexpr auto g_dynamicRebuildInterval = 120u;
 
 template<typename T>
 concept AnimatableComponent = std::same_as<T, nc::graphics::MeshRenderer> || std::same_as<T, nc::graphics::ToonRenderer>;
@@ -65,13 +24,29 @@ concept AnimatableComponent = std::same_as<T, nc::graphics::MeshRenderer> || std
 template <AnimatableComponent T>
 uint32_t GetSkeletalAnimationIndex(const T* renderer, const nc::graphics::SkeletalAnimationSystemState& state)
 {
-    auto iter = state.animationIndices.find(renderer->ParentEntity().Index());
-    return iter != state.animationIndices.end() ? iter->second : UINT32_MAX;
+    const auto index = renderer->ParentEntity().Index();
+    return index < state.animationIndices.size() ? state.animationIndices[index] : UINT32_MAX;
 }
 } // anonymous namespace
 
 namespace nc::graphics
 {
+ObjectSystem::ObjectSystem(Registry* registry,
+                           ShaderResourceBus* shaderResourceBus,
+                           uint32_t maxObjects,
+                           const task::AsyncDispatcher& dispatcher,
+                           SystemEvents& events)
+    : m_registry{registry},
+      m_objectDataBuffer{shaderResourceBus->CreateStorageBuffer(sizeof(ObjectData) * maxObjects, ShaderStage::Fragment | ShaderStage::Vertex, 0, 0, false)},
+      m_dispatcher{dispatcher},
+      m_visibility(registry->GetImpl().GetMaxEntities(), 0),
+      m_rebuildStaticsConnection{events.rebuildStatics.Connect([this]()
+      {
+          m_rebuildStatics.store(true, std::memory_order_relaxed);
+      })}
+{
+}
+
 auto ObjectSystem::Execute(uint32_t frameIndex,
                            MultiView<MeshRenderer, Transform> pbrRenderers,
                            MultiView<ToonRenderer, Transform> toonRenderers,
@@ -80,44 +55,86 @@ auto ObjectSystem::Execute(uint32_t frameIndex,
                            const SkeletalAnimationSystemState& skeletalAnimationState) -> ObjectState
 {
     OPTICK_CATEGORY("ObjectSystem::Execute", Optick::Category::Rendering);
-    auto frontendState = ObjectState{};
-    const auto maxPbrRenderers = pbrRenderers.size_upper_bound();
-    const auto maxToonRenderers = toonRenderers.size_upper_bound();
-    frontendState.pbrMeshes.reserve(maxPbrRenderers);
-    frontendState.toonMeshes.reserve(maxToonRenderers);
-    m_objectData.clear();
-    m_objectData.reserve(maxPbrRenderers + maxToonRenderers);
-
+    m_pbrCandidates.clear();
+    m_toonCandidates.clear();
+    m_dynamicPbr.clear();
+    m_dynamicToon.clear();
     for (const auto& [renderer, transform] : pbrRenderers)
     {
-        const auto& modelMatrix = transform->TransformationMatrix();
-        if (!IsViewedByFrustum(cameraState.frustum, renderer->GetMeshView().maxExtent, modelMatrix))
+        if (!renderer->ParentEntity().IsStatic())
         {
-            continue;
+            m_dynamicPbr.push_back(static_cast<uint32_t>(m_pbrCandidates.size()));
         }
 
-        const auto skeletalAnimationIndex = GetSkeletalAnimationIndex(renderer, skeletalAnimationState);
-        const auto& [base, normal, roughness, metallic] = renderer->GetMaterialView();
-        m_objectData.emplace_back(modelMatrix, base.index, normal.index, roughness.index, metallic.index, skeletalAnimationIndex);
-        frontendState.pbrMeshes.push_back(renderer->GetMeshView());
+        m_pbrCandidates.emplace_back(renderer, transform);
     }
 
-    frontendState.pbrMeshStartingIndex = 0u;
-
     for (const auto& [renderer, transform] : toonRenderers)
     {
-        const auto& modelMatrix = transform->TransformationMatrix();
-        if (!IsViewedByFrustum(cameraState.frustum, renderer->GetMeshView().maxExtent, modelMatrix))
+        if (!renderer->ParentEntity().IsStatic())
         {
-            continue;
+            m_dynamicToon.push_back(static_cast<uint32_t>(m_toonCandidates.size()));
         }
 
+        m_toonCandidates.emplace_back(renderer, transform);
+    }
+
+    SyncStaticTree();
+    SyncDynamicTree();
+    CullRenderers(cameraState.frustum);
+
+    m_pbrKeys.clear();
+    m_toonKeys.clear();
+    for (auto i = 0u; i < m_pbrCandidates.size(); ++i)
+    {
+        const auto& renderer = m_pbrCandidates[i].first;
+        if (m_visibility[renderer->ParentEntity().Index()])
+        {
+            m_pbrKeys.emplace_back(MakeDrawKey(renderer->GetMeshView(), renderer->GetMaterialView().baseColor.index), i);
+        }
+    }
+
+    for (auto i = 0u; i < m_toonCandidates.size(); ++i)
+    {
+        const auto& renderer = m_toonCandidates[i].first;
+        if (m_visibility[renderer->ParentEntity().Index()])
+        {
+            m_toonKeys.emplace_back(MakeDrawKey(renderer->GetMeshView(), renderer->GetMaterialView().baseColor.index), i);
+        }
+    }
+
+    {
+        OPTICK_CATEGORY("ObjectSystem::SortDraws", Optick::Category::Rendering);
+        RadixSort(m_pbrKeys, m_sortScratch);
+        RadixSort(m_toonKeys, m_sortScratch);
+    }
+
+    // Object data is written in sorted order so each batch covers a contiguous instance range
+    auto frontendState = ObjectState{};
+    m_objectData.clear();
+    m_objectData.reserve(m_pbrKeys.size() + m_toonKeys.size() + 1);
+
+    for (const auto& drawKey : m_pbrKeys)
+    {
+        const auto& [renderer, transform] = m_pbrCandidates[drawKey.object];
+        const auto skeletalAnimationIndex = GetSkeletalAnimationIndex(renderer, skeletalAnimationState);
+        const auto& [base, normal, roughness, metallic] = renderer->GetMaterialView();
+        AppendInstance(frontendState.pbrBatches, renderer->GetMeshView(), static_cast<uint32_t>(m_objectData.size()));
+        m_objectData.emplace_back(transform->TransformationMatrix(), base.index, normal.index, roughness.index, metallic.index, skeletalAnimationIndex);
+    }
+
+    frontendState.pbrInstanceCount = static_cast<uint32_t>(m_pbrKeys.size());
+
+    for (const auto& drawKey : m_toonKeys)
+    {
+        const auto& [renderer, transform] = m_toonCandidates[drawKey.object];
         const auto skeletalAnimationIndex = GetSkeletalAnimationIndex(renderer, skeletalAnimationState);
         const auto& [baseColor, outlineWidth, hatching, hatchingTiling] = renderer->GetMaterialView();
-        m_objectData.emplace_back(modelMatrix, baseColor.index, outlineWidth, hatching.index, hatchingTiling, skeletalAnimationIndex);
-        frontendState.toonMeshes.push_back(renderer->GetMeshView());
+        AppendInstance(frontendState.toonBatches, renderer->GetMeshView(), static_cast<uint32_t>(m_objectData.size()));
+        m_objectData.emplace_back(transform->TransformationMatrix(), baseColor.index, outlineWidth, hatching.index, hatchingTiling, skeletalAnimationIndex);
     }
-    frontendState.toonMeshStartingIndex = static_cast<uint32_t>(frontendState.pbrMeshes.size());
+
+    frontendState.toonInstanceCount = static_cast<uint32_t>(m_toonKeys.size());
 
     if (environmentState.useSkybox)
     {
@@ -130,4 +147,148 @@ auto ObjectSystem::Execute(uint32_t frameIndex,
     m_objectDataBuffer.Bind(m_objectData, frameIndex);
     return frontendState;
 }
+
+void ObjectSystem::QueryRenderers(const Frustum& frustum, uint8_t* visible) const
+{
+    m_staticTree.Query(frustum, visible);
+    m_dynamicTree.Query(frustum, visible);
+}
+
+void ObjectSystem::QueryRenderers(const Sphere& volume, std::vector<uint32_t>& out) const
+{
+    m_staticTree.Query(volume, out);
+    m_dynamicTree.Query(volume, out);
+}
+
+void ObjectSystem::Clear()
+{
+    m_objectDataBuffer.Clear();
+    m_staticTree.Clear();
+    m_dynamicTree.Clear();
+    m_staticRenderers.clear();
+    m_builtDynamicIds.clear();
+    m_pbrPoolVersion = UINT64_MAX;
+    m_toonPoolVersion = UINT64_MAX;
+    std::ranges::fill(m_visibility, uint8_t{0});
+}
+
+void ObjectSystem::SyncStaticTree()
+{
+    // Static membership can only change when a renderer pool does. Pools also change when renderers are reordered
+    // (e.g. by owning group swaps), so the gathered set is compared before paying for a rebuild.
+    const auto pbrVersion = m_registry->StorageFor<MeshRenderer>()->Version();
+    const auto toonVersion = m_registry->StorageFor<ToonRenderer>()->Version();
+    const auto forceRebuild = m_rebuildStatics.exchange(false, std::memory_order_relaxed);
+    if (!forceRebuild && pbrVersion == m_pbrPoolVersion && toonVersion == m_toonPoolVersion)
+    {
+        return;
+    }
+
+    OPTICK_CATEGORY("ObjectSystem::SyncStaticTree", Optick::Category::Rendering);
+    m_pbrPoolVersion = pbrVersion;
+    m_toonPoolVersion = toonVersion;
+    m_staticScratch.clear();
+    auto gather = [this](const auto& candidates)
+    {
+        for (const auto& [renderer, transform] : candidates)
+        {
+            const auto entity = renderer->ParentEntity();
+            if (!entity.IsStatic())
+            {
+                continue;
+            }
+
+            const auto extent = renderer->GetMeshView().maxExtent;
+            m_staticScratch.emplace_back(entity.Index(), transform->Revision(), extent, ComputeBoundingSphere(extent, transform->TransformationMatrix()));
+        }
+    };
+
+    gather(m_pbrCandidates);
+    gather(m_toonCandidates);
+    std::ranges::sort(m_staticScratch, {}, &StaticRenderer::Key);
+    if (!forceRebuild && std::ranges::equal(m_staticScratch, m_staticRenderers, {}, &StaticRenderer::Key, &StaticRenderer::Key))
+    {
+        return;
+    }
+
+    m_treeSpheres.clear();
+    m_treeIds.clear();
+    for (const auto& item : m_staticScratch)
+    {
+        m_treeSpheres.push_back(item.sphere);
+        m_treeIds.push_back(item.entity);
+    }
+
+    m_staticTree.Build(m_treeSpheres, m_treeIds);
+    std::swap(m_staticRenderers, m_staticScratch);
+}
+
+void ObjectSystem::SyncDynamicTree()
+{
+    OPTICK_CATEGORY("ObjectSystem::SyncDynamicTree", Optick::Category::Rendering);
+    m_dynamicSpheres.Resize(m_dynamicPbr.size() + m_dynamicToon.size());
+    m_dynamicIds.clear();
+    auto moved = false;
+
+    // Spheres are slotted pbr first, then toon. Only slots whose transform or mesh changed are recomputed.
+    auto sync = [&](const auto& candidates, std::span<const uint32_t> indices)
+    {
+        for (auto index : indices)
+        {
+            const auto& [renderer, transform] = candidates[index];
+            const auto slot = m_dynamicIds.size();
+            moved = m_dynamicSpheres.Update(slot, transform->Revision(), renderer->GetMeshView().maxExtent, transform->TransformationMatrix()) || moved;
+            m_dynamicIds.push_back(renderer->ParentEntity().Index());
+        }
+    };
+
+    sync(m_pbrCandidates, m_dynamicPbr);
+    sync(m_toonCandidates, m_dynamicToon);
+
+    const auto rebuild = ++m_framesSinceDynamicBuild >= g_dynamicRebuildInterval;
+    if (rebuild)
+    {
+        m_framesSinceDynamicBuild = 0u;
+    }
+
+    // Refitting requires the same items in the same order as the last build
+    if (rebuild || m_dynamicIds != m_builtDynamicIds)
+    {
+        m_dynamicTree.Build(m_dynamicSpheres.Spheres(), m_dynamicIds);
+        std::swap(m_builtDynamicIds, m_dynamicIds);
+        return;
+    }
+
+    if (moved)
+    {
+        m_dynamicTree.Refit(m_dynamicSpheres.Spheres());
+    }
+}
+
+void ObjectSystem::CullRenderers(const Frustum& frustum)
+{
+    OPTICK_CATEGORY("ObjectSystem::CullRenderers", Optick::Category::Rendering);
+    std::ranges::fill(m_visibility, uint8_t{0});
+
+    // An entity is either static or dynamic, so the trees write disjoint flags and can be traversed concurrently
+    const auto parallel = m_dispatcher.MaxConcurrency() > 1 &&
+                          m_staticTree.ItemCount() >= g_parallelQueryThreshold &&
+                          m_dynamicTree.ItemCount() >= g_parallelQueryThreshold;
+
+    if (!parallel)
+    {
+        QueryRenderers(frustum, m_visibility.data());
+        return;
+    }
+
+    // One tree per chunk. The caller queries the first, and waits by running other pool work instead of blocking.
+    const auto trees = std::array{&m_dynamicTree, &m_staticTree};
+    m_dispatcher.ParallelFor(trees.size(), 1, [&](size_t begin, size_t end)
+    {
+        for (auto i = begin; i < end; ++i)
+        {
+            trees[i]->Query(frustum, m_visibility.data());
+        }
+    });
+}
 } // namespace nc::graphics
@@ -1,17 +1,29 @@
 #pragma once
 
+#include "DrawBatching.h"
+#include "SphereBvh.h"
 #include "asset/Assets.h"
+#include "ecs/Registry.h"
 #include "ecs/View.h"
 #include "ecs/Transform.h"
 #include "graphics/MeshRenderer.h"
 #include "graphics/shader_resource/ShaderResourceBus.h"
 #include "graphics/shader_resource/StorageBufferHandle.h"
 #include "graphics/ToonRenderer.h"
+#include "task/AsyncDispatcher.h"
 #include "utility/Signal.h"
 
+#include <atomic>
 #include <optional>
+#include <span>
+#include <tuple>
 #include <vector>
 
+namespace nc
+{
+struct SystemEvents;
+} // namespace nc
+
 namespace nc::graphics
 {
 struct CameraState;
@@ -19,12 +31,13 @@ struct EnvironmentState;
 struct ObjectData;
 struct SkeletalAnimationSystemState;
 
+/** Visible objects grouped into instanced draws. Batch instance ranges index the object data buffer. */
 struct ObjectState
 {
-    std::vector<asset::MeshView> pbrMeshes;
-    uint32_t pbrMeshStartingIndex;
-    std::vector<asset::MeshView> toonMeshes;
-    uint32_t toonMeshStartingIndex;
+    std::vector<DrawBatch> pbrBatches;
+    uint32_t pbrInstanceCount = 0u;
+    std::vector<DrawBatch> toonBatches;
+    uint32_t toonInstanceCount = 0u;
     std::optional<uint32_t> skyboxInstanceIndex = std::nullopt;
 };
 
@@ -40,13 +53,28 @@ struct ObjectData
     uint32_t skeletalAnimationIndex;
 };
 
+/**
+ * Gathers visible renderers into per-instance object data.
+ *
+ * Renderers on static Entities are kept in a bounding volume hierarchy keyed by entity. It is only rebuilt when
+ * SystemEvents::rebuildStatics fires or the set of static renderers changes, so moving a static renderer or changing
+ * its mesh requires emitting rebuildStatics. Static renderers otherwise cost nothing per frame beyond gathering draws.
+ * Changes to renderer pools are detected through their versions, so statics are only re-gathered on frames where
+ * renderers were added, removed, or reordered. Dynamic renderers are kept in a second hierarchy whose bounds are refit
+ * as they move, with a periodic rebuild to keep it from loosening. Frustum traversal rejects or accepts whole subtrees
+ * at once.
+ *
+ * Visible objects are radix sorted by mesh and material so instances of a mesh are contiguous in the object data
+ * buffer and can be drawn with one instanced call.
+ */
 class ObjectSystem
 {
     public:
-        ObjectSystem(ShaderResourceBus* shaderResourceBus, uint32_t maxObjects)
-            : m_objectDataBuffer{shaderResourceBus->CreateStorageBuffer(sizeof(ObjectData) * maxObjects, ShaderStage::Fragment | ShaderStage::Vertex, 0, 0, false)}
-        {
-        }
+        ObjectSystem(Registry* registry,
+                     ShaderResourceBus* shaderResourceBus,
+                     uint32_t maxObjects,
+                     const task::AsyncDispatcher& dispatcher,
+                     SystemEvents& events);
 
         auto Execute(uint32_t frameIndex,
                      MultiView<MeshRenderer, Transform> pbrRenderers,
@@ -55,10 +83,61 @@ class ObjectSystem
                      const EnvironmentState& environmentState,
                      const SkeletalAnimationSystemState& skeletalAnimationState) -> ObjectState;
 
-        void Clear() { m_objectDataBuffer.Clear(); }
+        /** Set visible[entity index] for renderers intersecting a frustum, such as a light's view volume. The
+         *  buffer must hold an entry for every possible entity index. */
+        void QueryRenderers(const Frustum& frustum, uint8_t* visible) const;
+
+        /** Append the entity indices of renderers intersecting a sphere, such as a point light's radius. */
+        void QueryRenderers(const Sphere& volume, std::vector<uint32_t>& out) const;
+
+        /** Flags indexed by entity index, set for entities with a renderer drawn by the last Execute(). Holds an
+         *  entry for every possible entity index. */
+        auto VisibleEntities() const noexcept -> std::span<const uint8_t> { return m_visibility; }
+
+        void Clear();
 
     private:
+        /** Identifies what a static tree item was built from. Transform revisions are unique across Transforms, so
+         *  an entity index reused by a new static renderer is still detected. */
+        struct StaticRenderer
+        {
+            Entity::index_type entity;
+            uint64_t revision;
+            float meshExtent;
+            Sphere sphere;
+
+            auto Key() const noexcept { return std::tuple{entity, revision, meshExtent}; }
+        };
+
+        Registry* m_registry;
         std::vector<ObjectData> m_objectData;
         StorageBufferHandle m_objectDataBuffer;
+        task::AsyncDispatcher m_dispatcher;
+        BoundingSphereCache m_dynamicSpheres;
+        SphereBvh m_staticTree;
+        SphereBvh m_dynamicTree;
+        std::vector<StaticRenderer> m_staticRenderers;
+        std::vector<StaticRenderer> m_staticScratch;
+        std::vector<uint32_t> m_dynamicPbr;
+        std::vector<uint32_t> m_dynamicToon;
+        std::vector<uint32_t> m_dynamicIds;
+        std::vector<uint32_t> m_builtDynamicIds;
+        std::vector<Sphere> m_treeSpheres;
+        std::vector<uint32_t> m_treeIds;
+        std::vector<uint8_t> m_visibility;
+        std::vector<std::pair<MeshRenderer*, Transform*>> m_pbrCandidates;
+        std::vector<std::pair<ToonRenderer*, Transform*>> m_toonCandidates;
+        std::vector<DrawKey> m_pbrKeys;
+        std::vector<DrawKey> m_toonKeys;
+        std::vector<DrawKey> m_sortScratch;
+        std::atomic<bool> m_rebuildStatics = true;
+        uint64_t m_pbrPoolVersion = UINT64_MAX;
+        uint64_t m_toonPoolVersion = UINT64_MAX;
+        uint32_t m_framesSinceDynamicBuild = 0u;
+        Connection m_rebuildStaticsConnection;
+
+        void SyncStaticTree();
+        void SyncDynamicTree();
+        void CullRenderers(const Frustum& frustum);
 };
 } // namespace nc::graphics
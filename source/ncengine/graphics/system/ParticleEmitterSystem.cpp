@@ -1,27 +1,13 @@
 #include "ParticleEmitterSystem.h"
 #include "asset/AssetService.h"
 #include "ecs/Transform.h"
+#include "ncengine/task/TaskGraph.h"
 #include "time/Time.h"
 
 #include "optick.h"
 
 #include <algorithm>
-
-namespace
-{
-struct CameraProperties
-{
-    DirectX::XMVECTOR position = DirectX::g_XMZero;
-    DirectX::XMVECTOR rotation = DirectX::XMQuaternionIdentity();
-    DirectX::XMVECTOR forward = DirectX::g_XMIdentityR2;
-};
-
-struct PermutationData
-{
-    int index;
-    float distance;
-};
-} // anonymous namespace
+#include <functional>
 
 namespace nc::graphics
 {
@@ -42,67 +28,57 @@ ParticleEmitterSystem::ParticleEmitterSystem(Registry* registry,
 {
 }
 
-void ParticleEmitterSystem::UpdateParticles()
+auto ParticleEmitterSystem::BuildUpdateGraph(task::ExceptionContext& exceptionContext) -> std::unique_ptr<tf::Taskflow>
 {
-    OPTICK_CATEGORY("ParticleEmitterSystem::UpdateParticles", Optick::Category::VFX);
-    const float dt = time::DeltaTime();
-    const auto [camPosition, camRotation, camForward] = [this]()
-    {
-        if (auto camera = m_getCamera())
+    auto graph = std::make_unique<tf::Taskflow>();
+    auto begin = graph->emplace(task::Guard(exceptionContext, [this] { BeginUpdate(); }))
+                       .name("BeginParticleUpdate");
+
+    auto update = graph->for_each_index(
+        size_t{0},
+        std::ref(m_emitterCount),
+        size_t{1},
+        [this, &exceptionContext](size_t i)
         {
-            const auto* transform = m_registry->Get<Transform>(camera->ParentEntity());
-            return ::CameraProperties
-            {
-                .position = transform->PositionXM(),
-                .rotation = transform->RotationXM(),
-                .forward = transform->ForwardXM()
-            };
+            task::Guard(exceptionContext, [this, i] { UpdateEmitter(i); })();
         }
+    ).name("UpdateEmitters");
 
-        return ::CameraProperties{};
-    }();
+    auto sort = graph->emplace(task::Guard(exceptionContext, [this] { SortEmitters(m_cameraPosition); }))
+                      .name("SortEmitters");
 
-    for (auto& state : m_emitterStates)
-    {
-        state.Update(dt, camRotation, camForward);
-    }
-
-    SortEmitters(camPosition);
+    begin.precede(update);
+    update.precede(sort);
+    return graph;
 }
 
-void ParticleEmitterSystem::SortEmitters(DirectX::FXMVECTOR cameraPosition)
+void ParticleEmitterSystem::BeginUpdate()
 {
-    OPTICK_CATEGORY("ParticleEmitterSystem::SortEmitters", Optick::Category::VFX);
-
-    // Build up an index array for sorting to help minimize number of swaps and distance calculations
-    auto permutation = std::vector<PermutationData>{};
-    permutation.reserve(m_emitterStates.size());
-    for (auto [i, emitter] : std::views::enumerate(m_emitterStates))
+    OPTICK_CATEGORY("ParticleEmitterSystem::BeginUpdate", Optick::Category::VFX);
+    m_dt = time::DeltaTime();
+    m_emitterCount = m_emitterStates.size();
+    if (auto camera = m_getCamera())
     {
-        const auto offsetFromCamera = DirectX::XMVectorSubtract(cameraPosition, emitter.GetLastPosition());
-        const auto sqLength = DirectX::XMVector3LengthSq(offsetFromCamera);
-        permutation.emplace_back(static_cast<int>(i), DirectX::XMVectorGetX(sqLength));
+        const auto* transform = m_registry->Get<Transform>(camera->ParentEntity());
+        m_cameraPosition = transform->PositionXM();
+        m_cameraRotation = DirectX::XMMatrixRotationQuaternion(transform->RotationXM());
+        return;
     }
 
-    // Sort back to front based on distance from camera
-    std::ranges::sort(permutation, std::greater<>{}, &PermutationData::distance);
+    m_cameraPosition = DirectX::g_XMZero;
+    m_cameraRotation = DirectX::XMMatrixIdentity();
+}
 
-    // Apply the permutation by walking cycles
-    const auto emitterCount = static_cast<int>(m_emitterStates.size());
-    for (int cycleStart = 0; cycleStart < emitterCount; ++cycleStart)
-    {
-        auto cycleCurrent = cycleStart;
-        while (permutation[cycleCurrent].index >= 0)
-        {
-            const auto emitterIndex = permutation[cycleCurrent].index;
-            if (cycleCurrent != emitterIndex && permutation[emitterIndex].index >= 0)
-            {
-                std::swap(m_emitterStates[cycleCurrent], m_emitterStates[emitterIndex]);
-            }
+void ParticleEmitterSystem::UpdateEmitter(size_t index)
+{
+    OPTICK_CATEGORY("ParticleEmitterSystem::UpdateEmitter", Optick::Category::VFX);
+    m_emitterStates[index].Update(m_dt, m_cameraRotation);
+}
 
-            cycleCurrent = std::exchange(permutation[cycleCurrent].index, -1);
-        }
-    }
+void ParticleEmitterSystem::SortEmitters(DirectX::FXMVECTOR cameraPosition)
+{
+    OPTICK_CATEGORY("ParticleEmitterSystem::SortEmitters", Optick::Category::VFX);
+    particle::SortBackToFront(m_emitterStates, cameraPosition);
 }
 
 void ParticleEmitterSystem::ProcessFrameEvents()
@@ -167,7 +143,8 @@ void ParticleEmitterSystem::UpdateInfo(graphics::ParticleEmitter& emitter)
 
 void ParticleEmitterSystem::Add(graphics::ParticleEmitter& emitter)
 {
-    m_toAdd.emplace_back(m_registry->GetEcs(), emitter.ParentEntity(), emitter.GetInfo(), &m_random);
+    // Each emitter gets its own generator so emitters can be updated concurrently.
+    m_toAdd.emplace_back(m_registry->GetEcs(), emitter.ParentEntity(), emitter.GetInfo(), m_random.Fork());
     emitter.RegisterSystem(this);
 }
 
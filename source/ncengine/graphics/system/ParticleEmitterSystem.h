@@ -8,6 +8,14 @@
 #include "ncengine/graphics/ParticleEmitter.h"
 #include "ncengine/graphics/Camera.h"
 #include "ncengine/math/Random.h"
+#include "ncengine/task/ExceptionContext.h"
+
+#include <memory>
+
+namespace tf
+{
+class Taskflow;
+} // namespace tf
 
 namespace nc::graphics
 {
@@ -31,7 +39,9 @@ class ParticleEmitterSystem
                               std::function<graphics::Camera* ()> getCamera,
                               unsigned maxParticles);
 
-        void UpdateParticles();
+        /** Build a graph that updates emitters in parallel. Emitters own all of their particle
+         *  state, so they can be simulated independently. */
+        auto BuildUpdateGraph(task::ExceptionContext& exceptionContext) -> std::unique_ptr<tf::Taskflow>;
         void ProcessFrameEvents();
         void Emit(Entity entity, size_t count);
         void UpdateInfo(graphics::ParticleEmitter& emitter);
@@ -54,7 +64,13 @@ class ParticleEmitterSystem
         std::vector<ParticleData> m_particleDataHostBuffer;
         StorageBufferHandle m_particleDataDeviceBuffer;
         unsigned m_maxParticles;
+        DirectX::XMMATRIX m_cameraRotation = DirectX::XMMatrixIdentity();
+        DirectX::XMVECTOR m_cameraPosition = DirectX::g_XMZero;
+        float m_dt = 0.0f;
+        size_t m_emitterCount = 0;
 
+        void BeginUpdate();
+        void UpdateEmitter(size_t index);
         void SortEmitters(DirectX::FXMVECTOR cameraPosition);
 };
 } // namespace nc::graphics
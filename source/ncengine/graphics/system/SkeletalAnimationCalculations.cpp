@@ -3,6 +3,9 @@
 #include "ncmath/MatrixUtilities.h"
 #include "ncutility/NcError.h"
 
+#include <algorithm>
+#include <array>
+#include <limits>
 #include <ranges>
 
 namespace nc::graphics
@@ -10,6 +13,63 @@ namespace nc::graphics
 using namespace DirectX;
 using namespace nc;
 
+namespace
+{
+// Levels ordered by distance. The last level is also used for units that are not visible.
+constexpr auto g_animationLods = std::array
+{
+    AnimationLod{.maxDistance = 25.0f,                            .updateInterval = 1u, .blend = true,  .animateLeafBones = true},
+    AnimationLod{.maxDistance = 50.0f,                            .updateInterval = 2u, .blend = true,  .animateLeafBones = true},
+    AnimationLod{.maxDistance = 100.0f,                           .updateInterval = 4u, .blend = false, .animateLeafBones = true},
+    AnimationLod{.maxDistance = std::numeric_limits<float>::max(), .updateInterval = 8u, .blend = false, .animateLeafBones = false}
+};
+
+// Interpolate a track at timeInTicks, resuming the keyframe search from the cursor. Times past the last
+// keyframe hold the final value.
+template<class T, class Interpolate>
+auto SampleChannel(float timeInTicks, const anim::KeyframeChannel<T>& channel, size_t track, uint32_t& cursor, Interpolate&& interpolate) -> T
+{
+    const auto first = channel.keyOffsets[track];
+    const auto count = channel.keyOffsets[track + 1] - first;
+    const auto* times = channel.times.data() + first;
+    const auto* values = channel.values.data() + first;
+    if (count == 1)
+    {
+        return values[0];
+    }
+
+    auto key = cursor;
+    if (key + 1 >= count || timeInTicks < times[key])
+    {
+        key = 0u;
+    }
+
+    while (key + 2 < count && timeInTicks >= times[key + 1])
+    {
+        ++key;
+    }
+
+    cursor = key;
+    const auto interpolationFactor = std::clamp((timeInTicks - times[key]) / (times[key + 1] - times[key]), 0.0f, 1.0f);
+    return interpolate(values[key], values[key + 1], interpolationFactor);
+}
+} // anonymous namespace
+
+auto SelectAnimationLod(float distance, bool visible) -> const AnimationLod&
+{
+    if (!visible)
+    {
+        return g_animationLods.back();
+    }
+
+    return *std::ranges::find_if(g_animationLods, [distance](auto&& lod) { return distance <= lod.maxDistance; });
+}
+
+auto IsAnimationUpdateFrame(uint64_t frame, uint32_t phase, const AnimationLod& lod) -> bool
+{
+    return (frame + phase) % lod.updateInterval == 0;
+}
+
 auto GetAnimationOffsets(float timeInTicks,
                          const std::vector<std::string>& boneNames,
                          const nc::asset::SkeletalAnimation* animation) -> anim::PackedAnimationDecomposed
@@ -43,16 +103,7 @@ auto ComposeMatrices(float timeInTicks,
                      const std::vector<std::string>& boneNames,
                      const nc::asset::SkeletalAnimation* animation) -> anim::PackedAnimation
 {
-    auto [offsets, hasValues] = GetAnimationOffsets(timeInTicks, boneNames, animation);
-    auto packedAnimation = anim::PackedAnimation{ .offsets = std::vector<DirectX::XMMATRIX>{}, .hasValues = std::move(hasValues) };
-    packedAnimation.offsets.reserve(packedAnimation.hasValues.size());
-
-    std::ranges::transform(offsets, std::back_inserter(packedAnimation.offsets), [](auto&& offset)
-    {
-        return ToScaleMatrix(offset.scale) * ToRotMatrix(offset.rot) * ToTransMatrix(offset.pos);
-    });
-
-    return packedAnimation;
+    return ComposeMatrices(GetAnimationOffsets(timeInTicks, boneNames, animation));
 }
 
 auto ComposeBlendedMatrices(float blendFromTime,
@@ -62,11 +113,142 @@ auto ComposeBlendedMatrices(float blendFromTime,
                             const nc::asset::SkeletalAnimation* blendFromAnim,
                             const nc::asset::SkeletalAnimation* blendToAnim) -> anim::PackedAnimation
 {
-    auto blendFromDecomposed = GetAnimationOffsets(blendFromTime, boneNames, blendFromAnim);
-    auto blendToDecomposed = GetAnimationOffsets(blendToTime, boneNames, blendToAnim);
+    return ComposeBlendedMatrices(GetAnimationOffsets(blendFromTime, boneNames, blendFromAnim),
+                                  GetAnimationOffsets(blendToTime, boneNames, blendToAnim),
+                                  blendFactor);
+}
+
+auto CompileClip(const anim::PackedRig& rig,
+                 const nc::asset::SkeletalAnimation& animation) -> anim::CompiledClip
+{
+    auto clip = anim::CompiledClip{};
+    clip.boneCount = static_cast<uint32_t>(rig.boneNames.size());
+
+    auto appendTrack = [](auto& channel, const auto& frames, auto&& getValue)
+    {
+        channel.keyOffsets.push_back(static_cast<uint32_t>(channel.times.size()));
+        for (const auto& frame : frames)
+        {
+            channel.times.push_back(frame.timeInTicks);
+            channel.values.push_back(getValue(frame));
+        }
+    };
+
+    auto appendBone = [&](uint32_t boneIndex)
+    {
+        const auto& boneName = rig.boneNames[boneIndex];
+        auto iter = animation.framesPerBone.find(boneName);
+        if (iter == animation.framesPerBone.end())
+        {
+            return;
+        }
+
+        const auto& frames = iter->second;
+        NC_ASSERT(!frames.positionFrames.empty(), fmt::format("Animation '{}' has no position data for bone '{}'.", animation.name, boneName));
+        NC_ASSERT(!frames.rotationFrames.empty(), fmt::format("Animation '{}' has no rotation data for bone '{}'.", animation.name, boneName));
+        NC_ASSERT(!frames.scaleFrames.empty(), fmt::format("Animation '{}' has no scale data for bone '{}'.", animation.name, boneName));
+
+        clip.trackBones.push_back(boneIndex);
+        appendTrack(clip.positions, frames.positionFrames, [](auto&& frame) { return frame.position; });
+        appendTrack(clip.rotations, frames.rotationFrames, [](auto&& frame) { return frame.rotation; });
+        appendTrack(clip.scales, frames.scaleFrames, [](auto&& frame) { return frame.scale; });
+    };
 
+    // Bones with children first, then leaves
+    const auto isLeaf = [&rig](uint32_t boneIndex) { return rig.offsetChildren[boneIndex].numChildren == 0u; };
+    for (auto boneIndex = 0u; boneIndex < clip.boneCount; ++boneIndex)
+    {
+        if (!isLeaf(boneIndex)) appendBone(boneIndex);
+    }
+
+    clip.coreTrackCount = static_cast<uint32_t>(clip.trackBones.size());
+    for (auto boneIndex = 0u; boneIndex < clip.boneCount; ++boneIndex)
+    {
+        if (isLeaf(boneIndex)) appendBone(boneIndex);
+    }
+
+    // Close the final track's key range.
+    clip.positions.keyOffsets.push_back(static_cast<uint32_t>(clip.positions.times.size()));
+    clip.rotations.keyOffsets.push_back(static_cast<uint32_t>(clip.rotations.times.size()));
+    clip.scales.keyOffsets.push_back(static_cast<uint32_t>(clip.scales.times.size()));
+    return clip;
+}
+
+void SampleClip(float timeInTicks,
+                const anim::CompiledClip& clip,
+                anim::ClipCursor& cursor,
+                anim::PackedAnimationDecomposed& out,
+                bool animateLeafBones)
+{
+    const auto trackCount = clip.trackBones.size();
+    if (cursor.positions.size() != trackCount)
+    {
+        cursor.positions.assign(trackCount, 0u);
+        cursor.rotations.assign(trackCount, 0u);
+        cursor.scales.assign(trackCount, 0u);
+    }
+
+    out.offsets.assign(clip.boneCount, anim::DecomposedMatrix{});
+    out.hasValues.assign(clip.boneCount, 0);
+
+    const auto sampledTracks = animateLeafBones ? trackCount : clip.coreTrackCount;
+    for (auto track = 0ull; track < sampledTracks; ++track)
+    {
+        const auto bone = clip.trackBones[track];
+        out.offsets[bone] = anim::DecomposedMatrix
+        {
+            SampleChannel(timeInTicks, clip.positions, track, cursor.positions[track], [](auto&& from, auto&& to, float factor)
+            {
+                return Lerp(from, to, factor);
+            }),
+            Normalize(SampleChannel(timeInTicks, clip.rotations, track, cursor.rotations[track], [](auto&& from, auto&& to, float factor)
+            {
+                return Slerp(from, to, factor);
+            })),
+            SampleChannel(timeInTicks, clip.scales, track, cursor.scales[track], [](auto&& from, auto&& to, float factor)
+            {
+                return Lerp(from, to, factor);
+            })
+        };
+        out.hasValues[bone] = 1;
+    }
+}
+
+auto ComposeMatrices(const anim::PackedAnimationDecomposed& offsets) -> anim::PackedAnimation
+{
+    auto packedAnimation = anim::PackedAnimation{};
+    ComposeMatrices(offsets, packedAnimation);
+    return packedAnimation;
+}
+
+auto ComposeBlendedMatrices(const anim::PackedAnimationDecomposed& blendFrom,
+                            const anim::PackedAnimationDecomposed& blendTo,
+                            float blendFactor) -> anim::PackedAnimation
+{
     auto packedAnimation = anim::PackedAnimation{};
-    packedAnimation.hasValues = std::vector<anim::HasValue>{blendFromDecomposed.hasValues.begin(), blendFromDecomposed.hasValues.end()};
+    ComposeBlendedMatrices(blendFrom, blendTo, blendFactor, packedAnimation);
+    return packedAnimation;
+}
+
+void ComposeMatrices(const anim::PackedAnimationDecomposed& offsets,
+                     anim::PackedAnimation& out)
+{
+    out.hasValues.assign(offsets.hasValues.begin(), offsets.hasValues.end());
+    out.offsets.clear();
+
+    std::ranges::transform(offsets.offsets, std::back_inserter(out.offsets), [](auto&& offset)
+    {
+        return ToScaleMatrix(offset.scale) * ToRotMatrix(offset.rot) * ToTransMatrix(offset.pos);
+    });
+}
+
+void ComposeBlendedMatrices(const anim::PackedAnimationDecomposed& blendFrom,
+                            const anim::PackedAnimationDecomposed& blendTo,
+                            float blendFactor,
+                            anim::PackedAnimation& out)
+{
+    out.hasValues.assign(blendFrom.hasValues.begin(), blendFrom.hasValues.end());
+    out.offsets.clear();
 
     auto interpolate = [blendFactor](auto& blendFromOffset, auto& blendToOffset)
     {
@@ -75,16 +257,27 @@ auto ComposeBlendedMatrices(float blendFromTime,
                ToTransMatrix(Lerp(blendFromOffset.pos, blendToOffset.pos, blendFactor));
     };
 
-    auto offsets = std::views::zip_transform(interpolate, blendFromDecomposed.offsets, blendToDecomposed.offsets);
-    packedAnimation.offsets = std::vector<DirectX::XMMATRIX>{offsets.begin(), offsets.end()};
-    return packedAnimation;
+    std::ranges::copy(std::views::zip_transform(interpolate, blendFrom.offsets, blendTo.offsets), std::back_inserter(out.offsets));
 }
 
 auto AnimateBones(const anim::PackedRig& rig,
                   const anim::PackedAnimation& anim) -> std::vector<nc::graphics::SkeletalAnimationData>
 {
+    auto boneToParentSandbox = std::vector<DirectX::XMMATRIX>{};
+    auto animatedBones = std::vector<nc::graphics::SkeletalAnimationData>(rig.vertexToBone.size());
+    AnimateBones(rig, anim, boneToParentSandbox, animatedBones);
+    return animatedBones;
+}
+
+void AnimateBones(const anim::PackedRig& rig,
+                  const anim::PackedAnimation& anim,
+                  std::vector<DirectX::XMMATRIX>& boneToParentSandbox,
+                  std::span<nc::graphics::SkeletalAnimationData> out)
+{
+    NC_ASSERT(out.size() == rig.vertexToBone.size(), "Output range does not match the rig's bone count.");
+
     // Copy the boneToParent vector to perform modifications in place.
-    auto boneToParentSandbox = std::vector<DirectX::XMMATRIX>{rig.boneToParent.begin(), rig.boneToParent.end()};
+    boneToParentSandbox.assign(rig.boneToParent.begin(), rig.boneToParent.end());
 
     // Replace each boneToParent offset with its animation offset, if present. Else, leave as the original offset.
     for (auto&& [boneOffset, animOffset, animHasValue] : std::views::zip(boneToParentSandbox, anim.offsets, anim.hasValues))
@@ -101,22 +294,17 @@ auto AnimateBones(const anim::PackedRig& rig,
         }
     }
 
-    // Create the output vector.
-    auto animatedBones = std::vector<nc::graphics::SkeletalAnimationData>{};
-    animatedBones.reserve(rig.vertexToBone.size());
-
     // Create a final transform for each bone by multiplying the (vertex-space-to-bone-space matrix) with the (bone-space-to-animated-parent-bone-space matrix) with the (global inverse transform matrix).
     // This outputs a matrix that can be used to transform a vertex into its final animated position.
     std::ranges::transform(
     std::views::zip(rig.vertexToBone, rig.offsetsMap),
-    std::back_inserter(animatedBones),
+    out.begin(),
         [globalInverseTransform = rig.globalInverseTransform, &boneToParentSandbox](auto&& in)
         {  
             auto&& [matrix, offset] = in;
             return SkeletalAnimationData{matrix * boneToParentSandbox.at(offset) * globalInverseTransform};
         }
     );
-    return animatedBones;
 }
 
 auto GetInterpolatedPosition(float timeInTicks, const std::vector<nc::asset::PositionFrame>& positionFrames) -> nc::Vector3
@@ -6,10 +6,26 @@
 #include "asset/AssetData.h"
 #include "DirectXMath.h"
 
+#include <span>
 #include <vector>
 
 namespace nc::graphics
 {
+/** @brief How often and how completely an animation unit is evaluated. */
+struct AnimationLod
+{
+    float maxDistance;       // Units farther than this from the camera use a later level
+    uint32_t updateInterval; // Evaluate every updateInterval frames, reusing the previous pose otherwise
+    bool blend;              // Blend between states, or only sample the state being blended to
+    bool animateLeafBones;   // Sample tracks for bones without children
+};
+
+/** @brief Get the level of detail for a unit at a distance from the camera. Units not visible use the lowest level. */
+auto SelectAnimationLod(float distance, bool visible) -> const AnimationLod&;
+
+/** @brief Check if a unit with the given phase should be evaluated on a frame. */
+auto IsAnimationUpdateFrame(uint64_t frame, uint32_t phase, const AnimationLod& lod) -> bool;
+
 auto GetAnimationOffsets(float timeInTicks,
                          const std::vector<std::string>& boneNames,
                          const nc::asset::SkeletalAnimation* animation) -> anim::PackedAnimationDecomposed;
@@ -25,9 +41,48 @@ auto ComposeBlendedMatrices(float blendFromTime,
                             const nc::asset::SkeletalAnimation* blendFromAnim,
                             const nc::asset::SkeletalAnimation* blendToAnim) -> anim::PackedAnimation;
 
+/** @brief Resolve an animation against a rig, packing its keyframes into per-channel arrays. */
+auto CompileClip(const anim::PackedRig& rig,
+                 const nc::asset::SkeletalAnimation& animation) -> anim::CompiledClip;
+
+/**
+ * @brief Sample a compiled clip into out, which is resized to the rig's bone count.
+ * @param animateLeafBones If false, only core tracks are sampled and leaf bones keep their bind pose.
+ */
+void SampleClip(float timeInTicks,
+                const anim::CompiledClip& clip,
+                anim::ClipCursor& cursor,
+                anim::PackedAnimationDecomposed& out,
+                bool animateLeafBones = true);
+
+auto ComposeMatrices(const anim::PackedAnimationDecomposed& offsets) -> anim::PackedAnimation;
+
+auto ComposeBlendedMatrices(const anim::PackedAnimationDecomposed& blendFrom,
+                            const anim::PackedAnimationDecomposed& blendTo,
+                            float blendFactor) -> anim::PackedAnimation;
+
+/** @brief Compose offsets into out, reusing its storage. */
+void ComposeMatrices(const anim::PackedAnimationDecomposed& offsets,
+                     anim::PackedAnimation& out);
+
+/** @brief Compose blended offsets into out, reusing its storage. */
+void ComposeBlendedMatrices(const anim::PackedAnimationDecomposed& blendFrom,
+                            const anim::PackedAnimationDecomposed& blendTo,
+                            float blendFactor,
+                            anim::PackedAnimation& out);
+
 auto AnimateBones(const anim::PackedRig& rig,
                   const anim::PackedAnimation& anim) -> std::vector<nc::graphics::SkeletalAnimationData>;
 
+/**
+ * @brief Write the final bone matrices for a rig into out, which must hold rig.vertexToBone.size() elements.
+ * @param boneToParentSandbox Scratch storage for the rig's animated hierarchy.
+ */
+void AnimateBones(const anim::PackedRig& rig,
+                  const anim::PackedAnimation& anim,
+                  std::vector<DirectX::XMMATRIX>& boneToParentSandbox,
+                  std::span<nc::graphics::SkeletalAnimationData> out);
+
 auto GetInterpolatedPosition(float timeInTicks, const std::vector<nc::asset::PositionFrame>& positionFrames) -> nc::Vector3;
 auto GetInterpolatedRotation(float timeInTicks, const std::vector<nc::asset::RotationFrame>& rotationFrames) -> nc::Quaternion;
 auto GetInterpolatedScale(float timeInTicks, const std::vector<nc::asset::ScaleFrame>& scaleFrames) -> nc::Vector3;
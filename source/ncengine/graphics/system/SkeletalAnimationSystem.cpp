@@ -1,4 +1,5 @@
 #include "SkeletalAnimationSystem.h"
+#include "CameraSystem.h"
 #include "ecs/View.h"
 #include "graphics/system/SkeletalAnimationCalculations.h"
 #include "time/Time.h"
@@ -7,11 +8,18 @@
 
 namespace
 {
-auto PrepareAnimation(nc::graphics::anim::UnitOfWork& unit, const nc::graphics::anim::PackedRig& rig, float dt) -> nc::graphics::anim::PackedAnimation
-{
-    auto packedAnimation = nc::graphics::anim::PackedAnimation{};
+// Units are evaluated in tasks of at least this many, with one task per worker at most.
+constexpr auto g_minUnitsPerTask = size_t{16};
 
-    if (unit.blendFromAnim && unit.blendToAnim)
+void PrepareAnimation(nc::graphics::anim::UnitOfWork& unit,
+                      const nc::graphics::AnimationLod& lod,
+                      nc::graphics::anim::PackedAnimationDecomposed& blendFromSample,
+                      nc::graphics::anim::PackedAnimationDecomposed& blendToSample,
+                      nc::graphics::anim::PackedAnimation& out,
+                      float dt)
+{
+    // Blending is skipped at distance and once the blend has finished
+    if (lod.blend && unit.blendFactor < 1.0f && unit.blendFromAnim && unit.blendToAnim)
     {
         unit.blendToTime =   fmod((unit.blendToTime + dt),   (static_cast<float>(unit.blendToAnim->durationInTicks)   / unit.blendToAnim->ticksPerSecond));
         unit.blendFromTime = fmod((unit.blendFromTime + dt), (static_cast<float>(unit.blendFromAnim->durationInTicks) / unit.blendFromAnim->ticksPerSecond));
@@ -19,22 +27,26 @@ auto PrepareAnimation(nc::graphics::anim::UnitOfWork& unit, const nc::graphics::
         auto blendFromTimeTicks = unit.blendFromTime * unit.blendFromAnim->ticksPerSecond;
         auto blendToTimeTicks =   unit.blendToTime   * unit.blendToAnim->ticksPerSecond;
 
-        return nc::graphics::ComposeBlendedMatrices(blendFromTimeTicks, blendToTimeTicks, unit.blendFactor, rig.boneNames, unit.blendFromAnim, unit.blendToAnim);
+        nc::graphics::SampleClip(blendFromTimeTicks, *unit.blendFromClip, unit.blendFromCursor, blendFromSample, lod.animateLeafBones);
+        nc::graphics::SampleClip(blendToTimeTicks, *unit.blendToClip, unit.blendToCursor, blendToSample, lod.animateLeafBones);
+        nc::graphics::ComposeBlendedMatrices(blendFromSample, blendToSample, unit.blendFactor, out);
+        return;
     }
 
-    auto [timeInSeconds, animData] = [&unit]()
+    auto [timeInSeconds, animData, clip, cursor] = [&unit]()
     {
-        return unit.blendFromAnim ?
-            std::pair{&unit.blendFromTime, unit.blendFromAnim} :
-            std::pair{&unit.blendToTime, unit.blendToAnim};
+        return unit.blendToAnim ?
+            std::tuple{&unit.blendToTime, unit.blendToAnim, unit.blendToClip, &unit.blendToCursor} :
+            std::tuple{&unit.blendFromTime, unit.blendFromAnim, unit.blendFromClip, &unit.blendFromCursor};
     }();
 
     *timeInSeconds = fmod((*timeInSeconds + dt), (static_cast<float>(animData->durationInTicks)/animData->ticksPerSecond));
     auto timeInTicks = *timeInSeconds * animData->ticksPerSecond;
-    return nc::graphics::ComposeMatrices(timeInTicks, rig.boneNames, animData);
+    nc::graphics::SampleClip(timeInTicks, *clip, *cursor, blendToSample, lod.animateLeafBones);
+    nc::graphics::ComposeMatrices(blendToSample, out);
 }
 
-auto HasCompletedAnimationCycle(const nc::graphics::anim::UnitOfWork unit, float dt) -> bool
+auto HasCompletedAnimationCycle(const nc::graphics::anim::UnitOfWork& unit, float dt) -> bool
 {
     return unit.blendToAnim && (unit.blendToTime + dt > static_cast<float>(unit.blendToAnim->durationInTicks)/unit.blendToAnim->ticksPerSecond);
 }
@@ -45,23 +57,34 @@ namespace nc::graphics
 SkeletalAnimationSystem::SkeletalAnimationSystem(Registry* registry,
                                                  ShaderResourceBus* shaderResourceBus,
                                                  uint32_t maxSkeletalAnimations,
+                                                 const task::AsyncDispatcher& dispatcher,
                                                  Signal<const asset::SkeletalAnimationUpdateEventData&>& onSkeletalAnimationUpdate,
                                                  Signal<const asset::BoneUpdateEventData&>& onBonesUpdate)
     : m_registry{registry},
+      m_dispatcher{dispatcher},
       m_rigs{},
       m_onBonesUpdate{onBonesUpdate.Connect(this, &SkeletalAnimationSystem::UpdateBonesStorage)},
       m_animationAssets{},
       m_onSkeletalAnimationUpdate{onSkeletalAnimationUpdate.Connect(this, &SkeletalAnimationSystem::UpdateSkeletalAnimationStorage)},
+      m_clips{},
       m_onAddConnection{registry->OnAdd<graphics::SkeletalAnimator>().Connect(this, &SkeletalAnimationSystem::Add)},
       m_onRemoveConnection{registry->OnRemove<graphics::SkeletalAnimator>().Connect(this, &SkeletalAnimationSystem::Remove)},
       m_onStateChangedHandlers{},
       m_handlerIndices{},
       m_unitEntities{},
       m_units{},
+      m_unitOffsets{},
+      m_unitLods{},
+      m_scratch{},
+      m_animatedBones{},
+      m_previousAnimatedBones{},
+      m_animationIndices{},
       m_skeletalAnimationDataBuffer{shaderResourceBus->CreateStorageBuffer(sizeof(SkeletalAnimationData) * AvgBonesPerAnim * maxSkeletalAnimations, ShaderStage::Vertex, 6, 0, false)}
 {}
 
-auto SkeletalAnimationSystem::Execute(uint32_t frameIndex) -> SkeletalAnimationSystemState
+auto SkeletalAnimationSystem::Execute(uint32_t frameIndex,
+                                      const CameraState& cameraState,
+                                      std::span<const uint8_t> visibleEntities) -> SkeletalAnimationSystemState
 {
     OPTICK_CATEGORY("Execute", Optick::Category::Animation);
 
@@ -73,29 +96,100 @@ auto SkeletalAnimationSystem::Execute(uint32_t frameIndex) -> SkeletalAnimationS
 
     if (m_units.empty()) return SkeletalAnimationSystemState{};
 
-    auto stateIndex = 0u;
-    auto buffer = std::vector<SkeletalAnimationData>{};
-    auto state = SkeletalAnimationSystemState{};
     const auto dt = time::DeltaTime();
+    const auto unitCount = m_units.size();
+
+    // Units skipping an update copy their matrices from last frame's output
+    std::swap(m_animatedBones, m_previousAnimatedBones);
 
-    for (auto&& [unit, unitEntity] : std::views::zip(m_units, m_unitEntities))
+    // Pick each unit's level of detail and assign it a contiguous range of the output buffer from a prefix sum
+    // of rig bone counts. Anything touching the registry stays on this thread.
+    std::ranges::fill(m_animationIndices, UINT32_MAX);
+    m_unitOffsets.resize(unitCount + 1);
+    m_unitLods.resize(unitCount);
+    auto boneCount = 0u;
+    for (auto i = 0ull; i < unitCount; ++i)
     {
-        const auto& rig = *unit.rig;
+        auto& unit = m_units[i];
+        const auto& unitEntity = m_unitEntities[i];
         const auto unitIndex = unitEntity.Index();
-
         if (unit.blendFactor < 1.0f) unit.blendFactor += dt * 2.0f;
-        if (HasCompletedAnimationCycle(unit, dt)) m_registry->Get<SkeletalAnimator>(unitEntity)->CompleteFirstRun();
 
-        auto packedAnimation = PrepareAnimation(unit, rig, dt);
-        auto animatedBones = AnimateBones(rig, packedAnimation);
+        // Units without a pose yet have no visibility history (their renderer may not have been drawn), so they
+        // start at full detail. Otherwise anything not flagged, including indices past the table, is hidden.
+        const auto firstUpdate = unit.lastOutputOffset == UINT32_MAX;
+        const auto visible = visibleEntities.empty() || firstUpdate ||
+                             (unitIndex < visibleEntities.size() && visibleEntities[unitIndex]);
+        const auto distance = Distance(m_registry->Get<Transform>(unitEntity)->Position(), cameraState.position);
+        const auto& lod = SelectAnimationLod(distance, visible);
+        const auto update = firstUpdate || IsAnimationUpdateFrame(m_frameCount, unit.updatePhase, lod);
+        unit.pendingTime += dt;
+        m_unitLods[i] = update ? &lod : nullptr;
+        if (update && HasCompletedAnimationCycle(unit, unit.pendingTime))
+        {
+            m_registry->Get<SkeletalAnimator>(unitEntity)->CompleteFirstRun();
+        }
+
+        if (unitIndex >= m_animationIndices.size())
+        {
+            m_animationIndices.resize(unitIndex + 1, UINT32_MAX);
+        }
 
-        buffer.insert(buffer.end(), animatedBones.begin(), animatedBones.end());
-        state.animationIndices.emplace(unitIndex, stateIndex);
-        stateIndex = static_cast<uint32_t>(buffer.size());
+        m_animationIndices[unitIndex] = boneCount;
+        m_unitOffsets[i] = boneCount;
+        boneCount += static_cast<uint32_t>(unit.rig->vertexToBone.size());
+    }
+
+    m_unitOffsets[unitCount] = boneCount;
+    m_animatedBones.resize(boneCount);
+
+    // Units write disjoint output ranges, so contiguous runs of them can be evaluated concurrently
+    const auto maxTasks = std::max(m_dispatcher.MaxConcurrency(), size_t{1});
+    const auto taskCount = std::min((unitCount + g_minUnitsPerTask - 1) / g_minUnitsPerTask, maxTasks);
+    const auto unitsPerTask = (unitCount + taskCount - 1) / taskCount;
+    if (m_scratch.size() < taskCount)
+    {
+        m_scratch.resize(taskCount);
     }
 
-    m_skeletalAnimationDataBuffer.Bind(buffer, frameIndex);
-    return state;
+    // One chunk per task so each reuses its own scratch. The calling thread runs the first and helps with other
+    // pool work while waiting on the rest.
+    m_dispatcher.ParallelFor(taskCount, 1, [this, unitCount, unitsPerTask](size_t beginTask, size_t endTask)
+    {
+        for (auto task = beginTask; task < endTask; ++task)
+        {
+            const auto begin = std::min(task * unitsPerTask, unitCount);
+            const auto end = std::min(begin + unitsPerTask, unitCount);
+            AnimateUnits(begin, end, m_scratch[task]);
+        }
+    });
+
+    ++m_frameCount;
+    m_skeletalAnimationDataBuffer.Bind(m_animatedBones, frameIndex);
+    return SkeletalAnimationSystemState{m_animationIndices};
+}
+
+void SkeletalAnimationSystem::AnimateUnits(size_t begin, size_t end, AnimationScratch& scratch)
+{
+    const auto output = std::span{m_animatedBones};
+    const auto previousOutput = std::span<const SkeletalAnimationData>{m_previousAnimatedBones};
+    for (auto i = begin; i < end; ++i)
+    {
+        auto& unit = m_units[i];
+        const auto unitOutput = output.subspan(m_unitOffsets[i], m_unitOffsets[i + 1] - m_unitOffsets[i]);
+        if (const auto* lod = m_unitLods[i])
+        {
+            PrepareAnimation(unit, *lod, scratch.blendFromSample, scratch.blendToSample, scratch.composed, unit.pendingTime);
+            AnimateBones(*unit.rig, scratch.composed, scratch.boneToParent, unitOutput);
+            unit.pendingTime = 0.0f;
+        }
+        else
+        {
+            std::ranges::copy(previousOutput.subspan(unit.lastOutputOffset, unitOutput.size()), unitOutput.begin());
+        }
+
+        unit.lastOutputOffset = m_unitOffsets[i];
+    }
 }
 
 void SkeletalAnimationSystem::UpdateSkeletalAnimationStorage(const asset::SkeletalAnimationUpdateEventData& eventData)
@@ -112,13 +206,24 @@ void SkeletalAnimationSystem::UpdateSkeletalAnimationStorage(const asset::Skelet
         }
         case asset::UpdateAction::Unload:
         {
-            std::ranges::for_each(eventData.ids, [this](auto&& id) { m_animationAssets.erase(id); });
+            for (const auto& id : eventData.ids)
+            {
+                auto pos = m_animationAssets.find(id);
+                if (pos == m_animationAssets.end())
+                {
+                    continue;
+                }
+
+                std::erase_if(m_clips, [animation = &pos->second](auto&& entry) { return entry.first.second == animation; });
+                m_animationAssets.erase(pos);
+            }
             break;
         }
         case asset::UpdateAction::UnloadAll:
         {
             m_units.clear();
             m_unitEntities.clear();
+            m_clips.clear();
             m_animationAssets.clear();
             break;
         }
@@ -139,13 +244,24 @@ void SkeletalAnimationSystem::UpdateBonesStorage(const asset::BoneUpdateEventDat
         }
         case asset::UpdateAction::Unload:
         {
-            std::ranges::for_each(eventData.ids, [this](auto&& id) { m_rigs.erase(id); });
+            for (const auto& id : eventData.ids)
+            {
+                auto pos = m_rigs.find(id);
+                if (pos == m_rigs.end())
+                {
+                    continue;
+                }
+
+                std::erase_if(m_clips, [rig = &pos->second](auto&& entry) { return entry.first.first == rig; });
+                m_rigs.erase(pos);
+            }
             break;
         }
         case asset::UpdateAction::UnloadAll:
         {
             m_units.clear();
             m_unitEntities.clear();
+            m_clips.clear();
             m_rigs.clear();
             break;
         }
@@ -160,35 +276,43 @@ void SkeletalAnimationSystem::Start(const anim::StateChange& stateChange)
         return;
     }
 
+    auto* rig = &m_rigs.at(stateChange.meshUid);
+    auto* blendFromAnim = stateChange.prevAnimUid.empty() ? nullptr : &m_animationAssets.at(stateChange.prevAnimUid);
+    auto* blendToAnim = stateChange.curAnimUid.empty() ? nullptr : &m_animationAssets.at(stateChange.curAnimUid);
+    auto unit = anim::UnitOfWork
+    {
+        .index         = stateChange.entity.Index(),
+        .rig           = rig,
+        .blendFromAnim = blendFromAnim,
+        .blendToAnim   = blendToAnim,
+        .blendFromTime = 0.0f,
+        .blendToTime   = 0.0f,
+        .blendFactor   = 0.0f,
+        .blendFromClip = GetClip(rig, blendFromAnim),
+        .blendToClip   = GetClip(rig, blendToAnim),
+        .updatePhase   = m_nextUpdatePhase++
+    };
+
     auto pos = std::ranges::find(m_unitEntities, stateChange.entity);
     if (pos == m_unitEntities.end())
     {
         m_unitEntities.emplace_back(stateChange.entity);
-        m_units.emplace_back
-        (
-            stateChange.entity.Index(),
-            &m_rigs.at(stateChange.meshUid),
-            stateChange.prevAnimUid.empty() ? nullptr : &m_animationAssets.at(stateChange.prevAnimUid),
-            stateChange.curAnimUid.empty() ? nullptr : &m_animationAssets.at(stateChange.curAnimUid),
-            0.0f,
-            0.0f,
-            0.0f
-        );
+        m_units.push_back(std::move(unit));
         return;
     }
 
     auto posIndex = std::distance(m_unitEntities.begin(), pos);
-    m_unitEntities.at(posIndex) = stateChange.entity;
-    m_units.at(posIndex) = anim::UnitOfWork
+    auto& previous = m_units.at(posIndex);
+    unit.blendFromTime = previous.blendToTime;
+    unit.updatePhase = previous.updatePhase;
+    if (unit.blendFromClip == previous.blendToClip)
     {
-        .index         = stateChange.entity.Index(),
-        .rig           = &m_rigs.at(stateChange.meshUid),
-        .blendFromAnim = stateChange.prevAnimUid.empty() ? nullptr : &m_animationAssets.at(stateChange.prevAnimUid),
-        .blendToAnim   = stateChange.curAnimUid.empty() ? nullptr : &m_animationAssets.at(stateChange.curAnimUid),
-        .blendFromTime = m_units.at(posIndex).blendToTime,
-        .blendToTime   = 0.0f,
-        .blendFactor   = 0.0f
-    };
+        // Blending out of the animation that was playing, so its cursor is still valid
+        unit.blendFromCursor = std::move(previous.blendToCursor);
+    }
+
+    m_unitEntities.at(posIndex) = stateChange.entity;
+    previous = std::move(unit);
 }
 
 void SkeletalAnimationSystem::Stop(const anim::StateChange& stateChange)
@@ -202,7 +326,7 @@ void SkeletalAnimationSystem::Stop(const anim::StateChange& stateChange)
     auto posIndex = std::distance(m_unitEntities.begin(), pos);
     m_unitEntities.at(posIndex) = m_unitEntities.back();
     m_unitEntities.pop_back();
-    m_units.at(posIndex) = m_units.back();
+    m_units.at(posIndex) = std::move(m_units.back());
     m_units.pop_back();
 }
 
@@ -212,6 +336,22 @@ void SkeletalAnimationSystem::Clear() noexcept
     m_unitEntities.clear();
 }
 
+auto SkeletalAnimationSystem::GetClip(const anim::PackedRig* rig, const asset::SkeletalAnimation* animation) -> const anim::CompiledClip*
+{
+    if (!animation)
+    {
+        return nullptr;
+    }
+
+    auto pos = m_clips.find(std::pair{rig, animation});
+    if (pos == m_clips.end())
+    {
+        pos = m_clips.emplace(std::pair{rig, animation}, CompileClip(*rig, *animation)).first;
+    }
+
+    return &pos->second;
+}
+
 void SkeletalAnimationSystem::OnStateChanged(const anim::StateChange& stateChange)
 {
     if (stateChange.action == anim::Action::Stop)
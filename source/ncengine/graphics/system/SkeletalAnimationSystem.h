@@ -7,13 +7,21 @@
 #include "graphics/shader_resource/StorageBufferHandle.h"
 #include "graphics/SkeletalAnimator.h"
 #include "graphics/SkeletalAnimationTypes.h"
+#include "task/AsyncDispatcher.h"
+
+#include <map>
+#include <span>
 
 namespace nc::graphics
 {
+struct AnimationLod;
+struct CameraState;
+
 struct SkeletalAnimationSystemState
 {
-    // Index consumed by shader that signifies first animation matrix for the given animation
-    std::unordered_map<Entity::index_type, uint32_t> animationIndices;
+    // Index consumed by shader that signifies first animation matrix for the given animation, indexed by
+    // entity index. Entities without an animation map to UINT32_MAX or are out of range.
+    std::span<const uint32_t> animationIndices;
 };
 
 constexpr uint32_t AvgBonesPerAnim = 10u;
@@ -24,15 +32,30 @@ class SkeletalAnimationSystem : public StableAddress
         SkeletalAnimationSystem(Registry* registry,
                                 ShaderResourceBus* shaderResourceBus,
                                 uint32_t maxSkeletalAnimations,
+                                const task::AsyncDispatcher& dispatcher,
                                 Signal<const asset::SkeletalAnimationUpdateEventData&>& onSkeletalAnimationUpdate,
                                 Signal<const asset::BoneUpdateEventData&>& onBonesUpdate);
         
-        auto Execute(uint32_t frameIndex) -> SkeletalAnimationSystemState;
+        // Units are evaluated at a rate and detail chosen from their distance to the camera. visibleEntities flags
+        // entity indices drawn last frame; entities out of its range are treated as hidden once they have been
+        // evaluated, and everything is treated as visible if it is empty.
+        auto Execute(uint32_t frameIndex,
+                     const CameraState& cameraState,
+                     std::span<const uint8_t> visibleEntities = {}) -> SkeletalAnimationSystemState;
         void Start(const anim::StateChange& stateChange);
         void Stop(const anim::StateChange& stateChange);
         void Clear() noexcept;
 
     private:
+        // Working memory reused across frames by one task evaluating units
+        struct AnimationScratch
+        {
+            anim::PackedAnimationDecomposed blendFromSample;
+            anim::PackedAnimationDecomposed blendToSample;
+            anim::PackedAnimation composed;
+            std::vector<DirectX::XMMATRIX> boneToParent;
+        };
+
         // Asset signals
         void UpdateSkeletalAnimationStorage(const asset::SkeletalAnimationUpdateEventData& eventData);
         void UpdateBonesStorage(const asset::BoneUpdateEventData& eventData);
@@ -42,7 +65,14 @@ class SkeletalAnimationSystem : public StableAddress
         void Add(SkeletalAnimator& animator);
         void Remove(Entity entity);
 
+        // Get the clip compiled for an animation played on a rig, compiling it on first use
+        auto GetClip(const anim::PackedRig* rig, const asset::SkeletalAnimation* animation) -> const anim::CompiledClip*;
+
+        // Evaluate units [begin, end) into their ranges of m_animatedBones
+        void AnimateUnits(size_t begin, size_t end, AnimationScratch& scratch);
+
         Registry* m_registry;
+        task::AsyncDispatcher m_dispatcher;
 
         // Mesh assets
         std::unordered_map<std::string, anim::PackedRig> m_rigs;
@@ -52,6 +82,9 @@ class SkeletalAnimationSystem : public StableAddress
         std::unordered_map<std::string, asset::SkeletalAnimation> m_animationAssets;
         nc::Connection m_onSkeletalAnimationUpdate;
 
+        // Animations resolved against each rig they are played on
+        std::map<std::pair<const anim::PackedRig*, const asset::SkeletalAnimation*>, anim::CompiledClip> m_clips;
+
         // Component registration
         Connection m_onAddConnection;
         Connection m_onRemoveConnection;
@@ -61,6 +94,16 @@ class SkeletalAnimationSystem : public StableAddress
         // Animation data sandbox
         std::vector<Entity> m_unitEntities;
         std::vector<anim::UnitOfWork> m_units;
+        std::vector<uint32_t> m_unitOffsets; // first output matrix per unit, followed by the total
+        std::vector<const AnimationLod*> m_unitLods; // level for units evaluated this frame, null if reusing last pose
+        std::vector<AnimationScratch> m_scratch;
+
+        // Frame output, kept to avoid reallocating each frame
+        std::vector<SkeletalAnimationData> m_animatedBones;
+        std::vector<SkeletalAnimationData> m_previousAnimatedBones;
+        std::vector<uint32_t> m_animationIndices;
+        uint64_t m_frameCount = 0ull;
+        uint32_t m_nextUpdatePhase = 0u;
 
         // GPU
         StorageBufferHandle m_skeletalAnimationDataBuffer;
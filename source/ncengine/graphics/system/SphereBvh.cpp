@@ -0,0 +1,306 @@
+#include "SphereBvh.h"
+
+#include "ncutility/NcError.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+constexpr auto g_paddingRadius = std::numeric_limits<float>::lowest();
+constexpr auto g_allPlanes = uint8_t{0b00111111};
+constexpr auto g_maxQueryDepth = size_t{64};
+
+auto GetPlanes(const nc::Frustum& frustum) -> std::array<nc::Plane, 6>
+{
+    return {frustum.front, frustum.left, frustum.right, frustum.top, frustum.bottom, frustum.back};
+}
+
+auto Min(const nc::Vector3& a, const nc::Vector3& b) -> nc::Vector3
+{
+    return nc::Vector3{std::min(a.x, b.x), std::min(a.y, b.y), std::min(a.z, b.z)};
+}
+
+auto Max(const nc::Vector3& a, const nc::Vector3& b) -> nc::Vector3
+{
+    return nc::Vector3{std::max(a.x, b.x), std::max(a.y, b.y), std::max(a.z, b.z)};
+}
+
+auto Element(const nc::Vector3& vec, int axis) -> float
+{
+    return axis == 0 ? vec.x : axis == 1 ? vec.y : vec.z;
+}
+
+auto SquareDistanceToBox(const nc::Vector3& point, const nc::Vector3& min, const nc::Vector3& max) -> float
+{
+    const auto dx = std::max({min.x - point.x, 0.0f, point.x - max.x});
+    const auto dy = std::max({min.y - point.y, 0.0f, point.y - max.y});
+    const auto dz = std::max({min.z - point.z, 0.0f, point.z - max.z});
+    return dx * dx + dy * dy + dz * dz;
+}
+} // anonymous namespace
+
+namespace nc::graphics
+{
+void SphereBvh::Build(std::span<const Sphere> spheres, std::span<const uint32_t> ids)
+{
+    NC_ASSERT(spheres.size() == ids.size(), "Expected an id for each sphere");
+    Clear();
+    if (spheres.empty())
+    {
+        return;
+    }
+
+    m_itemCount = spheres.size();
+    auto order = std::vector<uint32_t>(spheres.size());
+    for (auto i = 0u; i < order.size(); ++i)
+    {
+        order[i] = i;
+    }
+
+    BuildNode(order, spheres, ids);
+}
+
+void SphereBvh::Refit(std::span<const Sphere> spheres)
+{
+    NC_ASSERT(spheres.size() == m_itemCount, "Refit requires the spheres the tree was built from");
+    for (auto i = 0ull; i < m_ids.size(); ++i)
+    {
+        if (m_ids[i] == NullId)
+        {
+            continue;
+        }
+
+        const auto& sphere = spheres[m_sources[i]];
+        m_x[i] = sphere.center.x;
+        m_y[i] = sphere.center.y;
+        m_z[i] = sphere.center.z;
+        m_radius[i] = sphere.radius;
+    }
+
+    // Children always follow their parent, so a reverse sweep fits children before parents
+    for (auto i = m_nodes.size(); i-- > 0;)
+    {
+        auto& node = m_nodes[i];
+        if (node.secondChild == 0)
+        {
+            FitNode(node);
+            continue;
+        }
+
+        const auto& first = m_nodes[i + 1];
+        const auto& second = m_nodes[node.secondChild];
+        node.min = ::Min(first.min, second.min);
+        node.max = ::Max(first.max, second.max);
+    }
+}
+
+void SphereBvh::Clear() noexcept
+{
+    m_nodes.clear();
+    m_x.clear();
+    m_y.clear();
+    m_z.clear();
+    m_radius.clear();
+    m_ids.clear();
+    m_sources.clear();
+    m_itemCount = 0ull;
+}
+
+void SphereBvh::Query(const Frustum& frustum, uint8_t* visible) const
+{
+    if (!m_nodes.empty())
+    {
+        QueryNode(0u, ::GetPlanes(frustum), BuildCullingFrustum(frustum), g_allPlanes, visible);
+    }
+}
+
+void SphereBvh::Query(const Sphere& volume, std::vector<uint32_t>& out) const
+{
+    if (m_nodes.empty())
+    {
+        return;
+    }
+
+    auto stack = std::array<uint32_t, g_maxQueryDepth>{};
+    auto stackSize = size_t{1};
+    stack[0] = 0u;
+    while (stackSize > 0)
+    {
+        const auto& node = m_nodes[stack[--stackSize]];
+        if (::SquareDistanceToBox(volume.center, node.min, node.max) > volume.radius * volume.radius)
+        {
+            continue;
+        }
+
+        if (node.secondChild != 0)
+        {
+            NC_ASSERT(stackSize + 2 <= g_maxQueryDepth, "SphereBvh query stack overflow");
+            stack[stackSize++] = node.secondChild;
+            stack[stackSize++] = static_cast<uint32_t>(&node - m_nodes.data()) + 1u;
+            continue;
+        }
+
+        for (auto i = node.offset; i < node.offset + node.count; ++i)
+        {
+            const auto reach = volume.radius + m_radius[i];
+            if (m_ids[i] != NullId && SquareDistance(volume.center, Vector3{m_x[i], m_y[i], m_z[i]}) <= reach * reach)
+            {
+                out.push_back(m_ids[i]);
+            }
+        }
+    }
+}
+
+auto SphereBvh::BuildNode(std::span<uint32_t> order, std::span<const Sphere> spheres, std::span<const uint32_t> ids) -> uint32_t
+{
+    const auto index = static_cast<uint32_t>(m_nodes.size());
+    m_nodes.emplace_back();
+
+    if (order.size() <= LeafSize)
+    {
+        const auto offset = static_cast<uint32_t>(m_ids.size());
+        for (auto source : order)
+        {
+            const auto& sphere = spheres[source];
+            m_x.push_back(sphere.center.x);
+            m_y.push_back(sphere.center.y);
+            m_z.push_back(sphere.center.z);
+            m_radius.push_back(sphere.radius);
+            m_ids.push_back(ids[source]);
+            m_sources.push_back(source);
+        }
+
+        // Pad so the leaf can be culled a full lane group at a time
+        while (m_ids.size() % CullingLaneCount != 0)
+        {
+            m_x.push_back(0.0f);
+            m_y.push_back(0.0f);
+            m_z.push_back(0.0f);
+            m_radius.push_back(g_paddingRadius);
+            m_ids.push_back(NullId);
+            m_sources.push_back(NullId);
+        }
+
+        auto& leaf = m_nodes[index];
+        leaf.offset = offset;
+        leaf.count = static_cast<uint32_t>(m_ids.size()) - offset;
+        leaf.secondChild = 0u;
+        FitNode(leaf);
+        return index;
+    }
+
+    // Split at the median along the longest axis of the sphere centers
+    auto centerMin = spheres[order.front()].center;
+    auto centerMax = centerMin;
+    for (auto source : order)
+    {
+        centerMin = ::Min(centerMin, spheres[source].center);
+        centerMax = ::Max(centerMax, spheres[source].center);
+    }
+
+    const auto extent = centerMax - centerMin;
+    const auto axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : extent.y >= extent.z ? 1 : 2;
+    const auto half = order.size() / 2;
+    std::ranges::nth_element(order, order.begin() + half, {}, [&spheres, axis](uint32_t source)
+    {
+        return ::Element(spheres[source].center, axis);
+    });
+
+    const auto firstChild = BuildNode(order.first(half), spheres, ids);
+    const auto secondChild = BuildNode(order.subspan(half), spheres, ids);
+    auto& node = m_nodes[index];
+    const auto& first = m_nodes[firstChild];
+    const auto& second = m_nodes[secondChild];
+    node.offset = first.offset;
+    node.count = second.offset + second.count - first.offset;
+    node.secondChild = secondChild;
+    node.min = ::Min(first.min, second.min);
+    node.max = ::Max(first.max, second.max);
+    return index;
+}
+
+void SphereBvh::QueryNode(uint32_t index, const std::array<Plane, 6>& planes, const CullingFrustum& splatFrustum, uint8_t planeMask, uint8_t* visible) const
+{
+    const auto& node = m_nodes[index];
+    const auto center = (node.min + node.max) * 0.5f;
+    const auto extent = (node.max - node.min) * 0.5f;
+    for (auto i = 0u; i < planes.size(); ++i)
+    {
+        const auto bit = static_cast<uint8_t>(1u << i);
+        if (!(planeMask & bit))
+        {
+            continue;
+        }
+
+        // Reject boxes fully behind any plane, and stop testing planes the box is fully in front of
+        const auto& [normal, d] = planes[i];
+        const auto distance = Dot(normal, center) - d;
+        const auto reach = extent.x * std::abs(normal.x) + extent.y * std::abs(normal.y) + extent.z * std::abs(normal.z);
+        if (distance + reach < 0.0f)
+        {
+            return;
+        }
+
+        if (distance - reach >= 0.0f)
+        {
+            planeMask &= static_cast<uint8_t>(~bit);
+        }
+    }
+
+    if (planeMask == 0)
+    {
+        AcceptRange(node.offset, node.count, visible);
+        return;
+    }
+
+    if (node.secondChild == 0)
+    {
+        auto leafVisible = std::array<uint8_t, LeafSize>{};
+        CullSpheres(splatFrustum, &m_x[node.offset], &m_y[node.offset], &m_z[node.offset], &m_radius[node.offset], node.count, leafVisible.data());
+        for (auto i = 0u; i < node.count; ++i)
+        {
+            if (leafVisible[i])
+            {
+                visible[m_ids[node.offset + i]] = 1;
+            }
+        }
+
+        return;
+    }
+
+    QueryNode(index + 1, planes, splatFrustum, planeMask, visible);
+    QueryNode(node.secondChild, planes, splatFrustum, planeMask, visible);
+}
+
+void SphereBvh::AcceptRange(uint32_t offset, uint32_t count, uint8_t* visible) const noexcept
+{
+    for (auto i = offset; i < offset + count; ++i)
+    {
+        if (m_ids[i] != NullId)
+        {
+            visible[m_ids[i]] = 1;
+        }
+    }
+}
+
+void SphereBvh::FitNode(Node& node) const noexcept
+{
+    constexpr auto inf = std::numeric_limits<float>::max();
+    node.min = Vector3{inf, inf, inf};
+    node.max = Vector3{-inf, -inf, -inf};
+    for (auto i = node.offset; i < node.offset + node.count; ++i)
+    {
+        if (m_ids[i] == NullId)
+        {
+            continue;
+        }
+
+        const auto radius = Vector3{m_radius[i], m_radius[i], m_radius[i]};
+        const auto center = Vector3{m_x[i], m_y[i], m_z[i]};
+        node.min = ::Min(node.min, center - radius);
+        node.max = ::Max(node.max, center + radius);
+    }
+}
+} // namespace nc::graphics
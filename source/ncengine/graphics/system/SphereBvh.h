@@ -0,0 +1,69 @@
+#pragma once
+
+#include "FrustumCulling.h"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace nc::graphics
+{
+/**
+ * Bounding volume hierarchy over bounding spheres.
+ *
+ * Nodes hold axis-aligned bounds and are laid out depth first, so every subtree covers a contiguous range of
+ * items. Item spheres are packed per leaf and padded to CullingLaneCount, letting leaves be culled with
+ * CullSpheres() and fully contained subtrees be accepted without testing their items.
+ *
+ * Build() sorts items into a new tree. Refit() recomputes bounds for moved spheres while keeping the tree's
+ * structure, which is cheap enough to run every frame for dynamic objects.
+ */
+class SphereBvh
+{
+    public:
+        static constexpr uint32_t LeafSize = 16u;
+        static constexpr uint32_t NullId = UINT32_MAX;
+
+        /** Build a tree over spheres. Queries report ids[i] for spheres[i]. */
+        void Build(std::span<const Sphere> spheres, std::span<const uint32_t> ids);
+
+        /** Update bounds from spheres given in the same order as the last Build(). */
+        void Refit(std::span<const Sphere> spheres);
+
+        void Clear() noexcept;
+
+        /** Set visible[id] to 1 for every item intersecting the frustum. */
+        void Query(const Frustum& frustum, uint8_t* visible) const;
+
+        /** Append the id of every item intersecting the sphere to out. */
+        void Query(const Sphere& volume, std::vector<uint32_t>& out) const;
+
+        auto ItemCount() const noexcept -> size_t { return m_itemCount; }
+        auto NodeCount() const noexcept -> size_t { return m_nodes.size(); }
+
+    private:
+        struct Node
+        {
+            Vector3 min;
+            uint32_t offset;     // first packed item in the subtree
+            Vector3 max;
+            uint32_t count;      // packed items in the subtree, including padding
+            uint32_t secondChild; // first child immediately follows its parent; 0 for leaves
+        };
+
+        std::vector<Node> m_nodes;
+        std::vector<float> m_x;
+        std::vector<float> m_y;
+        std::vector<float> m_z;
+        std::vector<float> m_radius;
+        std::vector<uint32_t> m_ids;
+        std::vector<uint32_t> m_sources; // packed item -> index in the spheres passed to Build()
+        size_t m_itemCount = 0ull;
+
+        auto BuildNode(std::span<uint32_t> order, std::span<const Sphere> spheres, std::span<const uint32_t> ids) -> uint32_t;
+        void QueryNode(uint32_t index, const std::array<Plane, 6>& planes, const CullingFrustum& splatFrustum, uint8_t planeMask, uint8_t* visible) const;
+        void AcceptRange(uint32_t offset, uint32_t count, uint8_t* visible) const noexcept;
+        void FitNode(Node& node) const noexcept;
+};
+} // namespace nc::graphics
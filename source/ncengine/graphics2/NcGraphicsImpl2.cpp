@@ -97,10 +97,12 @@ namespace nc::graphics
                              const config::MemorySettings& memorySettings,
                              ModuleProvider modules,
                              Registry* registry,
+                             const task::AsyncDispatcher& dispatcher,
                              SystemEvents& events) -> std::unique_ptr<NcGraphics>
     {
         (void)projectSettings;
         (void)memorySettings;
+        (void)dispatcher;
         (void)events;
 
         if (graphicsSettings.enabled)
@@ -3,62 +3,93 @@
 #include "math/Random.h"
 #include "ncmath/Math.h"
 
+#include <algorithm>
+#include <array>
+#include <functional>
 #include <ranges>
+#include <utility>
 
 namespace
 {
 using namespace nc;
 
-auto ComputeMvp(const particle::Particle& particle,
-                const DirectX::FXMVECTOR& camRotation,
-                const DirectX::FXMVECTOR& camForward) -> DirectX::XMMATRIX
+struct PermutationData
 {
-    const auto rotationRelativeToCamera = DirectX::XMQuaternionRotationAxis(camForward, particle.rotation);
-    const auto rotation = DirectX::XMQuaternionMultiply(camRotation, rotationRelativeToCamera);
-    return DirectX::XMMatrixScaling(particle.scale, particle.scale, particle.scale) *
-           DirectX::XMMatrixRotationQuaternion(rotation) *
-           DirectX::XMMatrixTranslationFromVector(DirectX::XMLoadVector3(&particle.position));
+    int index;
+    float distance;
+};
+
+template<class F>
+void ForEachArray(particle::ParticleSoA& particles, F&& func)
+{
+    auto arrays = std::array{
+        &particles.positionX, &particles.positionY, &particles.positionZ,
+        &particles.velocityX, &particles.velocityY, &particles.velocityZ,
+        &particles.rotation, &particles.angularVelocity, &particles.scale,
+        &particles.currentLifetime, &particles.maxLifetime
+    };
+
+    for (auto* array : arrays)
+    {
+        func(*array);
+    }
 }
 
-particle::Particle CreateParticle(const graphics::ParticleInfo& info, const Vector3& positionOffset, Random* random)
+void AddParticle(particle::ParticleSoA& particles,
+                 const graphics::ParticleInfo& info,
+                 const Vector3& positionOffset,
+                 Random& random)
 {
     const auto& [emission, init, kinematic] = info;
-    return particle::Particle
-    {
-        .maxLifetime = init.lifetime,
-        .currentLifetime = 0.0f,
-        .position = positionOffset + random->Between(init.positionMin, init.positionMax),
-        .linearVelocity = random->Between(kinematic.velocityMin, kinematic.velocityMax),
-        .rotation = random->Between(init.rotationMin, init.rotationMax),
-        .angularVelocity = random->Between(kinematic.rotationMin, kinematic.rotationMax),
-        .scale = random->Between(init.scaleMin, init.scaleMax)
-    };
+    const auto position = positionOffset + random.Between(init.positionMin, init.positionMax);
+    const auto velocity = random.Between(kinematic.velocityMin, kinematic.velocityMax);
+    particles.positionX.push_back(position.x);
+    particles.positionY.push_back(position.y);
+    particles.positionZ.push_back(position.z);
+    particles.velocityX.push_back(velocity.x);
+    particles.velocityY.push_back(velocity.y);
+    particles.velocityZ.push_back(velocity.z);
+    particles.rotation.push_back(random.Between(init.rotationMin, init.rotationMax));
+    particles.angularVelocity.push_back(random.Between(kinematic.rotationMin, kinematic.rotationMax));
+    particles.scale.push_back(random.Between(init.scaleMin, init.scaleMax));
+    particles.currentLifetime.push_back(0.0f);
+    particles.maxLifetime.push_back(init.lifetime);
 }
+} // anonymous namespace
 
-void ApplyKinematics(particle::Particle* particle, float dt, float velOverTimeFactor, float rotOverTimeFactor, float sclOverTimeFactor)
+namespace nc::particle
+{
+void ParticleSoA::Reserve(size_t capacity)
 {
-    auto& vel = particle->linearVelocity;
-    vel = vel + vel * velOverTimeFactor;
-    particle->position = particle->position + vel * dt;
+    ForEachArray(*this, [capacity](auto& array) { array.reserve(capacity); });
+}
 
-    auto& angVel = particle->angularVelocity;
-    angVel += angVel * rotOverTimeFactor;
-    particle->rotation += angVel * dt;
+void ParticleSoA::Clear() noexcept
+{
+    ForEachArray(*this, [](auto& array) { array.clear(); });
+}
 
-    auto& scale = particle->scale;
-    scale = Clamp(scale + scale * sclOverTimeFactor * dt, 0.000001f, 5000.0f); // defaults?
+void ParticleSoA::ShrinkToFit()
+{
+    ForEachArray(*this, [](auto& array) { array.shrink_to_fit(); });
 }
-} // anonymous namespace
 
-namespace nc::particle
+void ParticleSoA::RemoveUnstable(size_t index) noexcept
 {
-EmitterState::EmitterState(ecs::ExplicitEcs<Transform> transforms, Entity entity, const graphics::ParticleInfo& info, Random* random)
+    ForEachArray(*this, [index](auto& array)
+    {
+        array[index] = array.back();
+        array.pop_back();
+    });
+}
+
+EmitterState::EmitterState(ecs::ExplicitEcs<Transform> transforms, Entity entity, const graphics::ParticleInfo& info, Random random)
     : m_info{ info },
       m_transforms{ transforms },
       m_entity{ entity },
-      m_random{ random }
+      m_random{ std::move(random) }
 {
-    m_particles.reserve(info.emission.maxParticleCount);
+    m_particles.Reserve(info.emission.maxParticleCount);
     Emit(m_info.emission.initialEmissionCount);
 }
 
@@ -67,54 +98,35 @@ void EmitterState::Emit(size_t count)
     m_lastPosition = m_transforms.Get<Transform>(m_entity).PositionXM();
     auto parentPosition = Vector3{};
     DirectX::XMStoreVector3(&parentPosition, m_lastPosition);
-    const auto particleCount = Min(count, m_particles.capacity() - m_particles.size());
-    std::ranges::generate_n(
-        std::back_inserter(m_particles),
-        particleCount,
-        [this, &parentPosition]()
-        {
-            return CreateParticle(m_info, parentPosition, m_random);
-        }
-    );
+    const auto particleCount = Min(count, m_particles.Capacity() - m_particles.Size());
+    for (auto i = 0ull; i < particleCount; ++i)
+    {
+        ::AddParticle(m_particles, m_info, parentPosition, m_random);
+    }
 }
 
-void EmitterState::Update(float dt, const DirectX::FXMVECTOR& camRotation, const DirectX::FXMVECTOR& camForward)
+void EmitterState::Update(float dt, DirectX::FXMMATRIX camRotation)
 {
     if (m_needsResize)
     {
         // We can't just reserve because the capacity is logically important. In the case of shrinking, we'd need
         // to be careful to handle that correctly. Since this functionality is only intended for the editor, we
         // can get away with a simple 'kill everything' approach.
-        m_particles.clear();
-        m_particles.shrink_to_fit();
-        m_particles.reserve(m_info.emission.maxParticleCount);
+        m_particles.Clear();
+        m_particles.ShrinkToFit();
+        m_particles.Reserve(m_info.emission.maxParticleCount);
         m_needsResize = false;
     }
 
     PeriodicEmission(dt);
     m_matrices.clear();
 
-    if (m_particles.empty())
+    if (m_particles.Size() == 0)
         return;
 
-    const auto velOverTimeFactor = m_info.kinematic.velocityOverTimeFactor * dt;
-    const auto rotOverTimeFactor = m_info.kinematic.rotationOverTimeFactor * dt;
-    const auto sclOverTimeFactor = m_info.kinematic.scaleOverTimeFactor * dt;
-
-    for (auto& particle : std::views::reverse(m_particles))
-    {
-        particle.currentLifetime += dt;
-        if (particle.currentLifetime >= particle.maxLifetime)
-        {
-            particle = m_particles.back();
-            m_particles.pop_back();
-        }
-        else
-        {
-            ApplyKinematics(&particle, dt, velOverTimeFactor, rotOverTimeFactor, sclOverTimeFactor);
-            m_matrices.push_back(::ComputeMvp(particle, camRotation, camForward));
-        }
-    }
+    RemoveExpired(dt);
+    ApplyKinematics(dt);
+    ComputeMatrices(camRotation);
 }
 
 void EmitterState::UpdateInfo(const graphics::ParticleInfo& info)
@@ -140,4 +152,149 @@ void EmitterState::PeriodicEmission(float dt)
         }
     }
 }
+
+void EmitterState::RemoveExpired(float dt)
+{
+    auto& lifetimes = m_particles.currentLifetime;
+    for (auto& lifetime : lifetimes)
+    {
+        lifetime += dt;
+    }
+
+    // Iterate in reverse so swapped in particles have already been checked
+    for (auto i = m_particles.Size(); i-- > 0;)
+    {
+        if (lifetimes[i] >= m_particles.maxLifetime[i])
+        {
+            m_particles.RemoveUnstable(i);
+        }
+    }
+}
+
+void EmitterState::ApplyKinematics(float dt)
+{
+    // Loops are kept branch-free over contiguous floats so the compiler can vectorize them.
+    const auto count = m_particles.Size();
+    const auto velocityFactor = 1.0f + m_info.kinematic.velocityOverTimeFactor * dt;
+    const auto rotationFactor = 1.0f + m_info.kinematic.rotationOverTimeFactor * dt;
+    const auto scaleFactor = 1.0f + m_info.kinematic.scaleOverTimeFactor * dt * dt;
+    auto* px = m_particles.positionX.data();
+    auto* py = m_particles.positionY.data();
+    auto* pz = m_particles.positionZ.data();
+    auto* vx = m_particles.velocityX.data();
+    auto* vy = m_particles.velocityY.data();
+    auto* vz = m_particles.velocityZ.data();
+    auto* rot = m_particles.rotation.data();
+    auto* angVel = m_particles.angularVelocity.data();
+    auto* scale = m_particles.scale.data();
+
+    for (auto i = 0ull; i < count; ++i)
+    {
+        vx[i] *= velocityFactor;
+        vy[i] *= velocityFactor;
+        vz[i] *= velocityFactor;
+        px[i] += vx[i] * dt;
+        py[i] += vy[i] * dt;
+        pz[i] += vz[i] * dt;
+    }
+
+    for (auto i = 0ull; i < count; ++i)
+    {
+        angVel[i] *= rotationFactor;
+        rot[i] += angVel[i] * dt;
+    }
+
+    for (auto i = 0ull; i < count; ++i)
+    {
+        scale[i] = Clamp(scale[i] * scaleFactor, 0.000001f, 5000.0f); // defaults?
+    }
+}
+
+void EmitterState::ComputeMatrices(DirectX::FXMMATRIX camRotation)
+{
+    using namespace DirectX;
+
+    // Billboards rotate about the camera's forward axis, so camRotation * R(forward, angle) simplifies to
+    // RotationZ(angle) * camRotation. Each particle then only needs a sin/cos and two blended camera rows, and the
+    // sin/cos for four particles are computed at once.
+    const auto count = m_particles.Size();
+    m_matrices.resize(count);
+    const auto& p = m_particles;
+    alignas(16) float sinScaled[4];
+    alignas(16) float cosScaled[4];
+    alignas(16) float scaled[4];
+
+    for (auto i = size_t{0}; i < count; i += 4)
+    {
+        const auto lanes = Min(count - i, size_t{4});
+        XMVECTOR rotation;
+        XMVECTOR scale;
+        if (lanes == 4)
+        {
+            rotation = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(p.rotation.data() + i));
+            scale = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(p.scale.data() + i));
+        }
+        else
+        {
+            alignas(16) float rotationTail[4] = {};
+            alignas(16) float scaleTail[4] = {};
+            std::copy_n(p.rotation.data() + i, lanes, rotationTail);
+            std::copy_n(p.scale.data() + i, lanes, scaleTail);
+            rotation = XMLoadFloat4A(reinterpret_cast<const XMFLOAT4A*>(rotationTail));
+            scale = XMLoadFloat4A(reinterpret_cast<const XMFLOAT4A*>(scaleTail));
+        }
+
+        XMVECTOR sin;
+        XMVECTOR cos;
+        XMVectorSinCos(&sin, &cos, rotation);
+        XMStoreFloat4A(reinterpret_cast<XMFLOAT4A*>(sinScaled), XMVectorMultiply(sin, scale));
+        XMStoreFloat4A(reinterpret_cast<XMFLOAT4A*>(cosScaled), XMVectorMultiply(cos, scale));
+        XMStoreFloat4A(reinterpret_cast<XMFLOAT4A*>(scaled), scale);
+
+        for (auto lane = 0ull; lane < lanes; ++lane)
+        {
+            const auto index = i + lane;
+            const auto s = XMVectorReplicate(sinScaled[lane]);
+            const auto c = XMVectorReplicate(cosScaled[lane]);
+            auto& out = m_matrices[index];
+            out.r[0] = XMVectorMultiplyAdd(c, camRotation.r[0], XMVectorMultiply(s, camRotation.r[1]));
+            out.r[1] = XMVectorNegativeMultiplySubtract(s, camRotation.r[0], XMVectorMultiply(c, camRotation.r[1]));
+            out.r[2] = XMVectorMultiply(XMVectorReplicate(scaled[lane]), camRotation.r[2]);
+            out.r[3] = XMVectorSet(p.positionX[index], p.positionY[index], p.positionZ[index], 1.0f);
+        }
+    }
+}
+
+void SortBackToFront(std::vector<EmitterState>& emitters, DirectX::FXMVECTOR cameraPosition)
+{
+    // Build up an index array for sorting to help minimize number of swaps and distance calculations
+    auto permutation = std::vector<PermutationData>{};
+    permutation.reserve(emitters.size());
+    for (auto [i, emitter] : std::views::enumerate(emitters))
+    {
+        const auto offsetFromCamera = DirectX::XMVectorSubtract(cameraPosition, emitter.GetLastPosition());
+        const auto sqLength = DirectX::XMVector3LengthSq(offsetFromCamera);
+        permutation.emplace_back(static_cast<int>(i), DirectX::XMVectorGetX(sqLength));
+    }
+
+    // Sort back to front based on distance from camera
+    std::ranges::sort(permutation, std::greater<>{}, &PermutationData::distance);
+
+    // Apply the permutation by walking cycles
+    const auto emitterCount = static_cast<int>(emitters.size());
+    for (int cycleStart = 0; cycleStart < emitterCount; ++cycleStart)
+    {
+        auto cycleCurrent = cycleStart;
+        while (permutation[cycleCurrent].index >= 0)
+        {
+            const auto emitterIndex = permutation[cycleCurrent].index;
+            if (cycleCurrent != emitterIndex && permutation[emitterIndex].index >= 0)
+            {
+                std::swap(emitters[cycleCurrent], emitters[emitterIndex]);
+            }
+
+            cycleCurrent = std::exchange(permutation[cycleCurrent].index, -1);
+        }
+    }
+}
 } // namespace nc::particle
@@ -10,24 +10,36 @@
 
 namespace nc::particle
 {
-struct Particle
+/** Particle state stored as parallel arrays so update kernels can process several particles at once. */
+struct ParticleSoA
 {
-    float maxLifetime;
-    float currentLifetime;
-    Vector3 position;
-    Vector3 linearVelocity;
-    float rotation;
-    float angularVelocity;
-    float scale;
+    std::vector<float> positionX;
+    std::vector<float> positionY;
+    std::vector<float> positionZ;
+    std::vector<float> velocityX;
+    std::vector<float> velocityY;
+    std::vector<float> velocityZ;
+    std::vector<float> rotation;
+    std::vector<float> angularVelocity;
+    std::vector<float> scale;
+    std::vector<float> currentLifetime;
+    std::vector<float> maxLifetime;
+
+    auto Size() const noexcept -> size_t { return positionX.size(); }
+    auto Capacity() const noexcept -> size_t { return positionX.capacity(); }
+    void Reserve(size_t capacity);
+    void Clear() noexcept;
+    void ShrinkToFit();
+    void RemoveUnstable(size_t index) noexcept;
 };
 
 class EmitterState
 {
 public:
-    EmitterState(ecs::ExplicitEcs<Transform> transforms, Entity entity, const graphics::ParticleInfo& info, Random* random);
+    EmitterState(ecs::ExplicitEcs<Transform> transforms, Entity entity, const graphics::ParticleInfo& info, Random random);
 
     void Emit(size_t count);
-    void Update(float dt, const DirectX::FXMVECTOR& camRotation, const DirectX::FXMVECTOR& camForward);
+    void Update(float dt, DirectX::FXMMATRIX camRotation);
     void UpdateInfo(const graphics::ParticleInfo& info);
 
     auto GetInfo() const noexcept -> const graphics::ParticleInfo& { return m_info; }
@@ -38,15 +50,21 @@ public:
 
 private:
     void PeriodicEmission(float dt);
+    void RemoveExpired(float dt);
+    void ApplyKinematics(float dt);
+    void ComputeMatrices(DirectX::FXMMATRIX camRotation);
 
     DirectX::XMVECTOR m_lastPosition = DirectX::g_XMZero;
-    std::vector<Particle> m_particles;
+    ParticleSoA m_particles;
     std::vector<DirectX::XMMATRIX> m_matrices;
     graphics::ParticleInfo m_info;
     ecs::ExplicitEcs<Transform> m_transforms;
     Entity m_entity;
-    Random* m_random;
+    Random m_random;
     float m_emissionCounter = 0.0f;
     bool m_needsResize = false;
 };
+
+/** Reorder emitters back to front by the distance from their last emission position to the camera. */
+void SortBackToFront(std::vector<EmitterState>& emitters, DirectX::FXMVECTOR cameraPosition);
 } // namespace nc::particle
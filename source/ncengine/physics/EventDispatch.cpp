@@ -4,8 +4,28 @@
 #include "ncengine/ecs/Ecs.h"
 #include "ncengine/physics/CollisionListener.h"
 
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
 namespace
 {
+enum class EventType : uint8_t
+{
+    Enter,
+    TriggerEnter,
+    Exit,
+    TriggerExit
+};
+
+struct EventRecord
+{
+    nc::Entity target;
+    nc::Entity other;
+    EventType type;
+    const nc::HitInfo* hit;
+};
+
 void Dispatch(auto&& memberCallback,
               nc::Entity target,
               nc::Entity other,
@@ -62,17 +82,110 @@ void Dispatch(auto&& callback,
         Dispatch(callback, second, first, world, pool);
     }
 }
+
+void Record(std::vector<EventRecord>& out,
+            EventType type,
+            nc::Entity target,
+            nc::Entity other,
+            const nc::HitInfo* hit,
+            nc::ecs::ComponentPool<nc::CollisionListener>& pool)
+{
+    if (target.ReceivesCollisionEvents() && pool.Contains(target))
+    {
+        out.emplace_back(target, other, type, hit);
+    }
+}
+
+void Record(std::vector<EventRecord>& out,
+            EventType type,
+            std::span<const nc::physics::CollisionPair> events,
+            nc::ecs::ComponentPool<nc::CollisionListener>& pool)
+{
+    for (const auto& [overlapping, hit] : events)
+    {
+        Record(out, type, overlapping.first, overlapping.second, &hit, pool);
+        Record(out, type, overlapping.second, overlapping.first, &hit, pool);
+    }
+}
+
+void Record(std::vector<EventRecord>& out,
+            EventType type,
+            std::span<const nc::physics::OverlappingPair> events,
+            nc::ecs::ComponentPool<nc::CollisionListener>& pool)
+{
+    for (const auto& [_, first, second] : events)
+    {
+        Record(out, type, first, second, nullptr, pool);
+        Record(out, type, second, first, nullptr, pool);
+    }
+}
+
+void DispatchGrouped(const nc::physics::ContactBuffer& events,
+                     nc::ecs::Ecs& world,
+                     nc::ecs::ComponentPool<nc::CollisionListener>& pool)
+{
+    auto records = std::vector<EventRecord>{};
+    records.reserve(2 * (events.enteredCollisions.size() +
+                         events.enteredTriggers.size() +
+                         events.exitedCollisions.size() +
+                         events.exitedTriggers.size()));
+
+    Record(records, EventType::Enter, std::span{events.enteredCollisions}, pool);
+    Record(records, EventType::TriggerEnter, std::span{events.enteredTriggers}, pool);
+    Record(records, EventType::Exit, std::span{events.exitedCollisions}, pool);
+    Record(records, EventType::TriggerExit, std::span{events.exitedTriggers}, pool);
+
+    const auto key = [](const EventRecord& record)
+    {
+        return std::tuple{record.target.Index(), record.type, record.other.Index()};
+    };
+
+    std::ranges::stable_sort(records, {}, key);
+    const auto duplicates = std::ranges::unique(records, {}, key);
+    records.erase(duplicates.begin(), duplicates.end());
+
+    // Listeners are looked up again for each event since callbacks may add or remove them
+    for (const auto& [target, other, type, hit] : records)
+    {
+        switch (type)
+        {
+            case EventType::Enter:
+                Dispatch(&nc::CollisionListener::onEnter, target, other, *hit, world, pool);
+                break;
+            case EventType::TriggerEnter:
+                Dispatch(&nc::CollisionListener::onTriggerEnter, target, other, world, pool);
+                break;
+            case EventType::Exit:
+                Dispatch(&nc::CollisionListener::onExit, target, other, world, pool);
+                break;
+            case EventType::TriggerExit:
+                Dispatch(&nc::CollisionListener::onTriggerExit, target, other, world, pool);
+                break;
+        }
+    }
+}
 } // anonymous namespace
 
 namespace nc::physics
 {
-void DispatchPhysicsEvents(ContactListener& events, ecs::Ecs world)
+void DispatchPhysicsEvents(ContactListener& events, ecs::Ecs world, bool groupByEntity)
 {
-    auto& listenerPool = world.GetPool<CollisionListener>();
-    ::Dispatch(&CollisionListener::onEnter, events.GetNewCollisions(), world, listenerPool);
-    ::Dispatch(&CollisionListener::onTriggerEnter, events.GetNewTriggers(), world, listenerPool);
-    ::Dispatch(&CollisionListener::onExit, events.GetRemovedCollisions(), world, listenerPool);
-    ::Dispatch(&CollisionListener::onTriggerExit, events.GetRemovedTriggers(), world, listenerPool);
+    DispatchPhysicsEvents(events.GetEvents(), world, groupByEntity);
     events.CommitPendingChanges();
 }
+
+void DispatchPhysicsEvents(const ContactBuffer& events, ecs::Ecs world, bool groupByEntity)
+{
+    auto& listenerPool = world.GetPool<CollisionListener>();
+    if (groupByEntity)
+    {
+        ::DispatchGrouped(events, world, listenerPool);
+        return;
+    }
+
+    ::Dispatch(&CollisionListener::onEnter, std::span{events.enteredCollisions}, world, listenerPool);
+    ::Dispatch(&CollisionListener::onTriggerEnter, std::span{events.enteredTriggers}, world, listenerPool);
+    ::Dispatch(&CollisionListener::onExit, std::span{events.exitedCollisions}, world, listenerPool);
+    ::Dispatch(&CollisionListener::onTriggerExit, std::span{events.exitedTriggers}, world, listenerPool);
+}
 } // namespace nc::physics
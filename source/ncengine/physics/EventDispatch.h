@@ -5,6 +5,17 @@
 namespace nc::physics
 {
 class ContactListener;
+struct ContactBuffer;
 
-void DispatchPhysicsEvents(ContactListener& events, ecs::Ecs world);
+/**
+ * Invoke CollisionListener callbacks for events gathered during the last step, then commit them.
+ *
+ * Events are normally delivered in pair order, once for each participant. When groupByEntity is set, they are
+ * instead sorted by receiving entity and repeated (target, other, event) triples are dropped, so each listener
+ * receives its events back to back.
+ */
+void DispatchPhysicsEvents(ContactListener& events, ecs::Ecs world, bool groupByEntity = false);
+
+/** Invoke CollisionListener callbacks for a set of gathered events without committing them. */
+void DispatchPhysicsEvents(const ContactBuffer& events, ecs::Ecs world, bool groupByEntity = false);
 } // namespace nc::physics
@@ -8,8 +8,15 @@
 #include "ncengine/time/Time.h"
 #include "ncengine/utility/Log.h"
 
+#include <algorithm>
+#include <span>
+
 namespace
 {
+// Active bodies synced per parallel chunk
+constexpr auto g_syncChunkSize = size_t{1024};
+constexpr auto g_nullTransformSlot = UINT32_MAX;
+
 [[maybe_unused]]
 auto RegisterDeferredCreateState(nc::ecs::Ecs world) -> std::unique_ptr<nc::physics::DeferredPhysicsCreateState>
 {
@@ -95,21 +102,15 @@ NcPhysicsImpl::NcPhysicsImpl(const config::MemorySettings& memorySettings,
         m_jolt.physicsSystem.GetBodyLockInterfaceNoLock(),
         m_shapeFactory
       },
-      m_deferredState{std::move(deferredState)}
-{
-}
-
-void NcPhysicsImpl::Run()
+      m_deferredState{std::move(deferredState)},
+      m_groupContactEvents{physicsSettings.groupContactEvents},
+      m_transformSlots(memorySettings.maxRigidBodies, g_nullTransformSlot)
 {
-    NC_PROFILE_TASK("NcPhysics::Run", ProfileCategory::Physics);
-    if (!m_updateEnabled)
+    if (physicsSettings.fixedTimeStep > 0.0f)
     {
-        return;
+        m_accumulator.emplace(physicsSettings.fixedTimeStep, physicsSettings.maxSubsteps);
+        m_previousPoses.resize(memorySettings.maxRigidBodies);
     }
-
-    m_jolt.Update(time::DeltaTime());
-    SyncTransforms();
-    DispatchPhysicsEvents(m_jolt.contactListener, m_ecs);
 }
 
 void NcPhysicsImpl::OnBuildTaskGraph(task::UpdateTasks& update, task::RenderTasks&)
@@ -118,34 +119,184 @@ void NcPhysicsImpl::OnBuildTaskGraph(task::UpdateTasks& update, task::RenderTask
     update.Add(
         update_task_id::PhysicsPipeline,
         "PhysicsPipeline",
-        [this](){ this->Run(); },
+        BuildPhysicsGraph(update.GetExceptionContext()),
         {update_task_id::FrameLogicUpdate}
     );
 }
 
-void NcPhysicsImpl::SyncTransforms()
+auto NcPhysicsImpl::BuildPhysicsGraph(task::ExceptionContext& exceptionContext) -> std::unique_ptr<tf::Taskflow>
 {
-    NC_PROFILE_SCOPE("NcPhysics::SyncTransforms", ProfileCategory::Physics);
-    for (auto& body : m_ecs.GetAll<RigidBody>())
+    auto graph = std::make_unique<tf::Taskflow>();
+    auto step = graph->emplace(task::Guard(exceptionContext, [this] { Step(); }))
+                      .name("PhysicsStep");
+
+    auto sync = graph->for_each_index(
+        size_t{0},
+        std::ref(m_syncChunkCount),
+        size_t{1},
+        [this, &exceptionContext](size_t i)
+        {
+            task::Guard(exceptionContext, [this, i] { SyncTransforms(i); })();
+        }
+    ).name("SyncPhysicsTransforms");
+
+    auto dispatch = graph->emplace(task::Guard(exceptionContext, [this] { DispatchEvents(); }))
+                          .name("DispatchPhysicsEvents");
+
+    step.precede(sync);
+    sync.precede(dispatch);
+    return graph;
+}
+
+void NcPhysicsImpl::Step()
+{
+    NC_PROFILE_TASK("NcPhysics::Step", ProfileCategory::Physics);
+    m_activeBodies = nullptr;
+    m_activeBodyCount = 0ull;
+    m_syncChunkCount = 0ull;
+    if (!m_updateEnabled)
     {
-        if (body.GetBodyType() == BodyType::Static)
+        return;
+    }
+
+    if (m_accumulator)
+    {
+        StepFixed();
+    }
+    else
+    {
+        m_jolt.Update(time::DeltaTime());
+    }
+
+    // Sleeping and static bodies never appear in the active list, so syncing scales with awake bodies only
+    m_activeBodies = m_jolt.physicsSystem.GetActiveBodiesUnsafe(JPH::EBodyType::RigidBody);
+    m_activeBodyCount = m_jolt.physicsSystem.GetNumActiveBodies(JPH::EBodyType::RigidBody);
+    m_syncChunkCount = (m_activeBodyCount + g_syncChunkSize - 1) / g_syncChunkSize;
+
+    if (m_accumulator)
+    {
+        SnapDeactivatedBodies();
+        m_interpolatedBodies.assign(m_activeBodies, m_activeBodies + m_activeBodyCount);
+    }
+}
+
+void NcPhysicsImpl::StepFixed()
+{
+    const auto steps = m_accumulator->Advance(time::DeltaTime());
+    const auto stepSeconds = m_accumulator->StepSeconds();
+    for (auto i = 0u; i < steps; ++i)
+    {
+        ++m_stepCount;
+        if (i + 1 == steps)
+        {
+            CapturePreviousPoses();
+        }
+
+        m_jolt.Update(stepSeconds);
+    }
+
+    m_alpha = m_accumulator->Alpha();
+}
+
+void NcPhysicsImpl::CapturePreviousPoses()
+{
+    NC_PROFILE_SCOPE("NcPhysics::CapturePreviousPoses", ProfileCategory::Physics);
+    const auto& lockInterface = m_jolt.physicsSystem.GetBodyLockInterfaceNoLock();
+    const auto* active = m_jolt.physicsSystem.GetActiveBodiesUnsafe(JPH::EBodyType::RigidBody);
+    const auto count = m_jolt.physicsSystem.GetNumActiveBodies(JPH::EBodyType::RigidBody);
+    for (const auto id : std::span{active, count})
+    {
+        if (const auto* apiBody = lockInterface.TryGetBody(id))
+        {
+            m_previousPoses[id.GetIndex()] = PreviousPose{
+                ToXMVectorHomogeneous(apiBody->GetPosition()),
+                ToXMQuaternion(apiBody->GetRotation()),
+                m_stepCount
+            };
+        }
+    }
+}
+
+void NcPhysicsImpl::SnapDeactivatedBodies()
+{
+    // Bodies that fell asleep are no longer synced, so move their Transforms to the final pose now
+    const auto& lockInterface = m_jolt.physicsSystem.GetBodyLockInterfaceNoLock();
+    for (const auto id : m_interpolatedBodies)
+    {
+        const auto* apiBody = lockInterface.TryGetBody(id);
+        if (!apiBody || apiBody->IsActive())
         {
             continue;
         }
 
-        auto* apiBody = reinterpret_cast<JPH::Body*>(body.GetHandle());
-        if (!apiBody->IsActive())
+        auto& transform = GetTransform(id, Entity::FromHash(apiBody->GetUserData()));
+        transform.SetPositionAndRotationXM(
+            ToXMVectorHomogeneous(apiBody->GetPosition()),
+            ToXMQuaternion(apiBody->GetRotation())
+        );
+    }
+}
+
+auto NcPhysicsImpl::GetTransform(JPH::BodyID id, Entity entity) -> Transform&
+{
+    auto& transformPool = m_ecs.GetPool<Transform>();
+    const auto entities = transformPool.GetEntityPool();
+    const auto transforms = transformPool.GetComponents();
+    auto& slot = m_transformSlots[id.GetIndex()];
+    if (slot < entities.size() && entities[slot] == entity)
+    {
+        return transforms[slot];
+    }
+
+    auto& transform = transformPool.Get(entity);
+    const auto index = &transform - transforms.data();
+    slot = index >= 0 && static_cast<size_t>(index) < transforms.size()
+        ? static_cast<uint32_t>(index)
+        : g_nullTransformSlot;
+
+    return transform;
+}
+
+void NcPhysicsImpl::SyncTransforms(size_t chunk)
+{
+    NC_PROFILE_SCOPE("NcPhysics::SyncTransforms", ProfileCategory::Physics);
+    const auto& lockInterface = m_jolt.physicsSystem.GetBodyLockInterfaceNoLock();
+    const auto begin = chunk * g_syncChunkSize;
+    const auto end = std::min(begin + g_syncChunkSize, m_activeBodyCount);
+    for (auto i = begin; i < end; ++i)
+    {
+        const auto id = m_activeBodies[i];
+        const auto* apiBody = lockInterface.TryGetBody(id);
+        if (!apiBody)
         {
             continue;
         }
 
-        const auto position = ToXMVectorHomogeneous(apiBody->GetPosition());
-        const auto orientation = ToXMQuaternion(apiBody->GetRotation());
-        auto& transform = m_ecs.Get<Transform>(body.GetEntity());
+        auto position = ToXMVectorHomogeneous(apiBody->GetPosition());
+        auto orientation = ToXMQuaternion(apiBody->GetRotation());
+        if (m_accumulator)
+        {
+            // Bodies activated during the last step have no previous pose and snap to the current one
+            const auto& previous = m_previousPoses[id.GetIndex()];
+            if (previous.step == m_stepCount)
+            {
+                position = DirectX::XMVectorLerp(previous.position, position, m_alpha);
+                orientation = DirectX::XMQuaternionSlerp(previous.rotation, orientation, m_alpha);
+            }
+        }
+
+        // Bodies are unique across chunks, so each slot and Transform is only touched by one thread
+        auto& transform = GetTransform(id, Entity::FromHash(apiBody->GetUserData()));
         transform.SetPositionAndRotationXM(position, orientation);
     }
 }
 
+void NcPhysicsImpl::DispatchEvents()
+{
+    NC_PROFILE_SCOPE("NcPhysics::DispatchEvents", ProfileCategory::Physics);
+    DispatchPhysicsEvents(m_jolt.contactListener, m_ecs, m_groupContactEvents);
+}
+
 void NcPhysicsImpl::OnBeforeSceneLoad()
 {
     m_bodyManager.DeferCleanup(false);
@@ -167,6 +318,11 @@ void NcPhysicsImpl::Clear() noexcept
     m_constraintManager.Clear();
     m_bodyManager.Clear();
     m_bodyManager.DeferCleanup(true);
+    m_interpolatedBodies.clear();
+    if (m_accumulator)
+    {
+        m_accumulator->Reset();
+    }
 }
 
 void NcPhysicsImpl::BeginRigidBodyBatch(size_t bodyCountHint)
@@ -11,6 +11,12 @@
 #include "ncengine/physics/NcPhysics.h"
 #include "ncengine/physics/RigidBody.h"
 #include "ncengine/task/TaskGraph.h"
+#include "time/StepTimer.h"
+
+#include "DirectXMath.h"
+
+#include <optional>
+#include <vector>
 
 namespace nc
 {
@@ -24,6 +30,21 @@ struct PhysicsSettings;
 
 namespace physics
 {
+/** Pose of a body before the last fixed step, stamped with the step it precedes. */
+struct PreviousPose
+{
+    DirectX::XMVECTOR position;
+    DirectX::XMVECTOR rotation;
+    uint64_t step = UINT64_MAX;
+};
+
+/**
+ * NcPhysics implementation backed by Jolt.
+ *
+ * With a fixed time step, each frame runs as many whole steps as have accumulated and Transforms of awake bodies
+ * are interpolated between the poses before and after the last step. RigidBody remains the authoritative pose;
+ * Transforms lag the simulation by up to one step.
+ */
 class NcPhysicsImpl final : public NcPhysics
 {
     public:
@@ -34,7 +55,6 @@ class NcPhysicsImpl final : public NcPhysics
                       SystemEvents& events,
                       std::unique_ptr<DeferredPhysicsCreateState> deferredState);
 
-        void Run();
         void OnBuildTaskGraph(task::UpdateTasks& update, task::RenderTasks&) override;
         void OnBeforeSceneLoad() override;
         void OnBeforeSceneFragmentLoad() override;
@@ -54,9 +74,32 @@ class NcPhysicsImpl final : public NcPhysics
         BodyManager m_bodyManager;
         CollisionQueryManager m_queryManager;
         std::unique_ptr<DeferredPhysicsCreateState> m_deferredState;
+        bool m_groupContactEvents;
         bool m_updateEnabled = true;
 
-        void SyncTransforms();
+        // Active bodies from the last step, which stay valid until bodies are next activated
+        const JPH::BodyID* m_activeBodies = nullptr;
+        size_t m_activeBodyCount = 0ull;
+        size_t m_syncChunkCount = 0ull;
+
+        // Transform dense index for each Jolt body index. Validated against the pool before use.
+        std::vector<uint32_t> m_transformSlots;
+
+        // Fixed step state, unused when stepping with the frame delta
+        std::optional<time::FixedStepAccumulator> m_accumulator;
+        std::vector<PreviousPose> m_previousPoses;
+        std::vector<JPH::BodyID> m_interpolatedBodies;
+        uint64_t m_stepCount = 0ull;
+        float m_alpha = 1.0f;
+
+        auto BuildPhysicsGraph(task::ExceptionContext& exceptionContext) -> std::unique_ptr<tf::Taskflow>;
+        void Step();
+        void StepFixed();
+        void CapturePreviousPoses();
+        void SnapDeactivatedBodies();
+        auto GetTransform(JPH::BodyID id, Entity entity) -> Transform&;
+        void SyncTransforms(size_t chunk);
+        void DispatchEvents();
 };
 } // namespace physics
 } // namespace nc
@@ -4,10 +4,37 @@
 #include "Jolt/Physics/PhysicsSystem.h"
 #include "ncutility/NcError.h"
 
+#include <algorithm>
 #include <ranges>
 
 namespace
 {
+// Identifies a step of any listener. Threads cache the buffer they claimed along with the epoch it is valid for.
+auto g_nextEpoch = std::atomic<uint64_t>{1ull};
+
+struct ThreadBufferCache
+{
+    uint64_t epoch = 0ull;
+    nc::physics::ContactBuffer* buffer = nullptr;
+};
+
+thread_local auto t_bufferCache = ThreadBufferCache{};
+
+template<class T>
+void AppendAndClear(std::vector<T>& out, std::vector<T>& in)
+{
+    out.insert(out.end(), in.cbegin(), in.cend());
+    in.clear();
+}
+
+void AppendAndClear(nc::physics::ContactBuffer& out, nc::physics::ContactBuffer& in)
+{
+    AppendAndClear(out.enteredCollisions, in.enteredCollisions);
+    AppendAndClear(out.enteredTriggers, in.enteredTriggers);
+    AppendAndClear(out.exitedCollisions, in.exitedCollisions);
+    AppendAndClear(out.exitedTriggers, in.exitedTriggers);
+}
+
 auto FillPoints(std::array<nc::Vector3, 4>& points, const JPH::ContactPoints& source) -> size_t
 {
     const auto count = source.size();
@@ -23,6 +50,59 @@ auto FillPoints(std::array<nc::Vector3, 4>& points, const JPH::ContactPoints& so
 
 namespace nc::physics
 {
+void ContactBuffer::Clear() noexcept
+{
+    enteredCollisions.clear();
+    enteredTriggers.clear();
+    exitedCollisions.clear();
+    exitedTriggers.clear();
+}
+
+void MergeContactBuffers(std::span<ContactBuffer* const> buffers, ContactBuffer& out)
+{
+    for (auto buffer : buffers)
+    {
+        ::AppendAndClear(out, *buffer);
+    }
+
+    std::ranges::sort(out.enteredCollisions, {}, [](const auto& collision) { return collision.pair.hash; });
+    std::ranges::sort(out.enteredTriggers, {}, &OverlappingPair::hash);
+    std::ranges::sort(out.exitedCollisions, {}, &OverlappingPair::hash);
+    std::ranges::sort(out.exitedTriggers, {}, &OverlappingPair::hash);
+}
+
+ContactListener::ContactListener(JPH::PhysicsSystem& physicsSystem)
+    : m_physicsSystem{&physicsSystem},
+      m_epoch{g_nextEpoch.fetch_add(1ull, std::memory_order_relaxed)}
+{
+}
+
+template<class F>
+void ContactListener::Record(F&& record)
+{
+    if (t_bufferCache.epoch != m_epoch)
+    {
+        const auto index = m_claimedBuffers.fetch_add(1u, std::memory_order_relaxed);
+        if (index >= MaxThreadBuffers)
+        {
+            auto lock = std::lock_guard{m_overflowMutex};
+            record(m_overflowBuffer);
+            return;
+        }
+
+        // Only the claiming thread touches a buffer until GatherContacts()
+        auto& buffer = m_threadBuffers[index];
+        if (!buffer)
+        {
+            buffer = std::make_unique<ContactBuffer>();
+        }
+
+        t_bufferCache = ThreadBufferCache{m_epoch, buffer.get()};
+    }
+
+    record(*t_bufferCache.buffer);
+}
+
 // note: This is called from multiple threads with all bodies locked.
 void ContactListener::OnContactAdded(const JPH::Body& body1,
                                      const JPH::Body& body2,
@@ -61,8 +141,7 @@ void ContactListener::OnContactAdded(const JPH::Body& body1,
 
     if (body1.IsSensor() || body2.IsSensor())
     {
-        auto lock = std::lock_guard{m_addedMutex};
-        m_enteredTriggers.emplace_back(pair);
+        Record([&pair](ContactBuffer& buffer) { buffer.enteredTriggers.push_back(pair); });
         return;
     }
 
@@ -71,19 +150,15 @@ void ContactListener::OnContactAdded(const JPH::Body& body1,
     const auto numPointsOnFirst = FillPoints(pointsOnFirst, manifold.mRelativeContactPointsOn1);
     const auto numPointsOnSecond = FillPoints(pointsOnSecond, manifold.mRelativeContactPointsOn2);
 
-    {
-        auto lock = std::lock_guard{m_addedMutex};
-        m_enteredCollisions.emplace_back(
-            pair,
-            HitInfo{
-                ToVector3(manifold.mBaseOffset),
-                ToVector3(manifold.mWorldSpaceNormal),
-                manifold.mPenetrationDepth,
-                Contacts{pointsOnFirst, numPointsOnFirst},
-                Contacts{pointsOnSecond, numPointsOnSecond}
-            }
-        );
-    }
+    const auto hit = HitInfo{
+        ToVector3(manifold.mBaseOffset),
+        ToVector3(manifold.mWorldSpaceNormal),
+        manifold.mPenetrationDepth,
+        Contacts{pointsOnFirst, numPointsOnFirst},
+        Contacts{pointsOnSecond, numPointsOnSecond}
+    };
+
+    Record([&pair, &hit](ContactBuffer& buffer) { buffer.enteredCollisions.emplace_back(pair, hit); });
 }
 
 // note: This called from multiple threads with all bodies locked.
@@ -111,61 +186,70 @@ void ContactListener::OnContactRemoved(const JPH::SubShapeIDPair& pairID)
         return;
     }
 
-    auto& pair = pos->second.pair;
-    auto& queue = pos->second.isTrigger ? m_exitedTriggers : m_exitedCollisions;
-
+    const auto& [pair, isTrigger] = pos->second;
+    Record([&pair, isTrigger](ContactBuffer& buffer)
     {
-        auto lock = std::lock_guard{m_removedMutex};
+        auto& queue = isTrigger ? buffer.exitedTriggers : buffer.exitedCollisions;
         queue.push_back(pair);
-    }
+    });
 }
 
-void ContactListener::CommitPendingChanges()
+void ContactListener::GatherContacts()
 {
-    for (const auto& overlapping : m_exitedCollisions)
+    const auto claimed = std::min(m_claimedBuffers.load(std::memory_order_relaxed), MaxThreadBuffers);
+    auto buffers = std::array<ContactBuffer*, MaxThreadBuffers + 1>{};
+    std::ranges::transform(std::span{m_threadBuffers}.first(claimed), buffers.begin(), [](auto& buffer)
     {
-        m_pairs.erase(overlapping.hash);
-    }
+        return buffer.get();
+    });
 
-    m_exitedCollisions.clear();
+    buffers[claimed] = &m_overflowBuffer;
+    MergeContactBuffers(std::span{buffers}.first(claimed + 1), m_stepEvents);
 
-    for (const auto& overlapping : m_exitedTriggers)
+    // Track pairs as soon as they're gathered so later steps in the same frame see them
+    for (const auto& overlapping : m_stepEvents.exitedCollisions)
     {
         m_pairs.erase(overlapping.hash);
     }
 
-    m_exitedTriggers.clear();
-
-    for (const auto& collision : m_enteredCollisions)
+    for (const auto& overlapping : m_stepEvents.exitedTriggers)
     {
-        m_pairs.emplace(
-            collision.pair.hash,
-            DetectEvent{collision.pair, false}
-        );
+        m_pairs.erase(overlapping.hash);
     }
 
-    m_enteredCollisions.clear();
+    for (const auto& collision : m_stepEvents.enteredCollisions)
+    {
+        m_pairs.emplace(collision.pair.hash, DetectEvent{collision.pair, false});
+    }
 
-    for (const auto& collisionPair : m_enteredTriggers)
+    for (const auto& overlapping : m_stepEvents.enteredTriggers)
     {
-        m_pairs.emplace(
-            collisionPair.hash,
-            DetectEvent{collisionPair, true}
-        );
+        m_pairs.emplace(overlapping.hash, DetectEvent{overlapping, true});
     }
 
-    m_enteredTriggers.clear();
+    ::AppendAndClear(m_events, m_stepEvents);
+
+    // Invalidate thread caches so the next step claims buffers again
+    m_claimedBuffers.store(0u, std::memory_order_relaxed);
+    m_epoch = g_nextEpoch.fetch_add(1ull, std::memory_order_relaxed);
+}
+
+void ContactListener::CommitPendingChanges()
+{
+    m_events.Clear();
 }
 
 void ContactListener::Clear() noexcept
 {
-    m_enteredCollisions.clear();
-    m_enteredCollisions.shrink_to_fit();
-    m_enteredTriggers.clear();
-    m_enteredTriggers.shrink_to_fit();
-    m_exitedCollisions.clear();
-    m_exitedCollisions.shrink_to_fit();
-    m_exitedTriggers.clear();
-    m_exitedTriggers.shrink_to_fit();
+    m_events = ContactBuffer{};
+    m_stepEvents = ContactBuffer{};
+    m_overflowBuffer.Clear();
+    for (auto& buffer : m_threadBuffers)
+    {
+        buffer.reset();
+    }
+
+    m_claimedBuffers.store(0u, std::memory_order_relaxed);
+    m_epoch = g_nextEpoch.fetch_add(1ull, std::memory_order_relaxed);
 }
 } // namespace nc::physics
@@ -5,6 +5,9 @@
 #include "Jolt/Jolt.h"
 #include "Jolt/Physics/Collision/ContactListener.h"
 
+#include <array>
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <span>
 #include <unordered_map>
@@ -36,13 +39,34 @@ struct DetectEvent
     bool isTrigger;
 };
 
+/** Contact events recorded by one thread during a physics step. */
+struct alignas(64) ContactBuffer
+{
+    std::vector<CollisionPair> enteredCollisions;
+    std::vector<OverlappingPair> enteredTriggers;
+    std::vector<OverlappingPair> exitedCollisions;
+    std::vector<OverlappingPair> exitedTriggers;
+
+    void Clear() noexcept;
+};
+
+/** Move events from each buffer into out, then sort each list in out by pair hash. The result doesn't depend on which
+ *  buffer an event was recorded in, so merging per-thread buffers matches recording everything into one. */
+void MergeContactBuffers(std::span<ContactBuffer* const> buffers, ContactBuffer& out);
+
+/**
+ * Records collision and trigger events reported by Jolt.
+ *
+ * Jolt reports contacts from its job threads. Each thread claims its own ContactBuffer the first time it reports a
+ * contact in a step, so recording never takes a lock. GatherContacts() merges the buffers once after the step, in
+ * pair hash order so event order doesn't depend on thread scheduling. Events from later steps follow earlier ones.
+ */
 class ContactListener final : public JPH::ContactListener
 {
     public:
-        explicit ContactListener(JPH::PhysicsSystem& physicsSystem)
-            : m_physicsSystem{&physicsSystem}
-        {
-        }
+        static constexpr auto MaxThreadBuffers = 64u;
+
+        explicit ContactListener(JPH::PhysicsSystem& physicsSystem);
 
         void OnContactAdded(const JPH::Body& body1,
                             const JPH::Body& body2,
@@ -51,23 +75,35 @@ class ContactListener final : public JPH::ContactListener
 
         void OnContactRemoved(const JPH::SubShapeIDPair& pair) override;
 
-        auto GetNewCollisions() const -> std::span<const CollisionPair> { return m_enteredCollisions; }
-        auto GetNewTriggers() const -> std::span<const OverlappingPair> { return m_enteredTriggers; }
-        auto GetRemovedCollisions() const -> std::span<const OverlappingPair> { return m_exitedCollisions; }
-        auto GetRemovedTriggers() const -> std::span<const OverlappingPair> { return m_exitedTriggers;}
+        auto GetEvents() const -> const ContactBuffer& { return m_events; }
+        auto GetNewCollisions() const -> std::span<const CollisionPair> { return m_events.enteredCollisions; }
+        auto GetNewTriggers() const -> std::span<const OverlappingPair> { return m_events.enteredTriggers; }
+        auto GetRemovedCollisions() const -> std::span<const OverlappingPair> { return m_events.exitedCollisions; }
+        auto GetRemovedTriggers() const -> std::span<const OverlappingPair> { return m_events.exitedTriggers; }
+
+        /** Merge events recorded by all threads during the last step. Call after each physics update. Events from
+         *  multiple steps accumulate until CommitPendingChanges(). */
+        void GatherContacts();
+
+        /** Discard gathered events once they've been dispatched. */
         void CommitPendingChanges();
         void Clear() noexcept;
 
     private:
         JPH::PhysicsSystem* m_physicsSystem;
         std::unordered_map<size_t, DetectEvent> m_pairs;
+        ContactBuffer m_events;
+        ContactBuffer m_stepEvents;
+
+        std::array<std::unique_ptr<ContactBuffer>, MaxThreadBuffers> m_threadBuffers;
+        std::atomic<uint32_t> m_claimedBuffers = 0u;
+        uint64_t m_epoch;
 
-        std::vector<CollisionPair> m_enteredCollisions;
-        std::vector<OverlappingPair> m_enteredTriggers;
-        std::mutex m_addedMutex;
+        // Only used if more threads report contacts than there are thread buffers
+        ContactBuffer m_overflowBuffer;
+        std::mutex m_overflowMutex;
 
-        std::vector<OverlappingPair> m_exitedCollisions;
-        std::vector<OverlappingPair> m_exitedTriggers;
-        std::mutex m_removedMutex;
+        template<class F>
+        void Record(F&& record);
 };
 } // namespace nc::physics
@@ -39,6 +39,8 @@ struct JoltApi : public StableAddress
         {
             ThrowJoltUpdateError(error);
         }
+
+        contactListener.GatherContacts();
     }
 
     TempAllocator tempAllocator;
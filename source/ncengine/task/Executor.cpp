@@ -111,13 +111,29 @@ void Executor::RunUpdateTasks()
 
 void Executor::RunRenderTasks()
 {
-    SCOPE_EXIT(m_runningRender = false);
+    BeginRenderTasks();
+    WaitRenderTasks();
+}
+
+void Executor::BeginRenderTasks()
+{
     if (std::exchange(m_runningRender, true))
     {
         throw NcError{"Executor is already running render tasks"};
     }
 
-    m_executor.run(m_ctx.render->graph).wait();
+    m_renderFuture = m_executor.run(m_ctx.render->graph);
+}
+
+void Executor::WaitRenderTasks()
+{
+    if (!m_runningRender)
+    {
+        return;
+    }
+
+    SCOPE_EXIT(m_runningRender = false);
+    m_renderFuture.wait();
     m_ctx.render->exceptionContext.ThrowIfExceptionStored();
 }
 
@@ -38,6 +38,16 @@ class Executor : public StableAddress
         // Blocking call to run the render graph. Throws any exceptions caught during execution.
         void RunRenderTasks();
 
+        // Start running the render graph without waiting for it to finish.
+        void BeginRenderTasks();
+
+        // Block until render tasks started with BeginRenderTasks() finish. Throws any exceptions caught during
+        // execution. Does nothing if render tasks aren't running.
+        void WaitRenderTasks();
+
+        // Check if render tasks started with BeginRenderTasks() have not yet been waited on.
+        auto IsRunningRenderTasks() const noexcept { return m_runningRender; }
+
         // Get an interface for running async tasks on the executor.
         auto GetAsyncDispatcher() -> AsyncDispatcher
         {
@@ -50,6 +60,7 @@ class Executor : public StableAddress
     private:
         tf::Executor m_executor;
         ExecutorContext m_ctx;
+        tf::Future<void> m_renderFuture;
         bool m_runningUpdate = false;
         bool m_runningRender = false;
 };
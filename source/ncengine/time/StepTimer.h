@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cstdint>
+#include <thread>
 #include <utility>
 
 namespace nc::time
@@ -10,6 +13,10 @@ class StepTimer
     using Clock_t = std::chrono::steady_clock;
     using TimePoint_t = std::chrono::time_point<Clock_t>;
 
+    // Sleeps are issued in short slices so the margin estimate below tracks actual scheduler granularity
+    static constexpr auto SleepSlice = std::chrono::milliseconds{1};
+    static constexpr auto InitialSleepMargin = std::chrono::duration_cast<Clock_t::duration>(std::chrono::milliseconds{2});
+
     public:
         static constexpr auto TicksPerSecond = static_cast<double>(Clock_t::period::den) / static_cast<double>(Clock_t::period::num);
         static constexpr auto SecondsPerTick = static_cast<double>(Clock_t::period::num) / static_cast<double>(Clock_t::period::den);
@@ -25,11 +32,14 @@ class StepTimer
         {
         }
 
-        // Construct a timer using a fixed step
-        explicit StepTimer(double timeStep, double maxTimeStep) noexcept
-            : m_fixedStepTicks{SecondsToTicks(timeStep)},
+        // Construct a timer using a fixed step. Up to maxStepsPerTick steps are run in a single Tick() to catch up
+        // after a slow frame. With pacing enabled, Tick() blocks until the next step is due instead of returning early.
+        explicit StepTimer(double timeStep, double maxTimeStep, uint32_t maxStepsPerTick = 1u, bool pace = false) noexcept
+            : m_fixedStepTicks{std::max(SecondsToTicks(timeStep), uint64_t{1})},
               m_maxDeltaTicks{SecondsToTicks(maxTimeStep)},
-              m_useFixedStep{true}
+              m_maxStepsPerTick{std::max(maxStepsPerTick, 1u)},
+              m_useFixedStep{true},
+              m_pace{pace}
         {
         }
 
@@ -47,6 +57,9 @@ class StepTimer
         template<class UpdateFunc>
         auto Tick(const UpdateFunc& update) -> bool
         {
+            if (m_useFixedStep && m_pace)
+                WaitForNextStep();
+
             auto ticks = UpdateTimePoints();
             if (ticks > m_maxDeltaTicks)
                 ticks = m_maxDeltaTicks;
@@ -58,7 +71,7 @@ class StepTimer
 
                 m_accumulatedTicks += ticks;
                 m_framesThisTick = 0ull;
-                while (m_accumulatedTicks >= m_fixedStepTicks)
+                while (m_accumulatedTicks >= m_fixedStepTicks && m_framesThisTick < m_maxStepsPerTick)
                 {
                     ++m_framesThisTick;
                     m_deltaTicks = m_fixedStepTicks;
@@ -66,8 +79,13 @@ class StepTimer
                     m_accumulatedTicks -= m_fixedStepTicks;
                     ++m_frameCount;
                     update(static_cast<float>(TicksToSeconds(m_deltaTicks)));
-                    return true;
                 }
+
+                // Drop any backlog beyond the step limit so slow frames can't snowball into longer catch-up frames.
+                if (m_framesThisTick == m_maxStepsPerTick)
+                    m_accumulatedTicks %= m_fixedStepTicks;
+
+                return m_framesThisTick != 0ull;
             }
             else
             {
@@ -96,7 +114,10 @@ class StepTimer
 
         uint64_t m_fixedStepTicks;
         uint64_t m_maxDeltaTicks;
+        uint64_t m_maxStepsPerTick = 1ull;
+        Clock_t::duration m_sleepMargin = InitialSleepMargin;
         bool m_useFixedStep;
+        bool m_pace = false;
 
         auto UpdateTimePoints() -> uint64_t
         {
@@ -105,6 +126,27 @@ class StepTimer
             return static_cast<uint64_t>(ticks);
         }
 
+        void WaitForNextStep()
+        {
+            const auto elapsed = static_cast<uint64_t>((Clock_t::now() - m_currentTime).count());
+            if (m_accumulatedTicks + elapsed >= m_fixedStepTicks)
+                return;
+
+            const auto target = m_currentTime + Clock_t::duration{m_fixedStepTicks - m_accumulatedTicks};
+
+            // Coarse sleep while comfortably ahead of the target. The margin follows the longest recent slice, decaying
+            // slowly after a spike, so the final stretch is spun rather than risking an oversleep.
+            for (auto now = Clock_t::now(); target - now > m_sleepMargin; )
+            {
+                std::this_thread::sleep_for(SleepSlice);
+                const auto sliceStart = std::exchange(now, Clock_t::now());
+                m_sleepMargin = std::max(now - sliceStart, m_sleepMargin - m_sleepMargin / 16);
+            }
+
+            while (Clock_t::now() < target)
+                std::this_thread::yield();
+        }
+
         auto WithinFixedStepEpsilon(uint64_t ticks) -> bool
         {
             constexpr auto epsilon = TicksPerSecond / 4000ull;
@@ -112,4 +154,45 @@ class StepTimer
             return delta < epsilon;
         }
 };
+
+// Split variable frame deltas into whole fixed steps, carrying the remainder into later frames
+class FixedStepAccumulator
+{
+    public:
+        explicit FixedStepAccumulator(double timeStep, uint32_t maxSteps) noexcept
+            : m_stepTicks{std::max(StepTimer::SecondsToTicks(timeStep), uint64_t{1})},
+              m_maxSteps{maxSteps}
+        {
+        }
+
+        // Add elapsed time and get the number of steps to run. Time beyond maxSteps is dropped so a slow frame
+        // can't force progressively longer catch-up frames.
+        auto Advance(double deltaSeconds) noexcept -> uint32_t
+        {
+            m_accumulatedTicks += StepTimer::SecondsToTicks(deltaSeconds);
+            const auto steps = m_accumulatedTicks / m_stepTicks;
+            if (steps > m_maxSteps)
+            {
+                m_accumulatedTicks %= m_stepTicks;
+                return m_maxSteps;
+            }
+
+            m_accumulatedTicks -= steps * m_stepTicks;
+            return static_cast<uint32_t>(steps);
+        }
+
+        // Fraction of a step carried over, used to interpolate between the last two steps
+        auto Alpha() const noexcept -> float
+        {
+            return static_cast<float>(static_cast<double>(m_accumulatedTicks) / static_cast<double>(m_stepTicks));
+        }
+
+        auto StepSeconds() const noexcept -> float { return static_cast<float>(StepTimer::TicksToSeconds(m_stepTicks)); }
+        void Reset() noexcept { m_accumulatedTicks = 0ull; }
+
+    private:
+        uint64_t m_stepTicks;
+        uint64_t m_accumulatedTicks = 0ull;
+        uint32_t m_maxSteps;
+};
 } // namespace nc::engine
@@ -505,11 +505,10 @@ void TransformUIWidget(Transform& transform, EditorContext& ctx, const std::any&
 {
     IMGUI_SCOPE(ui::ImGuiId, "Transform");
     const auto self = ctx.selectedEntity;
-    const auto decomposedMatrix = DecomposeMatrix(transform.LocalTransformationMatrix());
-    auto scl = ToVector3(decomposedMatrix.scale);
+    auto scl = transform.LocalScale();
     const auto prevScl = scl;
-    auto pos = ToVector3(decomposedMatrix.position);
-    auto curRot = ToQuaternion(decomposedMatrix.rotation).ToEulerAngles();
+    auto pos = transform.LocalPosition();
+    auto curRot = transform.LocalRotation().ToEulerAngles();
     const auto prevRot = curRot;
     auto wasUpdated = false;
 
@@ -6,6 +6,11 @@ TEST(VersionTests, IsVersionSupported_version4_returnsTrue)
     EXPECT_TRUE(nc::asset::IsVersionSupported(nc::asset::version4));
 }
 
+TEST(VersionTests, IsVersionSupported_version5_returnsTrue)
+{
+    EXPECT_TRUE(nc::asset::IsVersionSupported(nc::asset::version5));
+}
+
 TEST(VersionTests, IsVersionSupported_currentVersion_returnsTrue)
 {
     EXPECT_TRUE(nc::asset::IsVersionSupported(nc::asset::currentVersion));
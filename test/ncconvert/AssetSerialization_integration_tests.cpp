@@ -5,11 +5,24 @@
 #include "ncasset/Assets.h"
 
 #include "ncmath/Math.h"
+#include "ncutility/BinarySerialization.h"
 #include "ncutility/NcError.h"
 
 #include <algorithm>
+#include <cstring>
 #include <sstream>
 
+namespace
+{
+template<class T>
+auto ToBytes(const std::vector<T>& samples) -> std::vector<std::byte>
+{
+    auto out = std::vector<std::byte>(samples.size() * sizeof(T));
+    std::memcpy(out.data(), samples.data(), out.size());
+    return out;
+}
+} // anonymous namespace
+
 namespace nc::asset
 {
 bool operator==(const nc::asset::MeshVertex& lhs, const nc::asset::MeshVertex& rhs)
@@ -317,8 +330,9 @@ TEST(AssetSerializationTest, AudioClip_roundTrip_succeeds)
     constexpr auto version = nc::asset::currentVersion;
     const auto expectedAsset = nc::asset::AudioClip{
         .samplesPerChannel = 4ull,
-        .leftChannel = std::vector<double>{0.0f, 0.5f, 1.0f, 0.5f},
-        .rightChannel = std::vector<double>{0.0f, 0.25f, 0.75f, 1.0f}
+        .format = nc::asset::AudioSampleFormat::Int16,
+        .leftChannel = ToBytes(std::vector<int16_t>{0, 16384, 32767, 16384}),
+        .rightChannel = ToBytes(std::vector<int16_t>{0, 8192, 24576, -32767})
     };
 
     auto stream = std::stringstream{std::ios::in | std::ios::out | std::ios::binary};
@@ -331,6 +345,7 @@ TEST(AssetSerializationTest, AudioClip_roundTrip_succeeds)
     EXPECT_STREQ("NONE", actualHeader.compressionAlgorithm);
 
     EXPECT_EQ(expectedAsset.samplesPerChannel, actualAsset.samplesPerChannel);
+    EXPECT_EQ(expectedAsset.format, actualAsset.format);
     ASSERT_EQ(expectedAsset.leftChannel.size(), actualAsset.leftChannel.size());
     ASSERT_EQ(expectedAsset.rightChannel.size(), actualAsset.rightChannel.size());
     EXPECT_TRUE(std::equal(expectedAsset.leftChannel.cbegin(),
@@ -341,6 +356,72 @@ TEST(AssetSerializationTest, AudioClip_roundTrip_succeeds)
                            actualAsset.rightChannel.cbegin()));
 }
 
+TEST(AssetSerializationTest, DeserializeAudioClip_version4_convertsToFloat32)
+{
+    const auto left = std::vector<double>{0.0, 0.5, 1.0};
+    const auto right = std::vector<double>{-1.0, -0.5, 0.25};
+    auto stream = std::stringstream{std::ios::in | std::ios::out | std::ios::binary};
+    auto header = nc::asset::NcaHeader{"CLIP", "NONE", nc::asset::version4, 0ull};
+    nc::asset::Serialize(stream, header);
+    nc::serialize::Serialize(stream, left.size());
+    nc::serialize::Serialize(stream, left);
+    nc::serialize::Serialize(stream, right);
+
+    const auto [actualHeader, actualAsset] = nc::asset::DeserializeAudioClip(stream);
+
+    EXPECT_EQ(nc::asset::version4, actualHeader.version);
+    EXPECT_EQ(3ull, actualAsset.samplesPerChannel);
+    EXPECT_EQ(nc::asset::AudioSampleFormat::Float32, actualAsset.format);
+    ASSERT_EQ(3ull * sizeof(float), actualAsset.leftChannel.size());
+    ASSERT_EQ(3ull * sizeof(float), actualAsset.rightChannel.size());
+    const auto* actualLeft = reinterpret_cast<const float*>(actualAsset.leftChannel.data());
+    const auto* actualRight = reinterpret_cast<const float*>(actualAsset.rightChannel.data());
+    EXPECT_FLOAT_EQ(0.5f, actualLeft[1]);
+    EXPECT_FLOAT_EQ(1.0f, actualLeft[2]);
+    EXPECT_FLOAT_EQ(-1.0f, actualRight[0]);
+    EXPECT_FLOAT_EQ(0.25f, actualRight[2]);
+}
+
+TEST(AssetSerializationTest, DeserializeAudioClip_channelSizeMismatch_throws)
+{
+    const auto badAsset = nc::asset::AudioClip{
+        .samplesPerChannel = 4ull,
+        .format = nc::asset::AudioSampleFormat::Float32,
+        .leftChannel = ToBytes(std::vector<int16_t>{0, 1, 2, 3}),
+        .rightChannel = ToBytes(std::vector<int16_t>{0, 1, 2, 3})
+    };
+
+    auto stream = std::stringstream{std::ios::in | std::ios::out | std::ios::binary};
+    nc::convert::Serialize(stream, badAsset, nc::asset::currentVersion);
+    EXPECT_THROW(nc::asset::DeserializeAudioClip(stream), nc::NcError);
+}
+
+TEST(AssetSerializationTest, DeserializeAudioClipLayout_locatesChannelData)
+{
+    const auto asset = nc::asset::AudioClip{
+        .samplesPerChannel = 2ull,
+        .format = nc::asset::AudioSampleFormat::Float32,
+        .leftChannel = ToBytes(std::vector<float>{0.25f, 0.5f}),
+        .rightChannel = ToBytes(std::vector<float>{0.75f, 1.0f})
+    };
+
+    auto stream = std::stringstream{std::ios::in | std::ios::out | std::ios::binary};
+    nc::convert::Serialize(stream, asset, nc::asset::currentVersion);
+    const auto bytes = stream.str();
+    const auto [header, layout] = nc::asset::DeserializeAudioClipLayout(stream);
+
+    EXPECT_EQ(2ull, layout.samplesPerChannel);
+    EXPECT_EQ(nc::asset::AudioSampleFormat::Float32, layout.format);
+    EXPECT_EQ(0ull, layout.leftChannelOffset % alignof(float));
+    EXPECT_EQ(0ull, layout.rightChannelOffset % alignof(float));
+    auto left = 0.0f;
+    auto right = 0.0f;
+    std::memcpy(&left, bytes.data() + layout.leftChannelOffset + sizeof(float), sizeof(float));
+    std::memcpy(&right, bytes.data() + layout.rightChannelOffset, sizeof(float));
+    EXPECT_FLOAT_EQ(0.5f, left);
+    EXPECT_FLOAT_EQ(0.75f, right);
+}
+
 TEST(AssetSerializationTest, CubeMap_roundTrip_succeeds)
 {
     constexpr auto version = nc::asset::currentVersion;
@@ -4,20 +4,51 @@
 #include "ncasset/Assets.h"
 
 #include <algorithm>
+#include <cstring>
 
-TEST(AudioConverterTest, ImportAudioClip_convertsToNca)
+namespace
+{
+template<class T>
+auto Decode(const std::vector<std::byte>& channel) -> std::vector<T>
+{
+    auto out = std::vector<T>(channel.size() / sizeof(T));
+    std::memcpy(out.data(), channel.data(), channel.size());
+    return out;
+}
+} // anonymous namespace
+
+TEST(AudioConverterTest, ImportAudioClip_float32_convertsToNca)
+{
+    namespace test_data = collateral::sine;
+    auto uut = nc::convert::AudioConverter{};
+    const auto actual = uut.ImportAudioClip(test_data::filePath, nc::asset::AudioSampleFormat::Float32);
+
+    EXPECT_EQ(actual.samplesPerChannel, test_data::samplesPerChannel);
+    EXPECT_EQ(actual.format, nc::asset::AudioSampleFormat::Float32);
+    const auto left = ::Decode<float>(actual.leftChannel);
+    const auto right = ::Decode<float>(actual.rightChannel);
+    ASSERT_EQ(left.size(), test_data::leftChannel.size());
+    ASSERT_EQ(right.size(), test_data::rightChannel.size());
+    EXPECT_TRUE(std::ranges::equal(left, test_data::leftChannel, {}, {}, [](auto s) { return static_cast<float>(s); }));
+    EXPECT_TRUE(std::ranges::equal(right, test_data::rightChannel, {}, {}, [](auto s) { return static_cast<float>(s); }));
+}
+
+TEST(AudioConverterTest, ImportAudioClip_int16_quantizesSamples)
 {
     namespace test_data = collateral::sine;
+    constexpr auto tolerance = 1.0 / 32767.0;
     auto uut = nc::convert::AudioConverter{};
-    const auto actual = uut.ImportAudioClip(test_data::filePath);
+    const auto actual = uut.ImportAudioClip(test_data::filePath, nc::asset::AudioSampleFormat::Int16);
 
     EXPECT_EQ(actual.samplesPerChannel, test_data::samplesPerChannel);
-    ASSERT_EQ(actual.leftChannel.size(), test_data::leftChannel.size());
-    ASSERT_EQ(actual.rightChannel.size(), test_data::rightChannel.size());
-    EXPECT_TRUE(std::equal(actual.leftChannel.cbegin(),
-                           actual.leftChannel.cend(),
-                           test_data::leftChannel.cbegin()));
-    EXPECT_TRUE(std::equal(actual.rightChannel.cbegin(),
-                           actual.rightChannel.cend(),
-                           test_data::rightChannel.cbegin()));
+    EXPECT_EQ(actual.format, nc::asset::AudioSampleFormat::Int16);
+    ASSERT_EQ(actual.leftChannel.size(), test_data::samplesPerChannel * sizeof(int16_t));
+    ASSERT_EQ(actual.rightChannel.size(), test_data::samplesPerChannel * sizeof(int16_t));
+    const auto left = ::Decode<int16_t>(actual.leftChannel);
+    const auto right = ::Decode<int16_t>(actual.rightChannel);
+    for (auto i = 0ull; i < test_data::samplesPerChannel; ++i)
+    {
+        ASSERT_NEAR(left[i] / 32767.0, test_data::leftChannel[i], tolerance);
+        ASSERT_NEAR(right[i] / 32767.0, test_data::rightChannel[i], tolerance);
+    }
 }
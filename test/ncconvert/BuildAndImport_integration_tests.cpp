@@ -183,14 +183,41 @@ TEST_F(BuildAndImportTest, AudioClip_from_wav)
     const auto asset = nc::asset::ImportAudioClip(outFile);
 
     EXPECT_EQ(asset.samplesPerChannel, test_data::samplesPerChannel);
-    ASSERT_EQ(asset.leftChannel.size(), test_data::leftChannel.size());
-    ASSERT_EQ(asset.rightChannel.size(), test_data::rightChannel.size());
-    EXPECT_TRUE(std::equal(asset.leftChannel.cbegin(),
-                           asset.leftChannel.cend(),
-                           test_data::leftChannel.cbegin()));
-    EXPECT_TRUE(std::equal(asset.rightChannel.cbegin(),
-                           asset.rightChannel.cend(),
-                           test_data::rightChannel.cbegin()));
+    EXPECT_EQ(asset.format, nc::asset::AudioSampleFormat::Int16);
+    ASSERT_EQ(asset.leftChannel.size(), test_data::samplesPerChannel * sizeof(int16_t));
+    ASSERT_EQ(asset.rightChannel.size(), test_data::samplesPerChannel * sizeof(int16_t));
+    const auto* left = reinterpret_cast<const int16_t*>(asset.leftChannel.data());
+    const auto* right = reinterpret_cast<const int16_t*>(asset.rightChannel.data());
+    for (auto i = 0ull; i < test_data::samplesPerChannel; ++i)
+    {
+        ASSERT_NEAR(left[i] / 32767.0, test_data::leftChannel[i], 1.0 / 32767.0);
+        ASSERT_NEAR(right[i] / 32767.0, test_data::rightChannel[i], 1.0 / 32767.0);
+    }
+
+    const auto layout = nc::asset::ImportAudioClipLayout(outFile);
+    EXPECT_EQ(layout.samplesPerChannel, test_data::samplesPerChannel);
+    EXPECT_EQ(layout.format, nc::asset::AudioSampleFormat::Int16);
+    EXPECT_EQ(layout.leftChannelOffset, 44ull);
+    EXPECT_EQ(layout.rightChannelOffset, layout.leftChannelOffset + asset.leftChannel.size() + sizeof(size_t));
+}
+
+TEST_F(BuildAndImportTest, AudioClip_float32Option_storesFloatSamples)
+{
+    namespace test_data = collateral::sine;
+    const auto inFile = test_data::filePath;
+    const auto outFile = ncaTestOutDirectory / "sine_float.nca";
+    auto options = nc::convert::TargetOptions{};
+    options.audioFormat = nc::asset::AudioSampleFormat::Float32;
+    const auto target = nc::convert::Target{inFile, outFile, std::nullopt, options};
+    auto builder = nc::convert::Builder{};
+    ASSERT_TRUE(builder.Build(nc::asset::AssetType::AudioClip, target));
+
+    const auto asset = nc::asset::ImportAudioClip(outFile);
+
+    EXPECT_EQ(asset.format, nc::asset::AudioSampleFormat::Float32);
+    ASSERT_EQ(asset.leftChannel.size(), test_data::samplesPerChannel * sizeof(float));
+    const auto* left = reinterpret_cast<const float*>(asset.leftChannel.data());
+    EXPECT_FLOAT_EQ(left[test_data::samplesPerChannel / 2], static_cast<float>(test_data::leftChannel[test_data::samplesPerChannel / 2]));
 }
 
 TEST_F(BuildAndImportTest, CubeMap_from_png)
@@ -2,8 +2,13 @@
 #include "asset/manager/AudioClipAssetManager.h"
 
 #include "ncasset/Assets.h"
+#include "ncasset/NcaHeader.h"
+#include "ncutility/BinarySerialization.h"
 
 #include <array>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
 #include <string>
 
 using namespace nc::asset;
@@ -11,6 +16,36 @@ using namespace nc::asset;
 const auto SoundPath1 = "sound1.nca";
 const auto SoundPath2 = "sound2.nca";
 
+namespace
+{
+constexpr auto g_streamLeft = std::array<int16_t, 4>{0, 100, -100, 32767};
+constexpr auto g_streamRight = std::array<int16_t, 4>{1, 2, 3, 4};
+
+// Collateral files predate version5, so write one alongside the test binary
+auto WriteVersion5Clip() -> std::filesystem::path
+{
+    const auto path = std::filesystem::temp_directory_path() / "nc_stream_clip.nca";
+    auto file = std::ofstream{path, std::ios::binary | std::ios::trunc};
+    const auto channelSize = g_streamLeft.size() * sizeof(int16_t);
+    auto header = NcaHeader{"CLIP", "NONE", version5, sizeof(size_t) * 3 + sizeof(AudioSampleFormat) + channelSize * 2};
+    nc::asset::Serialize(file, header);
+    nc::serialize::Serialize(file, g_streamLeft.size());
+    nc::serialize::Serialize(file, AudioSampleFormat::Int16);
+    nc::serialize::Serialize(file, channelSize);
+    file.write(reinterpret_cast<const char*>(g_streamLeft.data()), channelSize);
+    nc::serialize::Serialize(file, channelSize);
+    file.write(reinterpret_cast<const char*>(g_streamRight.data()), channelSize);
+    return path;
+}
+
+auto SampleAt(std::span<const std::byte> channel, size_t index) -> int16_t
+{
+    auto out = int16_t{};
+    std::memcpy(&out, channel.data() + index * sizeof(int16_t), sizeof(int16_t));
+    return out;
+}
+} // anonymous namespace
+
 class AudioClipAssetManager_tests : public ::testing::Test
 {
     public:
@@ -126,3 +161,31 @@ TEST_F(AudioClipAssetManager_tests, GetPath_NotLoaded_Throws)
     assetManager->UnloadAll();
     EXPECT_THROW(assetManager->GetPath(view.id), nc::NcError);
 }
+
+TEST_F(AudioClipAssetManager_tests, Load_Stream_ViewsMappedSamples)
+{
+    const auto path = ::WriteVersion5Clip().string();
+    ASSERT_TRUE(assetManager->Load(path, true, AssetFlags::AudioClipStream));
+    const auto view = assetManager->Acquire(path);
+
+    EXPECT_EQ(g_streamLeft.size(), view.samplesPerChannel);
+    EXPECT_EQ(AudioSampleFormat::Int16, view.format);
+    ASSERT_EQ(g_streamLeft.size() * sizeof(int16_t), view.leftChannel.size());
+    ASSERT_EQ(g_streamRight.size() * sizeof(int16_t), view.rightChannel.size());
+    for (auto i = 0u; i < g_streamLeft.size(); ++i)
+    {
+        EXPECT_EQ(g_streamLeft[i], ::SampleAt(view.leftChannel, i));
+        EXPECT_EQ(g_streamRight[i], ::SampleAt(view.rightChannel, i));
+    }
+
+    EXPECT_TRUE(assetManager->Unload(path));
+    std::filesystem::remove(path);
+}
+
+TEST_F(AudioClipAssetManager_tests, Load_StreamLegacyVersion_LoadsResident)
+{
+    ASSERT_TRUE(assetManager->Load(SoundPath1, false, AssetFlags::AudioClipStream));
+    const auto view = assetManager->Acquire(SoundPath1);
+    EXPECT_EQ(AudioSampleFormat::Float32, view.format);
+    EXPECT_EQ(view.samplesPerChannel * sizeof(float), view.leftChannel.size());
+}
@@ -1,10 +1,13 @@
 #include "gtest/gtest.h"
 #include "asset/manager/MeshAssetManager.h"
+#include "asset/AssetData.h"
 
 #include "ncasset/Assets.h"
 
 #include <array>
 #include <string>
+#include <utility>
+#include <vector>
 
 using namespace nc::asset;
 
@@ -112,43 +115,107 @@ TEST_F(MeshAssetManager_tests, UnloadAll_Empty_Completes)
     assetManager->UnloadAll(AssetFlags::None);
 }
 
-TEST_F(MeshAssetManager_tests, Unload_FromBeginning_UpdatesAccesors)
+TEST_F(MeshAssetManager_tests, Unload_FromBeginning_AccessorsUnchanged)
 {
     const auto paths = std::array<std::string, 3u>{meshPath1, meshPath2, meshPath3};
     assetManager->Load(paths, false);
+    const auto expected2 = assetManager->Acquire(meshPath2);
+    const auto expected3 = assetManager->Acquire(meshPath3);
     assetManager->Unload(meshPath1);
     const auto view2 = assetManager->Acquire(meshPath2);
     const auto view3 = assetManager->Acquire(meshPath3);
-    EXPECT_EQ(view2.firstIndex, 0u);
-    EXPECT_EQ(view2.firstVertex, 0u);
-    EXPECT_EQ(view3.firstIndex, view2.indexCount);
-    EXPECT_EQ(view3.firstVertex, view2.vertexCount);
+    EXPECT_EQ(view2.firstVertex, expected2.firstVertex);
+    EXPECT_EQ(view2.firstIndex, expected2.firstIndex);
+    EXPECT_EQ(view3.firstVertex, expected3.firstVertex);
+    EXPECT_EQ(view3.firstIndex, expected3.firstIndex);
 }
 
-TEST_F(MeshAssetManager_tests, Unload_FromMiddle_UpdatesAccesors)
+TEST_F(MeshAssetManager_tests, Unload_ThenLoad_ReusesFreedRange)
 {
     const auto paths = std::array<std::string, 3u>{meshPath1, meshPath2, meshPath3};
     assetManager->Load(paths, false);
+    const auto expected = assetManager->Acquire(meshPath2);
     assetManager->Unload(meshPath2);
+    assetManager->Load(meshPath2, false);
+    const auto actual = assetManager->Acquire(meshPath2);
+    EXPECT_EQ(actual.firstVertex, expected.firstVertex);
+    EXPECT_EQ(actual.firstIndex, expected.firstIndex);
+}
+
+TEST_F(MeshAssetManager_tests, Unload_Defragment_CompactsAccessors)
+{
+    const auto paths = std::array<std::string, 3u>{meshPath1, meshPath2, meshPath3};
+    assetManager->Load(paths, false);
+    assetManager->Unload(meshPath2, AssetFlags::MeshDefragment);
     const auto view1 = assetManager->Acquire(meshPath1);
     const auto view3 = assetManager->Acquire(meshPath3);
-    EXPECT_EQ(view1.firstVertex, 0u);
-    EXPECT_EQ(view1.firstIndex, 0u);
-    EXPECT_EQ(view3.firstVertex, view1.vertexCount);
-    EXPECT_EQ(view3.firstIndex, view1.indexCount);
+    const auto [firstView, secondView] = view1.firstVertex == 0u ? std::pair{view1, view3} : std::pair{view3, view1};
+    EXPECT_EQ(firstView.firstVertex, 0u);
+    EXPECT_EQ(firstView.firstIndex, 0u);
+    EXPECT_EQ(secondView.firstVertex, firstView.vertexCount);
+    EXPECT_EQ(secondView.firstIndex, firstView.indexCount);
 }
 
-TEST_F(MeshAssetManager_tests, Unload_FromEnd_UpdatesAccesors)
+TEST_F(MeshAssetManager_tests, Unload_Defragment_EmitsReallocation)
 {
     const auto paths = std::array<std::string, 3u>{meshPath1, meshPath2, meshPath3};
     assetManager->Load(paths, false);
-    assetManager->Unload(meshPath3);
     const auto view1 = assetManager->Acquire(meshPath1);
-    const auto view2 = assetManager->Acquire(meshPath2);
-    EXPECT_EQ(view1.firstIndex, 0u);
-    EXPECT_EQ(view1.firstVertex, 0u);
-    EXPECT_EQ(view2.firstIndex, view1.indexCount);
-    EXPECT_EQ(view2.firstVertex, view1.vertexCount);
+    const auto view3 = assetManager->Acquire(meshPath3);
+    auto reallocated = false;
+    auto vertexCount = size_t{};
+    auto connection = assetManager->OnMeshUpdate().Connect([&](const MeshUpdateEventData& data)
+    {
+        reallocated = data.reallocate;
+        vertexCount = data.vertices.size();
+    });
+
+    assetManager->Unload(meshPath2, AssetFlags::MeshDefragment);
+    EXPECT_TRUE(reallocated);
+    EXPECT_EQ(vertexCount, view1.vertexCount + view3.vertexCount);
+}
+
+TEST_F(MeshAssetManager_tests, Load_FitsInArena_EmitsOnlyChangedRanges)
+{
+    const auto paths = std::array<std::string, 3u>{meshPath1, meshPath2, meshPath3};
+    assetManager->Load(paths, false);
+    const auto expected = assetManager->Acquire(meshPath2);
+    assetManager->Unload(meshPath2);
+
+    auto emitted = false;
+    auto reallocated = true;
+    auto changedVertices = std::vector<MeshArenaRange>{};
+    auto changedIndices = std::vector<MeshArenaRange>{};
+    auto connection = assetManager->OnMeshUpdate().Connect([&](const MeshUpdateEventData& data)
+    {
+        emitted = true;
+        reallocated = data.reallocate;
+        changedVertices.assign(data.changedVertices.begin(), data.changedVertices.end());
+        changedIndices.assign(data.changedIndices.begin(), data.changedIndices.end());
+    });
+
+    assetManager->Load(meshPath2, false);
+    ASSERT_TRUE(emitted);
+    EXPECT_FALSE(reallocated);
+    ASSERT_EQ(changedVertices.size(), 1u);
+    ASSERT_EQ(changedIndices.size(), 1u);
+    EXPECT_EQ(changedVertices.at(0).offset, expected.firstVertex);
+    EXPECT_EQ(changedVertices.at(0).count, expected.vertexCount);
+    EXPECT_EQ(changedIndices.at(0).offset, expected.firstIndex);
+    EXPECT_EQ(changedIndices.at(0).count, expected.indexCount);
+}
+
+TEST_F(MeshAssetManager_tests, Unload_NoDefragment_DoesNotEmit)
+{
+    assetManager->Load(meshPath1, false);
+    auto emitted = false;
+    auto connection = assetManager->OnMeshUpdate().Connect([&](const MeshUpdateEventData&)
+    {
+        emitted = true;
+    });
+
+    assetManager->Unload(meshPath1);
+    EXPECT_FALSE(emitted);
 }
 
 TEST_F(MeshAssetManager_tests, GetPath_Loaded_ReturnsPath)
@@ -1,8 +1,10 @@
 #include "ncengine/asset/NcAsset.h"
 #include "ncengine/config/Config.h"
+#include "ncengine/task/AsyncDispatcher.h"
 #include "gtest/gtest.h"
 #include "ncmath/Vector.h"
 
+#include <chrono>
 #include <ranges>
 
 namespace nc::window
@@ -27,6 +29,9 @@ const auto g_assetSettings = nc::config::AssetSettings
 
 const auto g_memorySettings = nc::config::MemorySettings{};
 
+auto g_executor = tf::Executor{2};
+const auto g_dispatcher = nc::task::AsyncDispatcher{&g_executor};
+
 const auto g_defaultAssets = nc::asset::AssetMap
 {
     {nc::asset::AssetType::AudioClip,         {"sound1.nca"}},
@@ -40,7 +45,7 @@ const auto g_defaultAssets = nc::asset::AssetMap
 
 TEST(NcAssetTests, GetLoadedAssets_returnsCompleteCollection)
 {
-    auto uut = nc::asset::BuildAssetModule(g_assetSettings, g_memorySettings, g_defaultAssets);
+    auto uut = nc::asset::BuildAssetModule(g_assetSettings, g_memorySettings, g_dispatcher, g_defaultAssets);
     uut->OnBeforeSceneLoad();
     const auto actualAssets = uut->GetLoadedAssets();
     EXPECT_EQ(g_defaultAssets.size(), actualAssets.size());
@@ -49,3 +54,43 @@ TEST(NcAssetTests, GetLoadedAssets_returnsCompleteCollection)
         EXPECT_TRUE(std::ranges::equal(g_defaultAssets.at(type), assets));
     }
 }
+
+TEST(NcAssetTests, LoadAssetsAsync_beforeCommit_doesNotLoad)
+{
+    auto uut = nc::asset::BuildAssetModule(g_assetSettings, g_memorySettings, g_dispatcher, {});
+    auto future = uut->LoadAssetsAsync(g_defaultAssets);
+    for (const auto& [type, assets] : uut->GetLoadedAssets())
+    {
+        EXPECT_TRUE(assets.empty());
+    }
+
+    EXPECT_NE(std::future_status::ready, future.wait_for(std::chrono::seconds{0}));
+}
+
+TEST(NcAssetTests, LoadAssetsAsync_afterCommit_loadsCompleteCollection)
+{
+    auto uut = nc::asset::BuildAssetModule(g_assetSettings, g_memorySettings, g_dispatcher, {});
+    auto future = uut->LoadAssetsAsync(g_defaultAssets);
+    while (future.wait_for(std::chrono::milliseconds{1}) != std::future_status::ready)
+    {
+        uut->CommitPendingLoads();
+    }
+
+    EXPECT_NO_THROW(future.get());
+    for (const auto& [type, assets] : uut->GetLoadedAssets())
+    {
+        EXPECT_TRUE(std::ranges::equal(g_defaultAssets.at(type), assets));
+    }
+}
+
+TEST(NcAssetTests, LoadAssetsAsync_badPath_futureRethrows)
+{
+    auto uut = nc::asset::BuildAssetModule(g_assetSettings, g_memorySettings, g_dispatcher, {});
+    auto future = uut->LoadAssetsAsync(nc::asset::AssetMap{{nc::asset::AssetType::Mesh, {"bad/path.nca"}}});
+    while (future.wait_for(std::chrono::milliseconds{1}) != std::future_status::ready)
+    {
+        uut->CommitPendingLoads();
+    }
+
+    EXPECT_ANY_THROW(future.get());
+}
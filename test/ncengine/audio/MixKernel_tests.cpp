@@ -0,0 +1,111 @@
+#include "gtest/gtest.h"
+#include "audio/MixKernel.h"
+
+#include <array>
+
+using namespace nc::audio;
+
+constexpr auto g_left = std::array{1.0, 2.0, 3.0, 4.0};
+constexpr auto g_right = std::array{0.5, 0.5, 0.5, 0.5};
+
+TEST(MixKernelTests, GainRampBetween_interpolatesAcrossFrames)
+{
+    const auto ramp = GainRamp::Between(StereoGain{0.0, 1.0}, StereoGain{1.0, 0.0}, 4);
+    EXPECT_DOUBLE_EQ(0.0, ramp.start.left);
+    EXPECT_DOUBLE_EQ(1.0, ramp.start.right);
+    EXPECT_DOUBLE_EQ(0.25, ramp.step.left);
+    EXPECT_DOUBLE_EQ(-0.25, ramp.step.right);
+
+    const auto offset = ramp.Offset(2);
+    EXPECT_DOUBLE_EQ(0.5, offset.start.left);
+    EXPECT_DOUBLE_EQ(0.5, offset.start.right);
+}
+
+TEST(MixKernelTests, GainRampBetween_zeroFrames_hasNoStep)
+{
+    const auto ramp = GainRamp::Between(StereoGain{0.0, 0.0}, StereoGain{1.0, 1.0}, 0);
+    EXPECT_DOUBLE_EQ(0.0, ramp.step.left);
+    EXPECT_DOUBLE_EQ(0.0, ramp.step.right);
+}
+
+TEST(MixKernelTests, MixRun_constantGain_accumulatesChannels)
+{
+    auto out = std::array<double, 8>{};
+    out.fill(1.0);
+    const auto ramp = GainRamp{StereoGain{2.0, 4.0}, StereoGain{}};
+    MixRun(out.data(), g_left.data(), g_right.data(), 4, ramp, false);
+
+    for (auto i = 0u; i < 4u; ++i)
+    {
+        EXPECT_DOUBLE_EQ(1.0 + 2.0 * g_left[i], out[2 * i]);
+        EXPECT_DOUBLE_EQ(1.0 + 4.0 * g_right[i], out[2 * i + 1]);
+    }
+}
+
+TEST(MixKernelTests, MixRun_downmix_sumsChannelsBeforeGain)
+{
+    auto out = std::array<float, 8>{};
+    const auto ramp = GainRamp{StereoGain{1.0, 0.5}, StereoGain{}};
+    MixRun(out.data(), g_left.data(), g_right.data(), 4, ramp, true);
+
+    for (auto i = 0u; i < 4u; ++i)
+    {
+        const auto mono = g_left[i] + g_right[i];
+        EXPECT_FLOAT_EQ(static_cast<float>(mono), out[2 * i]);
+        EXPECT_FLOAT_EQ(static_cast<float>(mono * 0.5), out[2 * i + 1]);
+    }
+}
+
+TEST(MixKernelTests, MixRun_ramp_appliesPerFrameGain)
+{
+    auto out = std::array<double, 8>{};
+    const auto ramp = GainRamp::Between(StereoGain{0.0, 0.0}, StereoGain{1.0, 1.0}, 4);
+    MixRun(out.data(), g_left.data(), g_right.data(), 4, ramp, false);
+
+    for (auto i = 0u; i < 4u; ++i)
+    {
+        EXPECT_DOUBLE_EQ(g_left[i] * 0.25 * i, out[2 * i]);
+        EXPECT_DOUBLE_EQ(g_right[i] * 0.25 * i, out[2 * i + 1]);
+    }
+}
+
+TEST(MixKernelTests, MixRun_int16Input_normalizesSamples)
+{
+    constexpr auto left = std::array<int16_t, 4>{-32768, -16384, 16384, 32767};
+    constexpr auto right = std::array<int16_t, 4>{0, 8192, -8192, 0};
+    auto out = std::array<float, 8>{};
+    const auto ramp = GainRamp{StereoGain{1.0, 2.0}, StereoGain{}};
+    MixRun(out.data(), left.data(), right.data(), 4, ramp, false);
+
+    for (auto i = 0u; i < 4u; ++i)
+    {
+        EXPECT_FLOAT_EQ(static_cast<float>(left[i] / 32768.0), out[2 * i]);
+        EXPECT_FLOAT_EQ(static_cast<float>(2.0 * right[i] / 32768.0), out[2 * i + 1]);
+    }
+}
+
+TEST(MixKernelTests, MixRun_floatInput_matchesDoubleInput)
+{
+    constexpr auto left = std::array{1.0f, 2.0f, 3.0f, 4.0f};
+    constexpr auto right = std::array{0.5f, 0.5f, 0.5f, 0.5f};
+    auto fromFloat = std::array<double, 8>{};
+    auto fromDouble = std::array<double, 8>{};
+    const auto ramp = GainRamp::Between(StereoGain{0.0, 1.0}, StereoGain{1.0, 0.0}, 4);
+    MixRun(fromFloat.data(), left.data(), right.data(), 4, ramp, true);
+    MixRun(fromDouble.data(), g_left.data(), g_right.data(), 4, ramp, true);
+
+    for (auto i = 0u; i < 8u; ++i)
+    {
+        EXPECT_DOUBLE_EQ(fromDouble[i], fromFloat[i]);
+    }
+}
+
+TEST(MixKernelTests, Accumulate_sumsIntoDestination)
+{
+    auto dst = std::array{1.0, 2.0, 3.0};
+    const auto src = std::array{0.5, 0.5, 0.5};
+    Accumulate(dst.data(), src.data(), dst.size());
+    EXPECT_DOUBLE_EQ(1.5, dst[0]);
+    EXPECT_DOUBLE_EQ(2.5, dst[1]);
+    EXPECT_DOUBLE_EQ(3.5, dst[2]);
+}
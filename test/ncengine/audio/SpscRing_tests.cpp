@@ -0,0 +1,77 @@
+#include "gtest/gtest.h"
+#include "audio/SpscRing.h"
+
+#include <thread>
+
+using Ring = nc::audio::SpscRing<uint32_t, 4>;
+
+TEST(SpscRingTests, TryPop_empty_returnsFalse)
+{
+    auto uut = Ring{};
+    auto out = 0u;
+    EXPECT_TRUE(uut.Empty());
+    EXPECT_FALSE(uut.TryPop(out));
+}
+
+TEST(SpscRingTests, TryPush_full_returnsFalse)
+{
+    auto uut = Ring{};
+    for (auto i = 0u; i < 4u; ++i)
+    {
+        EXPECT_TRUE(uut.TryPush(i));
+    }
+
+    EXPECT_EQ(4ull, uut.Size());
+    EXPECT_FALSE(uut.TryPush(4u));
+}
+
+TEST(SpscRingTests, TryPop_preservesFifoOrderAcrossWrap)
+{
+    auto uut = Ring{};
+    auto out = 0u;
+    for (auto i = 0u; i < 10u; ++i)
+    {
+        ASSERT_TRUE(uut.TryPush(i));
+        ASSERT_TRUE(uut.TryPush(i + 100u));
+        ASSERT_TRUE(uut.TryPop(out));
+        EXPECT_EQ(i, out);
+        ASSERT_TRUE(uut.TryPop(out));
+        EXPECT_EQ(i + 100u, out);
+    }
+
+    EXPECT_TRUE(uut.Empty());
+}
+
+TEST(SpscRingTests, ConcurrentPushPop_deliversAllValuesInOrder)
+{
+    constexpr auto count = 100000u;
+    auto uut = Ring{};
+    auto producer = std::thread{[&uut]()
+    {
+        for (auto i = 0u; i < count; ++i)
+        {
+            while (!uut.TryPush(i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    }};
+
+    auto expected = 0u;
+    auto out = 0u;
+    while (expected < count)
+    {
+        if (uut.TryPop(out))
+        {
+            ASSERT_EQ(expected, out);
+            ++expected;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+    EXPECT_TRUE(uut.Empty());
+}
@@ -24,6 +24,12 @@ TEST(ConfigTests, Validate_badValues_returnsFalse)
         EXPECT_FALSE(nc::config::Validate(actual));
     }
 
+    {
+        auto actual = nc::config::Config{};
+        actual.engineSettings.maxStepsPerTick = 0u;
+        EXPECT_FALSE(nc::config::Validate(actual));
+    }
+
     {
         auto actual = nc::config::Config{};
         actual.graphicsSettings.screenWidth = 0;
@@ -35,11 +41,26 @@ TEST(ConfigTests, Validate_badValues_returnsFalse)
         actual.physicsSettings.velocitySteps = 1u;
         EXPECT_FALSE(nc::config::Validate(actual));
     }
+
+    {
+        auto actual = nc::config::Config{};
+        actual.physicsSettings.maxSubsteps = 0u;
+        EXPECT_FALSE(nc::config::Validate(actual));
+    }
+
+    {
+        auto actual = nc::config::Config{};
+        actual.audioSettings.maxVoices = 0u;
+        EXPECT_FALSE(nc::config::Validate(actual));
+    }
 }
 
 TEST(ConfigTests, Load_allValues_succeeds)
 {
-    nc::config::Load(g_collateralDir + "/config.ini");
+    const auto actual = nc::config::Load(g_collateralDir + "/config.ini");
+    EXPECT_EQ(6u, actual.engineSettings.maxStepsPerTick);
+    EXPECT_TRUE(actual.engineSettings.framePacing);
+    EXPECT_TRUE(actual.engineSettings.pipelineRender);
 }
 
 TEST(ConfigTests, Load_badPath_throws)
@@ -105,8 +126,11 @@ TEST(ConfigTests, SaveLoad_roundTrip_preservesData)
 
     EXPECT_FLOAT_EQ(expected.engineSettings.timeStep, actual.engineSettings.timeStep);
     EXPECT_FLOAT_EQ(expected.engineSettings.maxTimeStep, actual.engineSettings.maxTimeStep);
+    EXPECT_EQ(expected.engineSettings.maxStepsPerTick, actual.engineSettings.maxStepsPerTick);
+    EXPECT_EQ(expected.engineSettings.framePacing, actual.engineSettings.framePacing);
     EXPECT_EQ(expected.engineSettings.threadCount, actual.engineSettings.threadCount);
     EXPECT_EQ(expected.engineSettings.buildTasksOnInit, actual.engineSettings.buildTasksOnInit);
+    EXPECT_EQ(expected.engineSettings.pipelineRender, actual.engineSettings.pipelineRender);
 
     EXPECT_EQ(expected.assetSettings.audioClipsPath, actual.assetSettings.audioClipsPath);
     EXPECT_EQ(expected.assetSettings.concaveCollidersPath, actual.assetSettings.concaveCollidersPath);
@@ -154,7 +178,12 @@ TEST(ConfigTests, SaveLoad_roundTrip_preservesData)
     EXPECT_FLOAT_EQ(expected.physicsSettings.penetrationSlop, actual.physicsSettings.penetrationSlop);
     EXPECT_FLOAT_EQ(expected.physicsSettings.timeBeforeSleep, actual.physicsSettings.timeBeforeSleep);
     EXPECT_FLOAT_EQ(expected.physicsSettings.sleepThreshold, actual.physicsSettings.sleepThreshold);
+    EXPECT_EQ(expected.physicsSettings.groupContactEvents, actual.physicsSettings.groupContactEvents);
+    EXPECT_FLOAT_EQ(expected.physicsSettings.fixedTimeStep, actual.physicsSettings.fixedTimeStep);
+    EXPECT_EQ(expected.physicsSettings.maxSubsteps, actual.physicsSettings.maxSubsteps);
 
     EXPECT_EQ(expected.audioSettings.enabled, actual.audioSettings.enabled);
     EXPECT_EQ(expected.audioSettings.bufferFrames, actual.audioSettings.bufferFrames);
+    EXPECT_EQ(expected.audioSettings.floatSamples, actual.audioSettings.floatSamples);
+    EXPECT_EQ(expected.audioSettings.maxVoices, actual.audioSettings.maxVoices);
 }
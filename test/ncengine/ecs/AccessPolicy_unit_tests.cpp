@@ -52,6 +52,17 @@ TEST(AccessPolicyTests, HasAccess_anyNotAllowed_isFalse)
     static_assert(!basicPolicy::HasAccess<int>);
 }
 
+TEST(AccessPolicyTests, HasAccess_constTypes_onlyGrantRead)
+{
+    using readOnlyPolicy = nc::ecs::AccessPolicy<nc::ecs::FilterBase::None, const S1, S2>;
+    static_assert(readOnlyPolicy::HasAccess<const S1, S2, const S2>);
+    static_assert(!readOnlyPolicy::HasAccess<S1>);
+    static_assert(explicitPolicy::HasAccess<const S1, const S2>);
+    static_assert(allPolicy::HasAccess<const S1, S1>);
+    static_assert(explicitPolicy::ConvertibleTo<nc::ecs::FilterBase::None, const S1, S2>);
+    static_assert(!readOnlyPolicy::ConvertibleTo<nc::ecs::FilterBase::None, S1, S2>);
+}
+
 TEST(AccessPolicyTests, BaseContains_sameBase_isTrue)
 {
     static_assert(explicitPolicy::BaseContains<nc::ecs::FilterBase::None>);
@@ -82,6 +93,12 @@ TEST(AccessPolicyTests, GetPool_returnsReference_preservesValueCategory)
     );
 
     static_assert(std::is_lvalue_reference_v<returned>);
+
+    using returnedConst = decltype(
+        std::declval<basicPolicy&>().GetPool<const nc::Transform>()
+    );
+
+    static_assert(std::same_as<const nc::ecs::ComponentPool<nc::Transform>&, returnedConst>);
 }
 
 template<class T>
@@ -0,0 +1,103 @@
+#include "gtest/gtest.h"
+#include "ncengine/ecs/CommandBuffer.h"
+
+#include <memory>
+#include <vector>
+
+struct S1 { int value = 0; };
+struct MoveOnly { std::unique_ptr<int> value; };
+
+class CommandBufferTests : public ::testing::Test
+{
+    public:
+        static constexpr size_t registryCapacity = 10ull;
+        nc::ecs::ComponentRegistry registry;
+
+        CommandBufferTests()
+            : registry{registryCapacity}
+        {
+            registry.RegisterType<nc::Tag>(registryCapacity);
+            registry.RegisterType<nc::Transform>(registryCapacity);
+            registry.RegisterType<nc::ecs::detail::FreeComponentGroup>(registryCapacity);
+            registry.RegisterType<nc::Hierarchy>(registryCapacity);
+            registry.RegisterType<S1>(registryCapacity);
+            registry.RegisterType<MoveOnly>(registryCapacity);
+        }
+
+        auto World() -> nc::ecs::Ecs
+        {
+            return nc::ecs::Ecs{registry};
+        }
+};
+
+TEST_F(CommandBufferTests, Record_doesNotModifyRegistry)
+{
+    auto world = World();
+    const auto entity = world.Emplace<nc::Entity>({});
+    auto uut = nc::ecs::CommandBuffer{};
+    uut.Emplace<S1>(entity, 1);
+    uut.Emplace<nc::Entity>({.tag = "deferred"});
+    EXPECT_EQ(2ull, uut.size());
+    EXPECT_FALSE(world.Contains<S1>(entity));
+    EXPECT_EQ(1ull, registry.GetPool<nc::Entity>().Size());
+}
+
+TEST_F(CommandBufferTests, Playback_appliesCommandsInOrder)
+{
+    auto world = World();
+    const auto entity = world.Emplace<nc::Entity>({});
+    auto uut = nc::ecs::CommandBuffer{};
+    uut.Emplace<S1>(entity, 1);
+    uut.Push([entity](nc::ecs::Ecs w) { w.Get<S1>(entity).value += 10; });
+    uut.Remove<S1>(entity);
+    uut.Emplace<S1>(entity, 5);
+    uut.Playback(world);
+
+    EXPECT_TRUE(uut.empty());
+    ASSERT_TRUE(world.Contains<S1>(entity));
+    EXPECT_EQ(5, world.Get<S1>(entity).value);
+}
+
+TEST_F(CommandBufferTests, Playback_emplaceEntity_createsEntity)
+{
+    auto world = World();
+    auto uut = nc::ecs::CommandBuffer{};
+    uut.Emplace<nc::Entity>({.tag = "deferred"});
+    uut.Playback(world);
+    registry.CommitPendingChanges();
+    EXPECT_TRUE(world.GetEntityByTag("deferred").Valid());
+}
+
+TEST_F(CommandBufferTests, Playback_removeEntity_removesEntity)
+{
+    auto world = World();
+    const auto entity = world.Emplace<nc::Entity>({});
+    registry.CommitPendingChanges();
+    auto uut = nc::ecs::CommandBuffer{};
+    uut.Remove<nc::Entity>(entity);
+    EXPECT_TRUE(world.Contains<nc::Entity>(entity));
+    uut.Playback(world);
+    EXPECT_FALSE(world.Contains<nc::Entity>(entity));
+}
+
+TEST_F(CommandBufferTests, Emplace_moveOnlyArgs_forwardedOnPlayback)
+{
+    auto world = World();
+    const auto entity = world.Emplace<nc::Entity>({});
+    auto uut = nc::ecs::CommandBuffer{};
+    uut.Emplace<MoveOnly>(entity, std::make_unique<int>(42));
+    uut.Playback(world);
+    ASSERT_TRUE(world.Get<MoveOnly>(entity).value);
+    EXPECT_EQ(42, *world.Get<MoveOnly>(entity).value);
+}
+
+TEST_F(CommandBufferTests, Clear_discardsCommands)
+{
+    auto world = World();
+    const auto entity = world.Emplace<nc::Entity>({});
+    auto uut = nc::ecs::CommandBuffer{};
+    uut.Emplace<S1>(entity);
+    uut.Clear();
+    uut.Playback(world);
+    EXPECT_FALSE(world.Contains<S1>(entity));
+}
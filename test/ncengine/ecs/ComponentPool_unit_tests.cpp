@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <ranges>
+#include <utility>
 
 struct S1
 {
@@ -66,6 +67,28 @@ TEST(ComponentPoolTests, Remove_stagedComponent_returnsTrue)
     EXPECT_FALSE(uut.Contains(entity));
 }
 
+TEST(ComponentPoolTests, Remove_stagedComponent_preservesOtherStagedLookups)
+{
+    auto uut = nc::ecs::ComponentPool<S1>{10u, nc::ComponentHandler<S1>{}};
+    const auto e1 = nc::Entity{1, 0, 0};
+    const auto e2 = nc::Entity{2, 0, 0};
+    const auto e3 = nc::Entity{3, 0, 0};
+    uut.Emplace(e1, 1);
+    uut.Emplace(e2, 2);
+    uut.Emplace(e3, 3);
+    EXPECT_TRUE(uut.Remove(e1));
+    EXPECT_FALSE(uut.Contains(e1));
+    EXPECT_EQ(2, uut.Get(e2).value);
+    EXPECT_EQ(3, uut.Get(e3).value);
+    EXPECT_EQ(e3, uut.GetParent(&uut.Get(e3)));
+    EXPECT_EQ(2u, uut.StagedSize());
+
+    uut.CommitStagedComponents({});
+    EXPECT_EQ(2, uut.Get(e2).value);
+    EXPECT_EQ(3, uut.Get(e3).value);
+    EXPECT_EQ(0u, uut.StagedSize());
+}
+
 TEST(ComponentPoolTests, Remove_committedComponent_returnsTrue)
 {
     auto uut = nc::ecs::ComponentPool<S1>{10u, nc::ComponentHandler<S1>{}};
@@ -76,6 +99,29 @@ TEST(ComponentPoolTests, Remove_committedComponent_returnsTrue)
     EXPECT_FALSE(uut.Contains(entity));
 }
 
+TEST(ComponentPoolTests, CommitStagedComponents_deletedEntities_removesCommittedAndStaged)
+{
+    auto uut = nc::ecs::ComponentPool<S1>{10u, nc::ComponentHandler<S1>{}};
+    for (auto i = 0u; i < 6u; ++i)
+        uut.Emplace(nc::Entity{i, 0, 0}, static_cast<int>(i));
+
+    uut.CommitStagedComponents({});
+    const auto staged = nc::Entity{7, 0, 0};
+    uut.Emplace(staged, 7);
+
+    // Includes an entity the pool doesn't hold, which must be ignored
+    const auto deleted = std::vector<nc::Entity>{nc::Entity{1, 0, 0}, nc::Entity{4, 0, 0}, staged, nc::Entity{9, 0, 0}};
+    uut.CommitStagedComponents(deleted);
+
+    EXPECT_EQ(4, uut.size());
+    EXPECT_EQ(0, uut.StagedSize());
+    for (auto entity : deleted)
+        EXPECT_FALSE(uut.Contains(entity));
+
+    for (auto i : {0u, 2u, 3u, 5u})
+        EXPECT_EQ(static_cast<int>(i), uut.Get(nc::Entity{i, 0, 0}).value);
+}
+
 TEST(ComponentPoolTests, Remove_entityDoesNotExist_returnsFalse)
 {
     auto uut = nc::ecs::ComponentPool<S1>{10u, nc::ComponentHandler<S1>{}};
@@ -265,6 +311,34 @@ TEST(ComponentPoolTests, Reserve_subsequentAdds_preserveReferenceValidity)
     EXPECT_EQ(&expectedE, &actualE);
 }
 
+TEST(ComponentPoolTests, Version_changesOnlyWhenCommittedComponentsMove)
+{
+    auto uut = nc::ecs::ComponentPool<S1>{10u, nc::ComponentHandler<S1>{}};
+    auto version = uut.Version();
+    auto changed = [&]()
+    {
+        return std::exchange(version, uut.Version()) != uut.Version();
+    };
+
+    uut.Emplace(nc::Entity{1, 0, 0});
+    uut.Emplace(nc::Entity{2, 0, 0});
+    EXPECT_FALSE(changed()); // staging doesn't touch committed components
+    uut.CommitStagedComponents({});
+    EXPECT_TRUE(changed());
+    uut.CommitStagedComponents({});
+    EXPECT_FALSE(changed());
+    uut.Get(nc::Entity{1, 0, 0}).value = 5;
+    EXPECT_FALSE(changed());
+    uut.MarkModified();
+    EXPECT_TRUE(changed());
+    uut.Remove(nc::Entity{1, 0, 0});
+    EXPECT_TRUE(changed());
+    uut.Sort([](const auto& l, const auto& r) { return l.value < r.value; });
+    EXPECT_TRUE(changed());
+    uut.Clear();
+    EXPECT_TRUE(changed());
+}
+
 TEST(ComponentPoolTests, StlViewInterface_hasExpectedFunctions)
 {
     auto uut = nc::ecs::ComponentPool<S1>{10u, nc::ComponentHandler<S1>{}};
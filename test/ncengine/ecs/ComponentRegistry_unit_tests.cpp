@@ -1,8 +1,24 @@
 #include "gtest/gtest.h"
 #include "ncengine/ecs/ComponentRegistry.h"
 
+#include <thread>
+#include <utility>
+#include <vector>
+
 struct S1 {};
 
+template<size_t I>
+struct Numbered
+{
+    int value = 0;
+};
+
+template<size_t... I>
+void RegisterNumbered(nc::ecs::ComponentRegistry& registry, std::index_sequence<I...>, size_t capacity = 10)
+{
+    (registry.RegisterType<Numbered<I>>(capacity), ...);
+}
+
 struct S2 : public nc::ComponentBase
 {
     S2(nc::Entity e) : nc::ComponentBase{e} {}
@@ -127,6 +143,108 @@ TEST(ComponentRegistryTests, CommitPendingChanges_updatesState)
     EXPECT_EQ(next, b);
 }
 
+TEST(ComponentRegistryTests, CommitPendingChanges_manyPools_removesOnlyDeletedEntityData)
+{
+    auto uut = nc::ecs::ComponentRegistry{10};
+    ::RegisterNumbered(uut, std::make_index_sequence<70>{}); // signatures span two words
+    auto& entities = uut.GetPool<nc::Entity>();
+    const auto kept = entities.Add(0, 0);
+    const auto removed = entities.Add(0, 0);
+    uut.GetPool<Numbered<3>>().Emplace(kept);
+    uut.GetPool<Numbered<3>>().Emplace(removed);
+    uut.GetPool<Numbered<66>>().Emplace(kept);
+    uut.GetPool<Numbered<66>>().Emplace(removed);
+    uut.GetPool<Numbered<69>>().Emplace(removed);
+    uut.CommitPendingChanges();
+
+    entities.Remove(removed);
+    uut.CommitPendingChanges();
+    EXPECT_TRUE(uut.GetPool<Numbered<3>>().Contains(kept));
+    EXPECT_TRUE(uut.GetPool<Numbered<66>>().Contains(kept));
+    EXPECT_FALSE(uut.GetPool<Numbered<3>>().Contains(removed));
+    EXPECT_FALSE(uut.GetPool<Numbered<66>>().Contains(removed));
+    EXPECT_FALSE(uut.GetPool<Numbered<69>>().Contains(removed));
+    EXPECT_EQ(0, uut.GetPool<Numbered<69>>().size());
+}
+
+TEST(ComponentRegistryTests, Emplace_poolsSharingSignatureWordOnSeparateThreads_recordsEveryPool)
+{
+    constexpr auto poolCount = 8ull;
+    constexpr auto entityCount = 1000u;
+    auto uut = nc::ecs::ComponentRegistry{entityCount};
+    ::RegisterNumbered(uut, std::make_index_sequence<poolCount>{}, entityCount);
+    auto& entities = uut.GetPool<nc::Entity>();
+    auto added = std::vector<nc::Entity>{};
+    for (auto i = 0u; i < entityCount; ++i)
+        added.push_back(entities.Add(0, 0));
+
+    uut.CommitPendingChanges();
+
+    // Each thread owns one pool, but all of them set bits in the same signature word for every entity
+    [&]<size_t... I>(std::index_sequence<I...>)
+    {
+        auto threads = std::vector<std::jthread>{};
+        (threads.emplace_back([&]
+        {
+            auto& pool = uut.GetPool<Numbered<I>>();
+            for (auto entity : added)
+                pool.Emplace(entity);
+        }), ...);
+    }(std::make_index_sequence<poolCount>{});
+
+    uut.CommitPendingChanges();
+    for (auto entity : added)
+        entities.Remove(entity);
+
+    // Removal only visits pools flagged in the signature, so a lost bit would leave data behind
+    uut.CommitPendingChanges();
+    const auto sizes = [&]<size_t... I>(std::index_sequence<I...>)
+    {
+        return std::vector<size_t>{uut.GetPool<Numbered<I>>().size()...};
+    }(std::make_index_sequence<poolCount>{});
+
+    EXPECT_EQ(std::vector<size_t>(poolCount, 0ull), sizes);
+}
+
+TEST(ComponentRegistryTests, CommitPendingChanges_componentRemovedThenEntityRecycled_doesNotRemoveNewData)
+{
+    auto uut = nc::ecs::ComponentRegistry{10};
+    uut.RegisterType<S1>(10);
+    uut.RegisterType<S2>(10);
+    auto& entities = uut.GetPool<nc::Entity>();
+    const auto first = entities.Add(0, 0);
+    uut.GetPool<S1>().Emplace(first);
+    uut.GetPool<S2>().Emplace(first);
+    uut.CommitPendingChanges();
+    uut.GetPool<S2>().Remove(first);
+    entities.Remove(first);
+    uut.CommitPendingChanges();
+
+    const auto second = entities.Add(0, 0);
+    ASSERT_EQ(first.Index(), second.Index());
+    uut.GetPool<S2>().Emplace(second);
+    uut.CommitPendingChanges();
+    EXPECT_FALSE(uut.GetPool<S1>().Contains(second));
+    EXPECT_TRUE(uut.GetPool<S2>().Contains(second));
+}
+
+TEST(ComponentRegistryTests, ClearSceneData_thenRemovePersistent_removesComponents)
+{
+    auto uut = nc::ecs::ComponentRegistry{10};
+    uut.RegisterType<S1>(10);
+    auto& entities = uut.GetPool<nc::Entity>();
+    auto& components = uut.GetPool<S1>();
+    const auto persistent = entities.Add(0, nc::Entity::Flags::Persistent);
+    components.Emplace(persistent);
+    uut.CommitPendingChanges();
+    uut.ClearSceneData();
+
+    entities.Remove(persistent);
+    uut.CommitPendingChanges();
+    EXPECT_FALSE(components.Contains(persistent));
+    EXPECT_EQ(0, components.Size());
+}
+
 TEST(ComponentRegistryTests, ClearSceneData)
 {
     auto uut = nc::ecs::ComponentRegistry{10};
@@ -174,3 +292,109 @@ TEST(ComponentRegistryTests, Clear)
     EXPECT_FALSE(entities.Contains(c));
     EXPECT_FALSE(components.Contains(c));
 }
+
+void ExpectGroupConsistent(nc::ecs::ComponentRegistry& registry, size_t expectedSize)
+{
+    auto& first = registry.GetPool<Numbered<0>>();
+    auto& second = registry.GetPool<Numbered<1>>();
+    const auto* group = first.GetOwningGroup();
+    ASSERT_NE(nullptr, group);
+    ASSERT_EQ(group, second.GetOwningGroup());
+    ASSERT_EQ(expectedSize, group->size);
+    for (auto i = 0ull; i < group->size; ++i)
+    {
+        const auto entity = first.GetEntityPool()[i];
+        EXPECT_EQ(entity, second.GetEntityPool()[i]);
+        EXPECT_EQ(static_cast<int>(entity.Index()), first[i].value);
+        EXPECT_EQ(static_cast<int>(entity.Index()), second[i].value);
+    }
+
+    // Nothing outside the prefix may belong in the group
+    for (auto i = group->size; i < first.size(); ++i)
+        EXPECT_FALSE(second.Contains(first.GetEntityPool()[i]));
+}
+
+TEST(ComponentRegistryTests, RegisterGroup_existingData_groupsMatchingEntities)
+{
+    auto uut = nc::ecs::ComponentRegistry{10};
+    ::RegisterNumbered(uut, std::make_index_sequence<2>{});
+    auto& entities = uut.GetPool<nc::Entity>();
+    for (auto i = 0; i < 7; ++i)
+    {
+        const auto entity = entities.Add(0, 0);
+        if (i % 2 == 0)
+            uut.GetPool<Numbered<0>>().Emplace(entity, static_cast<int>(entity.Index()));
+        if (i % 3 == 0)
+            uut.GetPool<Numbered<1>>().Emplace(entity, static_cast<int>(entity.Index()));
+    }
+
+    uut.CommitPendingChanges();
+    uut.RegisterGroup<Numbered<0>, Numbered<1>>();
+    ExpectGroupConsistent(uut, 2); // entities 0 and 6
+}
+
+TEST(ComponentRegistryTests, RegisterGroup_typeAlreadyGrouped_throws)
+{
+    auto uut = nc::ecs::ComponentRegistry{10};
+    ::RegisterNumbered(uut, std::make_index_sequence<3>{});
+    uut.RegisterGroup<Numbered<0>, Numbered<1>>();
+    EXPECT_THROW((uut.RegisterGroup<Numbered<1>, Numbered<2>>()), nc::NcError);
+    EXPECT_THROW(uut.GetPool<Numbered<0>>().Sort([](auto&&, auto&&) { return false; }), nc::NcError);
+}
+
+TEST(ComponentRegistryTests, CommitPendingChanges_grouped_maintainsSharedPrefix)
+{
+    auto uut = nc::ecs::ComponentRegistry{10};
+    ::RegisterNumbered(uut, std::make_index_sequence<2>{});
+    uut.RegisterGroup<Numbered<0>, Numbered<1>>();
+    auto& entities = uut.GetPool<nc::Entity>();
+    auto& first = uut.GetPool<Numbered<0>>();
+    auto& second = uut.GetPool<Numbered<1>>();
+    auto added = std::vector<nc::Entity>{};
+    for (auto i = 0; i < 8; ++i)
+    {
+        const auto entity = added.emplace_back(entities.Add(0, 0));
+        first.Emplace(entity, static_cast<int>(entity.Index()));
+        if (i != 2)
+            second.Emplace(entity, static_cast<int>(entity.Index()));
+    }
+
+    uut.CommitPendingChanges();
+    ExpectGroupConsistent(uut, 7);
+
+    second.Emplace(added[2], static_cast<int>(added[2].Index()));
+    first.Remove(added[0]);
+    second.Remove(added[5]);
+    uut.CommitPendingChanges();
+    ExpectGroupConsistent(uut, 6);
+
+    entities.Remove(added[1]);
+    entities.Remove(added[7]);
+    entities.Remove(added[5]);
+    uut.CommitPendingChanges();
+    ExpectGroupConsistent(uut, 4);
+
+    first.Emplace(added[0], static_cast<int>(added[0].Index()));
+    uut.CommitPendingChanges();
+    ExpectGroupConsistent(uut, 5);
+}
+
+TEST(ComponentRegistryTests, ClearSceneData_grouped_rebuildsGroup)
+{
+    auto uut = nc::ecs::ComponentRegistry{10};
+    ::RegisterNumbered(uut, std::make_index_sequence<2>{});
+    uut.RegisterGroup<Numbered<0>, Numbered<1>>();
+    auto& entities = uut.GetPool<nc::Entity>();
+    for (auto i = 0; i < 6; ++i)
+    {
+        const auto entity = entities.Add(0, i % 2 == 0 ? nc::Entity::Flags::Persistent : nc::Entity::Flags::None);
+        uut.GetPool<Numbered<0>>().Emplace(entity, static_cast<int>(entity.Index()));
+        uut.GetPool<Numbered<1>>().Emplace(entity, static_cast<int>(entity.Index()));
+    }
+
+    uut.CommitPendingChanges();
+    uut.ClearSceneData();
+    ExpectGroupConsistent(uut, 3);
+    uut.Clear();
+    ExpectGroupConsistent(uut, 0);
+}
@@ -1,9 +1,14 @@
 #include "gtest/gtest.h"
 #include "ncengine/ecs/Ecs.h"
 
+#include <utility>
+
 struct S1 {};
 struct S2 {};
 
+struct G1 { int value = 0; };
+struct G2 { int value = 0; };
+
 struct TestFreeComponent : public nc::FreeComponent
 {
     TestFreeComponent(nc::Entity e) : nc::FreeComponent{e} {}
@@ -24,6 +29,9 @@ class EcsInterfaceTests : public ::testing::Test
             registry.RegisterType<nc::Hierarchy>(10);
             registry.RegisterType<S1>(10);
             registry.RegisterType<S2>(10);
+            registry.RegisterType<G1>(10);
+            registry.RegisterType<G2>(10);
+            registry.RegisterGroup<G1, G2>();
         }
 
         // Mock of EcsModule for committing registry changes
@@ -41,6 +49,23 @@ concept CanAccess = requires (FilteredEcs ecs, nc::Entity entity)
     { ecs.template Contains<T>(entity) } -> std::same_as<bool>;
 };
 
+template<class FilteredEcs, class T>
+concept CanWrite = requires (FilteredEcs ecs, nc::Entity entity)
+{
+    { ecs.template Get<T>(entity) } -> std::same_as<T&>;
+    { ecs.template GetPool<T>() } -> std::same_as<nc::ecs::ComponentPool<T>&>;
+    ecs.template Emplace<T>(entity);
+    ecs.template Remove<T>(entity);
+};
+
+template<class FilteredEcs, class T>
+concept CanRead = requires (FilteredEcs ecs, nc::Entity entity)
+{
+    { ecs.template Get<T>(entity) } -> std::same_as<const T&>;
+    { ecs.template GetAll<T>() } -> std::same_as<std::span<const T>>;
+    { ecs.template GetPool<const T>() } -> std::same_as<const nc::ecs::ComponentPool<T>&>;
+};
+
 TEST_F(EcsInterfaceTests, Aliases_includesExpectedTypes)
 {
     using all = nc::ecs::Ecs; // no type restrictions
@@ -221,6 +246,84 @@ TEST_F(EcsInterfaceTests, Get_freeComponent_errorPath_throws)
     EXPECT_THROW(uut.Get<TestFreeComponent>(badEntity), nc::NcError);
 }
 
+TEST_F(EcsInterfaceTests, ConstIncludes_grantReadOnlyAccess)
+{
+    using readOnly = nc::ecs::ExplicitEcs<const S1, S2>;
+    static_assert(CanRead<readOnly, S1>);
+    static_assert(!CanWrite<readOnly, S1>);
+    static_assert(CanWrite<readOnly, S2>);
+    static_assert(!CanRead<nc::ecs::ExplicitEcs<const S1>, S2>);
+    static_assert(std::constructible_from<readOnly, nc::ecs::ExplicitEcs<S1, S2>>);
+    static_assert(!std::constructible_from<nc::ecs::ExplicitEcs<S1, S2>, readOnly>);
+    static_assert(std::same_as<nc::ecs::Group<const G1, G2>, decltype(std::declval<nc::ecs::ExplicitEcs<const G1, G2>&>().GetGroup<const G1, G2>())>);
+
+    auto world = nc::ecs::Ecs{registry};
+    const auto entity = world.Emplace<nc::Entity>();
+    const auto& expected = world.Emplace<S1>(entity);
+    auto uut = readOnly{world};
+    EXPECT_EQ(&expected, &uut.Get<S1>(entity));
+}
+
+TEST_F(EcsInterfaceTests, WithWriteOwner_writableTypeOnOtherEntity_throws)
+{
+    auto world = nc::ecs::Ecs{registry};
+    const auto owner = world.Emplace<nc::Entity>();
+    const auto other = world.Emplace<nc::Entity>();
+    world.Emplace<S1>(owner);
+    world.Emplace<S1>(other);
+    world.Emplace<S2>(owner);
+    world.Emplace<S2>(other);
+
+    auto uut = nc::ecs::ExplicitEcs<S1, const S2>{world}.WithWriteOwner(owner);
+    EXPECT_NO_THROW(uut.Get<S1>(owner));
+    EXPECT_NO_THROW(uut.Get<S2>(other));
+    EXPECT_THROW(uut.Get<S1>(other), nc::NcError);
+    EXPECT_THROW(std::as_const(uut).Get<S1>(other), nc::NcError);
+
+    // The restriction carries over to converted interfaces and can't be lifted
+    auto converted = nc::ecs::ExplicitEcs<S1>{uut};
+    EXPECT_THROW(converted.Get<S1>(other), nc::NcError);
+    EXPECT_THROW(converted.WithWriteOwner(nc::Entity::Null()), nc::NcError);
+    EXPECT_THROW(converted.WithWriteOwner(other), nc::NcError);
+
+    // Types declared both writable and const may still be read on any entity
+    const auto readWrite = nc::ecs::ExplicitEcs<S1, const S1>{world}.WithWriteOwner(owner);
+    EXPECT_NO_THROW(readWrite.Get<S1>(other));
+}
+
+TEST_F(EcsInterfaceTests, WithWriteOwner_mutableAccessToOtherEntities_throws)
+{
+    auto world = nc::ecs::Ecs{registry};
+    const auto owner = world.Emplace<nc::Entity>();
+    const auto other = world.Emplace<nc::Entity>();
+    world.Emplace<S1>(owner);
+    world.Emplace<G1>(owner);
+    world.Emplace<G2>(owner);
+    registry.CommitPendingChanges();
+
+    auto uut = nc::ecs::ExplicitEcs<nc::Entity, nc::Transform, nc::Tag, nc::Hierarchy, S1, S2, G1, G2>{world}.WithWriteOwner(owner);
+    EXPECT_THROW(uut.GetAll<S1>(), nc::NcError);
+    EXPECT_THROW(uut.GetPool<S1>(), nc::NcError);
+    EXPECT_THROW((uut.GetGroup<G1, G2>()), nc::NcError);
+    EXPECT_THROW(uut.Emplace<nc::Entity>(), nc::NcError);
+    EXPECT_THROW(uut.Emplace<S2>(owner), nc::NcError);
+    EXPECT_THROW(uut.Remove<S1>(owner), nc::NcError);
+    EXPECT_THROW(uut.Remove<nc::Entity>(other), nc::NcError);
+    EXPECT_THROW(uut.SetParent(owner, other), nc::NcError);
+
+    // Read-only access to other entities is still available
+    EXPECT_EQ(1ull, std::as_const(uut).GetAll<S1>().size());
+    EXPECT_NO_THROW(uut.GetPool<const S1>());
+    EXPECT_NO_THROW((uut.GetGroup<const G1, const G2>()));
+    EXPECT_TRUE(uut.Contains<nc::Entity>(other));
+    EXPECT_FALSE(uut.Contains<S1>(other));
+
+    // Nothing was changed by the rejected calls
+    EXPECT_FALSE(world.Contains<S2>(owner));
+    EXPECT_TRUE(world.Contains<S1>(owner));
+    EXPECT_FALSE(world.Get<nc::Hierarchy>(owner).parent.Valid());
+}
+
 TEST_F(EcsInterfaceTests, GetEntityByTag_tagExists_returnsEntity)
 {
     constexpr auto tag = "FindMe";
@@ -296,6 +399,46 @@ TEST_F(EcsInterfaceTests, GetAll_component_returnsAllTs)
     ASSERT_EQ(2, actualConst.size());
 }
 
+TEST_F(EcsInterfaceTests, GetGroup_returnsParallelRanges)
+{
+    auto uut = nc::ecs::Ecs{registry};
+    const auto both1 = uut.Emplace<nc::Entity>();
+    const auto onlyFirst = uut.Emplace<nc::Entity>();
+    const auto both2 = uut.Emplace<nc::Entity>();
+    uut.Emplace<G1>(both1, 1);
+    uut.Emplace<G1>(onlyFirst, 2);
+    uut.Emplace<G1>(both2, 3);
+    uut.Emplace<G2>(both2, 30);
+    uut.Emplace<G2>(both1, 10);
+    TestFixture_SyncRegistry();
+
+    auto group = uut.GetGroup<G1, const G2>();
+    ASSERT_EQ(2, group.size());
+    ASSERT_EQ(2, group.Get<G1>().size());
+    ASSERT_EQ(2, group.Get<const G2>().size());
+    for (auto [i, entity] : std::views::enumerate(group.Entities()))
+    {
+        EXPECT_EQ(&uut.Get<G1>(entity), &group.Get<G1>()[i]);
+        EXPECT_EQ(&uut.Get<G2>(entity), &group.Get<const G2>()[i]);
+    }
+
+    for (auto [g1, g2] : group)
+        g1.value = g2.value;
+
+    EXPECT_EQ(10, uut.Get<G1>(both1).value);
+    EXPECT_EQ(2, uut.Get<G1>(onlyFirst).value);
+    EXPECT_EQ(30, uut.Get<G1>(both2).value);
+
+    uut.Remove<G1>(both1);
+    EXPECT_EQ(1, (uut.GetGroup<G1, G2>().size()));
+}
+
+TEST_F(EcsInterfaceTests, GetGroup_notExactGroup_throws)
+{
+    auto uut = nc::ecs::Ecs{registry};
+    EXPECT_THROW((uut.GetGroup<G1, S1>()), nc::NcError);
+}
+
 TEST_F(EcsInterfaceTests, SetParent_makeChild_updatesHierarchies)
 {
     auto uut = nc::ecs::Ecs{registry};
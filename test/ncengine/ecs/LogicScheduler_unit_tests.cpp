@@ -0,0 +1,246 @@
+#include "gtest/gtest.h"
+#include "ecs/LogicScheduler.h"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+struct Health { int value = 0; };
+struct Speed { int value = 0; };
+struct Spawned {};
+
+class LogicSchedulerTests : public ::testing::Test
+{
+    public:
+        static constexpr size_t registryCapacity = 1000ull;
+        nc::ecs::ComponentRegistry registry;
+        tf::Executor executor{4};
+        nc::task::AsyncDispatcher dispatcher{&executor};
+        nc::ecs::LogicScheduler uut{dispatcher, 8};
+
+        LogicSchedulerTests()
+            : registry{registryCapacity}
+        {
+            registry.RegisterType<nc::Tag>(registryCapacity);
+            registry.RegisterType<nc::Transform>(registryCapacity);
+            registry.RegisterType<nc::ecs::detail::FreeComponentGroup>(registryCapacity);
+            registry.RegisterType<nc::Hierarchy>(registryCapacity);
+            registry.RegisterType<nc::FrameLogic>(registryCapacity);
+            registry.RegisterType<Health>(registryCapacity);
+            registry.RegisterType<Speed>(registryCapacity);
+            registry.RegisterType<Spawned>(registryCapacity);
+        }
+
+        auto World() -> nc::ecs::Ecs
+        {
+            return nc::ecs::Ecs{registry};
+        }
+
+        template<class... Args>
+        auto AddLogic(Args&&... args) -> nc::Entity
+        {
+            auto world = World();
+            const auto entity = world.Emplace<nc::Entity>({});
+            world.Emplace<Health>(entity);
+            world.Emplace<Speed>(entity);
+            world.Emplace<nc::FrameLogic>(entity, std::forward<Args>(args)...);
+            return entity;
+        }
+};
+
+TEST_F(LogicSchedulerTests, Run_serialLogic_runsOnCallingThread)
+{
+    const auto caller = std::this_thread::get_id();
+    auto calls = 0;
+    for (auto i = 0; i < 20; ++i)
+    {
+        AddLogic([&](nc::Entity, nc::ecs::Ecs, float)
+        {
+            EXPECT_EQ(caller, std::this_thread::get_id());
+            ++calls;
+        });
+    }
+
+    registry.CommitPendingChanges();
+    uut.Run(World(), 1.0f);
+    EXPECT_EQ(20, calls);
+    EXPECT_EQ(0ull, uut.BatchCount());
+}
+
+TEST_F(LogicSchedulerTests, Run_parallelLogic_runsEachOnceWithDeclaredAccess)
+{
+    auto entities = std::vector<nc::Entity>{};
+    for (auto i = 0; i < 200; ++i)
+    {
+        entities.push_back(AddLogic(nc::LogicAccess<Health>{}, [](nc::Entity self, nc::ecs::ExplicitEcs<Health> world, nc::ecs::CommandBuffer&, float dt)
+        {
+            world.Get<Health>(self).value += static_cast<int>(dt);
+        }));
+    }
+
+    registry.CommitPendingChanges();
+    uut.Run(World(), 2.0f);
+    EXPECT_EQ(1ull, uut.BatchCount());
+    for (auto entity : entities)
+    {
+        EXPECT_EQ(2, World().Get<Health>(entity).value);
+    }
+}
+
+TEST_F(LogicSchedulerTests, Run_nonConflictingDeclarations_shareBatch)
+{
+    AddLogic(nc::LogicAccess<Health>{}, [](nc::Entity, nc::ecs::ExplicitEcs<Health>, nc::ecs::CommandBuffer&, float) {});
+    AddLogic(nc::LogicAccess<Speed, const nc::Transform>{}, [](nc::Entity, nc::ecs::ExplicitEcs<Speed, const nc::Transform>, nc::ecs::CommandBuffer&, float) {});
+    registry.CommitPendingChanges();
+    uut.Run(World(), 1.0f);
+    EXPECT_EQ(1ull, uut.BatchCount());
+}
+
+TEST_F(LogicSchedulerTests, Run_conflictingDeclarations_splitIntoBatches)
+{
+    // The reader must not observe a partially updated Health pool.
+    auto sum = std::atomic<int>{0};
+    for (auto i = 0; i < 50; ++i)
+    {
+        AddLogic(nc::LogicAccess<Health>{}, [](nc::Entity self, nc::ecs::ExplicitEcs<Health> world, nc::ecs::CommandBuffer&, float)
+        {
+            world.Get<Health>(self).value = 1;
+        });
+    }
+
+    AddLogic(nc::LogicAccess<const Health>{}, [&sum](nc::Entity, nc::ecs::ExplicitEcs<const Health> world, nc::ecs::CommandBuffer&, float)
+    {
+        for (const auto& health : world.GetAll<Health>())
+            sum += health.value;
+    });
+
+    registry.CommitPendingChanges();
+    uut.Run(World(), 1.0f);
+    EXPECT_EQ(2ull, uut.BatchCount());
+    EXPECT_EQ(50, sum.load());
+}
+
+TEST_F(LogicSchedulerTests, Run_selfConflictingDeclaration_runsOnCallingThread)
+{
+    const auto caller = std::this_thread::get_id();
+    auto calls = 0;
+    for (auto i = 0; i < 20; ++i)
+    {
+        AddLogic(nc::LogicAccess<Health, const Health>{}, [&](nc::Entity, nc::ecs::ExplicitEcs<Health, const Health>, nc::ecs::CommandBuffer&, float)
+        {
+            EXPECT_EQ(caller, std::this_thread::get_id());
+            ++calls;
+        });
+    }
+
+    registry.CommitPendingChanges();
+    uut.Run(World(), 1.0f);
+    EXPECT_EQ(20, calls);
+    EXPECT_EQ(1ull, uut.BatchCount());
+}
+
+TEST_F(LogicSchedulerTests, Run_recordedCommands_appliedAfterAllLogic)
+{
+    auto entities = std::vector<nc::Entity>{};
+    auto observedEarly = std::atomic<int>{0};
+    for (auto i = 0; i < 100; ++i)
+    {
+        entities.push_back(AddLogic(nc::LogicAccess<const Spawned>{}, [&observedEarly](nc::Entity self, nc::ecs::ExplicitEcs<const Spawned> world, nc::ecs::CommandBuffer& commands, float)
+        {
+            if (world.Contains<Spawned>(self))
+                ++observedEarly;
+
+            commands.Emplace<Spawned>(self);
+        }));
+    }
+
+    registry.CommitPendingChanges();
+    uut.Run(World(), 1.0f);
+    EXPECT_EQ(0, observedEarly.load());
+    for (auto entity : entities)
+    {
+        EXPECT_TRUE(World().Contains<Spawned>(entity));
+    }
+}
+
+TEST_F(LogicSchedulerTests, Run_parallelLogicThrows_propagatesException)
+{
+    for (auto i = 0; i < 40; ++i)
+    {
+        AddLogic(nc::LogicAccess<Health>{}, [i](nc::Entity, nc::ecs::ExplicitEcs<Health>, nc::ecs::CommandBuffer&, float)
+        {
+            if (i == 30)
+                throw std::runtime_error{"logic failed"};
+        });
+    }
+
+    registry.CommitPendingChanges();
+    EXPECT_THROW(uut.Run(World(), 1.0f), std::runtime_error);
+}
+
+TEST_F(LogicSchedulerTests, FrameLogicRun_parallelLogic_appliesCommandsImmediately)
+{
+    const auto entity = AddLogic(nc::LogicAccess<Spawned>{}, [](nc::Entity self, nc::ecs::ExplicitEcs<Spawned>, nc::ecs::CommandBuffer& commands, float)
+    {
+        commands.Emplace<Spawned>(self);
+    });
+
+    auto world = World();
+    world.Get<nc::FrameLogic>(entity).Run(world, 1.0f);
+    EXPECT_TRUE(world.Contains<Spawned>(entity));
+}
+
+TEST_F(LogicSchedulerTests, FrameLogicRun_writableTypeOnOtherEntity_throws)
+{
+    const auto other = AddLogic([](nc::Entity, nc::ecs::Ecs, float) {});
+    const auto entity = AddLogic(nc::LogicAccess<Health, const Speed>{}, [other](nc::Entity self, nc::ecs::ExplicitEcs<Health, const Speed> world, nc::ecs::CommandBuffer&, float)
+    {
+        world.Get<Health>(self).value = world.Get<Speed>(other).value;
+        world.Get<Health>(other).value = 1;
+    });
+
+    auto world = World();
+    EXPECT_THROW(world.Get<nc::FrameLogic>(entity).Run(world, 1.0f), nc::NcError);
+}
+
+TEST_F(LogicSchedulerTests, FrameLogicRun_mutableAccessBypassingCommandBuffer_throws)
+{
+    const auto remover = AddLogic(nc::LogicAccess<Spawned>{}, [](nc::Entity self, nc::ecs::ExplicitEcs<Spawned> world, nc::ecs::CommandBuffer&, float)
+    {
+        world.GetPool<Spawned>().Remove(self);
+    });
+
+    const auto writer = AddLogic(nc::LogicAccess<Health>{}, [](nc::Entity, nc::ecs::ExplicitEcs<Health> world, nc::ecs::CommandBuffer&, float)
+    {
+        for (auto& health : world.GetAll<Health>())
+            health.value = 1;
+    });
+
+    auto world = World();
+    world.Emplace<Spawned>(remover);
+    EXPECT_THROW(world.Get<nc::FrameLogic>(remover).Run(world, 1.0f), nc::NcError);
+    EXPECT_THROW(world.Get<nc::FrameLogic>(writer).Run(world, 1.0f), nc::NcError);
+    EXPECT_TRUE(world.Contains<Spawned>(remover));
+}
+
+TEST_F(LogicSchedulerTests, ParallelFrameLogicCallable_constDeclaration_requiresReadOnlyInterface)
+{
+    using writesHealth = decltype([](nc::Entity, nc::ecs::ExplicitEcs<Health>, nc::ecs::CommandBuffer&, float) {});
+    using readsHealth = decltype([](nc::Entity, nc::ecs::ExplicitEcs<const Health>, nc::ecs::CommandBuffer&, float) {});
+    static_assert(nc::ParallelFrameLogicCallable<writesHealth, Health>);
+    static_assert(nc::ParallelFrameLogicCallable<readsHealth, Health>);
+    static_assert(nc::ParallelFrameLogicCallable<readsHealth, const Health>);
+    static_assert(!nc::ParallelFrameLogicCallable<writesHealth, const Health>);
+}
+
+TEST_F(LogicSchedulerTests, FrameLogicSetFunction_switchesMode)
+{
+    const auto entity = AddLogic([](nc::Entity, nc::ecs::Ecs, float) {});
+    auto& logic = World().Get<nc::FrameLogic>(entity);
+    EXPECT_FALSE(logic.IsParallel());
+    logic.SetFunction(nc::LogicAccess<Health>{}, [](nc::Entity, nc::ecs::ExplicitEcs<Health>, nc::ecs::CommandBuffer&, float) {});
+    EXPECT_TRUE(logic.IsParallel());
+    logic.SetFunction([](nc::Entity, nc::ecs::Ecs, float) {});
+    EXPECT_FALSE(logic.IsParallel());
+}
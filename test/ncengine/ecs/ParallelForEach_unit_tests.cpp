@@ -0,0 +1,198 @@
+#include "gtest/gtest.h"
+#include "ncengine/ecs/ParallelForEach.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+struct S1 { int value = 0; };
+struct S2 { int value = 0; };
+struct G1 { int value = 0; };
+struct G2 { int value = 0; };
+
+class ParallelForEachTests : public ::testing::Test
+{
+    public:
+        static constexpr size_t registryCapacity = 1000ull;
+        nc::ecs::ComponentRegistry registry;
+        tf::Executor executor{4};
+        nc::task::AsyncDispatcher dispatcher{&executor};
+
+        ParallelForEachTests()
+            : registry{registryCapacity}
+        {
+            registry.RegisterType<nc::Tag>(registryCapacity);
+            registry.RegisterType<nc::Transform>(registryCapacity);
+            registry.RegisterType<nc::ecs::detail::FreeComponentGroup>(registryCapacity);
+            registry.RegisterType<nc::Hierarchy>(registryCapacity);
+            registry.RegisterType<S1>(registryCapacity);
+            registry.RegisterType<S2>(registryCapacity);
+            registry.RegisterType<G1>(registryCapacity);
+            registry.RegisterType<G2>(registryCapacity);
+            registry.RegisterGroup<G1, G2>();
+        }
+
+        auto World() -> nc::ecs::Ecs
+        {
+            return nc::ecs::Ecs{registry};
+        }
+};
+
+TEST_F(ParallelForEachTests, ParallelForEach_singleType_visitsEveryComponent)
+{
+    auto world = World();
+    constexpr auto count = 600;
+    for (auto i = 0; i < count; ++i)
+    {
+        world.Emplace<S1>(world.Emplace<nc::Entity>({}), i);
+    }
+
+    registry.CommitPendingChanges();
+    nc::ecs::ParallelForEach<S1>(world, dispatcher, [](S1& s1) { s1.value *= 2; }, 16);
+
+    auto expected = 0;
+    for (const auto& s1 : world.GetAll<S1>())
+    {
+        EXPECT_EQ(expected, s1.value);
+        expected += 2;
+    }
+}
+
+TEST_F(ParallelForEachTests, ParallelForEach_withEntity_passesOwningEntity)
+{
+    auto world = World();
+    for (auto i = 0; i < 100; ++i)
+    {
+        world.Emplace<S1>(world.Emplace<nc::Entity>({}));
+    }
+
+    registry.CommitPendingChanges();
+    auto mismatches = std::atomic<int>{0};
+    nc::ecs::ParallelForEach<const S1>(world, dispatcher, [&](nc::Entity entity, const S1& s1)
+    {
+        if (&world.Get<S1>(entity) != &s1)
+            ++mismatches;
+    }, 8);
+
+    EXPECT_EQ(0, mismatches.load());
+}
+
+TEST_F(ParallelForEachTests, ParallelForEach_multipleTypes_visitsOnlyMatchingEntities)
+{
+    auto world = World();
+    auto expected = std::vector<nc::Entity>{};
+    for (auto i = 0; i < 300; ++i)
+    {
+        const auto entity = world.Emplace<nc::Entity>({});
+        world.Emplace<S1>(entity, i);
+        if (i % 3 == 0)
+        {
+            world.Emplace<S2>(entity);
+            expected.push_back(entity);
+        }
+    }
+
+    registry.CommitPendingChanges();
+    auto visited = std::vector<nc::Entity>{};
+    auto mutex = std::mutex{};
+    nc::ecs::ParallelForEach<const S1, S2>(world, dispatcher, [&](nc::Entity entity, const S1& s1, S2& s2)
+    {
+        s2.value = s1.value;
+        auto lock = std::lock_guard{mutex};
+        visited.push_back(entity);
+    }, 4);
+
+    std::ranges::sort(expected, {}, &nc::Entity::Index);
+    std::ranges::sort(visited, {}, &nc::Entity::Index);
+    EXPECT_EQ(expected, visited);
+    for (const auto entity : expected)
+    {
+        EXPECT_EQ(world.Get<S1>(entity).value, world.Get<S2>(entity).value);
+    }
+}
+
+TEST_F(ParallelForEachTests, ParallelForEach_ownedGroup_visitsGroupedEntities)
+{
+    auto world = World();
+    auto grouped = 0;
+    for (auto i = 0; i < 200; ++i)
+    {
+        const auto entity = world.Emplace<nc::Entity>({});
+        world.Emplace<G1>(entity, i);
+        if (i % 2 == 0)
+        {
+            world.Emplace<G2>(entity);
+            ++grouped;
+        }
+    }
+
+    registry.CommitPendingChanges();
+    auto visits = std::atomic<int>{0};
+    nc::ecs::ParallelForEach<G1, G2>(world, dispatcher, [&visits](G1& g1, G2& g2)
+    {
+        g2.value = g1.value + 1;
+        ++visits;
+    }, 4);
+
+    EXPECT_EQ(grouped, visits.load());
+    for (const auto& [g1, g2] : world.GetGroup<G1, G2>())
+    {
+        EXPECT_EQ(g1.value + 1, g2.value);
+    }
+}
+
+TEST_F(ParallelForEachTests, ParallelForEach_emptyPool_doesNotInvoke)
+{
+    auto calls = 0;
+    nc::ecs::ParallelForEach<S1>(World(), dispatcher, [&calls](S1&) { ++calls; });
+    EXPECT_EQ(0, calls);
+}
+
+TEST_F(ParallelForEachTests, ParallelForEach_restrictedInterface_compiles)
+{
+    auto world = World();
+    world.Emplace<S1>(world.Emplace<nc::Entity>({}), 1);
+    registry.CommitPendingChanges();
+
+    auto restricted = nc::ecs::ExplicitEcs<S1>{registry};
+    auto sum = std::atomic<int>{0};
+    nc::ecs::ParallelForEach<const S1>(restricted, dispatcher, [&sum](const S1& s1) { sum += s1.value; });
+    EXPECT_EQ(1, sum.load());
+}
+
+template<class FilteredEcs, class... Ts>
+concept CanParallelForEach = requires (FilteredEcs world, const nc::task::AsyncDispatcher& dispatcher)
+{
+    nc::ecs::ParallelForEach<Ts...>(world, dispatcher, [](Ts&...) {});
+};
+
+TEST_F(ParallelForEachTests, ParallelForEach_constDeclaredType_rejectsWriteAccess)
+{
+    static_assert(CanParallelForEach<nc::ecs::ExplicitEcs<S1>, S1>);
+    static_assert(CanParallelForEach<nc::ecs::ExplicitEcs<S1>, const S1>);
+    static_assert(CanParallelForEach<nc::ecs::ExplicitEcs<const S1>, const S1>);
+    static_assert(!CanParallelForEach<nc::ecs::ExplicitEcs<const S1>, S1>);
+    static_assert(!CanParallelForEach<nc::ecs::ExplicitEcs<const S1, S2>, S1, S2>);
+    static_assert(!CanParallelForEach<nc::ecs::ExplicitEcs<S1>, const S2>);
+    static_assert(!CanParallelForEach<nc::ecs::ExplicitEcs<const G1, G2>, G1, G2>);
+}
+
+TEST_F(ParallelForEachTests, ParallelForEach_constDeclaredGroup_visitsGroupedEntities)
+{
+    auto world = World();
+    for (auto i = 0; i < 50; ++i)
+    {
+        const auto entity = world.Emplace<nc::Entity>({});
+        world.Emplace<G1>(entity, i);
+        world.Emplace<G2>(entity);
+    }
+
+    registry.CommitPendingChanges();
+    auto restricted = nc::ecs::ExplicitEcs<const G1, G2>{registry};
+    nc::ecs::ParallelForEach<const G1, G2>(restricted, dispatcher, [](const G1& g1, G2& g2) { g2.value = g1.value; }, 4);
+    for (const auto& [g1, g2] : world.GetGroup<G1, G2>())
+    {
+        EXPECT_EQ(g1.value, g2.value);
+    }
+}
@@ -1,6 +1,8 @@
 #include "gtest/gtest.h"
 #include "ncengine/ecs/detail/SparseSet.h"
 
+#include <array>
+
 using SparseSet_t = nc::ecs::detail::SparseSet<int>;
 constexpr auto g_entity = nc::Entity{1, 0, 0};
 
@@ -33,6 +35,49 @@ TEST(SparseSetTests, Remove_componentDoesNotExist_returnsFalse)
     EXPECT_FALSE(uut.Remove(g_entity));
 }
 
+TEST(SparseSetTests, RemoveBatch_mixedPositions_compactsRemaining)
+{
+    auto uut = SparseSet_t{10};
+    for (auto i = 0u; i < 8u; ++i)
+        uut.Insert(nc::Entity{i, 0, 0}, static_cast<int>(i) * 10);
+
+    // Holes at the front, middle, and in the tail that would otherwise be used to fill them
+    const auto removed = std::array{nc::Entity{6, 0, 0}, nc::Entity{0, 0, 0}, nc::Entity{3, 0, 0}, nc::Entity{7, 0, 0}};
+    uut.RemoveBatch(removed);
+
+    ASSERT_EQ(4, uut.Size());
+    ASSERT_EQ(4, uut.GetEntities().size());
+    for (auto entity : removed)
+        EXPECT_FALSE(uut.Contains(entity));
+
+    for (auto i : {1u, 2u, 4u, 5u})
+    {
+        const auto entity = nc::Entity{i, 0, 0};
+        ASSERT_TRUE(uut.Contains(entity));
+        EXPECT_EQ(static_cast<int>(i) * 10, uut.Get(entity));
+        EXPECT_EQ(entity, uut.GetEntities()[uut.GetIndex(entity)]);
+    }
+}
+
+TEST(SparseSetTests, RemoveBatch_allEntities_empties)
+{
+    auto uut = SparseSet_t{10};
+    const auto entities = std::array{nc::Entity{2, 0, 0}, nc::Entity{5, 0, 0}, nc::Entity{9, 0, 0}};
+    for (auto entity : entities)
+        uut.Insert(entity, 1);
+
+    uut.RemoveBatch(entities);
+    EXPECT_EQ(0, uut.Size());
+    EXPECT_EQ(0, uut.GetEntities().size());
+}
+
+TEST(SparseSetTests, RemoveBatch_entityDoesNotExist_throws)
+{
+    auto uut = SparseSet_t{10};
+    const auto entities = std::array{g_entity};
+    EXPECT_THROW(uut.RemoveBatch(entities), std::exception);
+}
+
 TEST(SparseSetTests, Get_exists_returnsComponent)
 {
     auto uut = SparseSet_t{10};
@@ -127,6 +172,76 @@ TEST(SparseSetTests, Contains_doesNotExist_returnsFalse)
     EXPECT_FALSE(uut.Contains(g_entity));
 }
 
+TEST(SparseSetTests, Stage_noComponentOnEntity_tracksStagedIndex)
+{
+    auto uut = SparseSet_t{10};
+    uut.Stage(g_entity, 3u);
+    EXPECT_FALSE(uut.Contains(g_entity));
+    EXPECT_EQ(3u, uut.GetStagedIndex(g_entity));
+    EXPECT_EQ(nc::Entity::NullIndex, uut.GetStagedIndex(nc::Entity{2, 0, 0}));
+    EXPECT_EQ(0u, uut.Size());
+}
+
+TEST(SparseSetTests, Stage_entityAlreadyStagedOrInserted_throws)
+{
+    auto uut = SparseSet_t{10};
+    const auto inserted = nc::Entity{2, 0, 0};
+    uut.Stage(g_entity, 0u);
+    uut.Insert(inserted, 1);
+    EXPECT_THROW(uut.Stage(g_entity, 1u), nc::NcError);
+    EXPECT_THROW(uut.Stage(inserted, 1u), nc::NcError);
+}
+
+TEST(SparseSetTests, Insert_stagedEntity_replacesStagedIndex)
+{
+    auto uut = SparseSet_t{10};
+    uut.Stage(g_entity, 5u);
+    uut.Insert(g_entity, 42);
+    EXPECT_TRUE(uut.Contains(g_entity));
+    EXPECT_EQ(nc::Entity::NullIndex, uut.GetStagedIndex(g_entity));
+    EXPECT_EQ(42, uut.Get(g_entity));
+}
+
+TEST(SparseSetTests, Unstage_stagedEntity_clearsEntry)
+{
+    auto uut = SparseSet_t{10};
+    uut.Stage(g_entity, 0u);
+    uut.Unstage(g_entity);
+    EXPECT_EQ(nc::Entity::NullIndex, uut.GetStagedIndex(g_entity));
+    EXPECT_FALSE(uut.Remove(g_entity));
+    EXPECT_NO_THROW(uut.Stage(g_entity, 1u));
+}
+
+TEST(SparseSetTests, Insert_largeCapacity_allocatesOnlyTouchedPages)
+{
+    constexpr auto capacity = SparseSet_t::PageSize * 100;
+    auto uut = SparseSet_t{capacity};
+    EXPECT_EQ(0u, uut.AllocatedPageCount());
+    EXPECT_FALSE(uut.Contains(nc::Entity{capacity - 1, 0, 0}));
+    EXPECT_EQ(0u, uut.AllocatedPageCount());
+
+    const auto low = nc::Entity{3, 0, 0};
+    const auto high = nc::Entity{capacity - 1, 0, 0};
+    uut.Insert(low, 1);
+    uut.Insert(high, 2);
+    EXPECT_EQ(2u, uut.AllocatedPageCount());
+    EXPECT_EQ(1, uut.Get(low));
+    EXPECT_EQ(2, uut.Get(high));
+    EXPECT_FALSE(uut.Contains(nc::Entity{SparseSet_t::PageSize, 0, 0}));
+}
+
+TEST(SparseSetTests, Clear_releasesPages)
+{
+    auto uut = SparseSet_t{SparseSet_t::PageSize * 4};
+    uut.Insert(nc::Entity{0, 0, 0}, 1);
+    uut.Insert(nc::Entity{SparseSet_t::PageSize * 3, 0, nc::Entity::Flags::Persistent}, 2);
+    uut.ClearNonPersistent();
+    EXPECT_EQ(1u, uut.AllocatedPageCount());
+    uut.Clear();
+    EXPECT_EQ(0u, uut.AllocatedPageCount());
+    EXPECT_FALSE(uut.Contains(nc::Entity{0, 0, 0}));
+}
+
 TEST(SparseSetTests, Swap_validEntities_swapsPositions)
 {
     const auto first = nc::Entity{9, 0, 0};
@@ -141,6 +256,20 @@ TEST(SparseSetTests, Swap_validEntities_swapsPositions)
     EXPECT_EQ(0, uut.GetIndex(second));
 }
 
+TEST(SparseSetTests, Swap_validEntities_keepsComponentsWithEntities)
+{
+    const auto first = nc::Entity{9, 0, 0};
+    const auto second = nc::Entity{7, 0, 0};
+    auto uut = SparseSet_t{10};
+    uut.Insert(first, 1);
+    uut.Insert(second, 2);
+    uut.Swap(first, second);
+    EXPECT_EQ(1, uut.Get(first));
+    EXPECT_EQ(2, uut.Get(second));
+    EXPECT_EQ(2, uut.GetPackedArray()[0]);
+    EXPECT_EQ(second, uut.GetEntities()[0]);
+}
+
 TEST(SparseSetTests, Swap_sameEntity_succeeds)
 {
     const auto entity = nc::Entity{1, 0, 0};
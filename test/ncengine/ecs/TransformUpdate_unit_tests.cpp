@@ -0,0 +1,205 @@
+#include "gtest/gtest.h"
+#include "ecs/TransformUpdate.h"
+
+#include <initializer_list>
+#include <span>
+#include <vector>
+
+using namespace nc;
+
+namespace
+{
+constexpr auto g_capacity = 64ull;
+
+struct TestRegistry : ecs::ComponentRegistry
+{
+    TestRegistry()
+        : ecs::ComponentRegistry{g_capacity}
+    {
+        RegisterType<Tag>(g_capacity);
+        RegisterType<Transform>(g_capacity);
+        RegisterType<ecs::detail::FreeComponentGroup>(g_capacity);
+        RegisterType<Hierarchy>(g_capacity);
+    }
+};
+
+// Build the same mix of deep, wide, and static nodes in any registry, returning entities in creation order
+auto BuildScene(ecs::Ecs world) -> std::vector<Entity>
+{
+    auto entities = std::vector<Entity>{};
+    auto add = [&](Entity parent, const Vector3& position, Entity::flags_type flags = Entity::Flags::None)
+    {
+        return entities.emplace_back(world.Emplace<Entity>({
+            .position = position,
+            .rotation = Quaternion::FromEulerAngles(0.1f, 0.2f, 0.3f),
+            .scale = Vector3::Splat(1.5f),
+            .parent = parent,
+            .flags = flags
+        }));
+    };
+
+    // deep chain
+    auto chain = add(Entity::Null(), Vector3{1.0f, 0.0f, 0.0f});
+    for (auto i = 0; i < 6; ++i)
+        chain = add(chain, Vector3{0.0f, 1.0f, 0.0f});
+
+    // wide tree with a nested level
+    const auto wideRoot = add(Entity::Null(), Vector3{-3.0f, 2.0f, 1.0f});
+    for (auto i = 0; i < 5; ++i)
+    {
+        const auto child = add(wideRoot, Vector3{static_cast<float>(i), 0.0f, 1.0f});
+        add(child, Vector3{0.0f, 0.0f, 2.0f});
+        add(child, Vector3{0.5f, 0.5f, 0.5f});
+    }
+
+    // statics are skipped by both modes
+    add(Entity::Null(), Vector3{9.0f, 9.0f, 9.0f}, Entity::Flags::Static);
+    return entities;
+}
+
+struct WorldSpace
+{
+    Vector3 position;
+    Quaternion rotation;
+    Vector3 scale;
+};
+
+auto CaptureWorldSpace(ecs::Ecs world, std::span<const Entity> entities) -> std::vector<WorldSpace>
+{
+    auto out = std::vector<WorldSpace>{};
+    for (auto entity : entities)
+    {
+        const auto& transform = world.Get<Transform>(entity);
+        out.emplace_back(transform.Position(), transform.Rotation(), transform.Scale());
+    }
+
+    return out;
+}
+
+// Dirty nodes without changing their local values, so both modes recompute from the same inputs
+void Touch(ecs::Ecs world, std::initializer_list<Entity> entities)
+{
+    for (auto entity : entities)
+        world.Get<Transform>(entity).Translate(Vector3::Zero());
+}
+
+void ExpectMatchingWorldSpace(std::span<const WorldSpace> expected, std::span<const WorldSpace> actual)
+{
+    ASSERT_EQ(expected.size(), actual.size());
+    for (auto i = 0ull; i < expected.size(); ++i)
+    {
+        EXPECT_EQ(expected[i].position, actual[i].position) << "node " << i;
+        EXPECT_EQ(expected[i].rotation, actual[i].rotation) << "node " << i;
+        EXPECT_EQ(expected[i].scale, actual[i].scale) << "node " << i;
+    }
+}
+} // anonymous namespace
+
+// Only one registry may exist at a time, so each mode is run in turn on the same scene. Results from the
+// depth-ordered sweep are captured first, then the graph walk recomputes the same nodes from identical local values.
+TEST(TransformUpdateTests, DepthOrdered_nestedHierarchies_matchesGraphWalk)
+{
+    auto registry = TestRegistry{};
+    auto world = ecs::Ecs{registry};
+    const auto entities = BuildScene(world);
+    registry.CommitPendingChanges();
+
+    // Move the roots so every descendant's world space differs from its initial value
+    const auto chainRoot = entities.at(0);
+    const auto wideRoot = entities.at(7);
+    world.Get<Transform>(chainRoot).Translate(Vector3{0.0f, 5.0f, 0.0f});
+    world.Get<Transform>(wideRoot).Rotate(Vector3::Right(), 1.0f);
+
+    auto uut = ecs::DepthOrderedTransforms{};
+    EXPECT_TRUE(uut.Refresh(world));
+    EXPECT_EQ(entities.size() - 1, uut.size());
+    EXPECT_EQ(7ull, uut.LevelCount());
+    uut.UpdateAll();
+    const auto depthOrdered = CaptureWorldSpace(world, entities);
+
+    Touch(world, {chainRoot, wideRoot});
+    ecs::UpdateWorldMatricesGraphWalk(world);
+    ExpectMatchingWorldSpace(CaptureWorldSpace(world, entities), depthOrdered);
+}
+
+TEST(TransformUpdateTests, DepthOrdered_dirtySubtree_matchesGraphWalk)
+{
+    auto registry = TestRegistry{};
+    auto world = ecs::Ecs{registry};
+    const auto entities = BuildScene(world);
+    registry.CommitPendingChanges();
+
+    auto uut = ecs::DepthOrderedTransforms{};
+    uut.Refresh(world);
+    uut.UpdateAll();
+
+    // Move a node in the middle of the chain and one child of the wide root
+    const auto chainNode = entities.at(3);
+    const auto wideChild = entities.at(8);
+    world.Get<Transform>(chainNode).Translate(Vector3{2.0f, 0.0f, 0.0f});
+    world.Get<Transform>(wideChild).Rotate(Vector3::Up(), 0.5f);
+    EXPECT_FALSE(uut.Refresh(world));
+    uut.UpdateAll();
+    const auto depthOrdered = CaptureWorldSpace(world, entities);
+
+    Touch(world, {chainNode, wideChild});
+    ecs::UpdateWorldMatricesGraphWalk(world);
+    ExpectMatchingWorldSpace(CaptureWorldSpace(world, entities), depthOrdered);
+}
+
+TEST(TransformUpdateTests, Refresh_noStructuralChanges_keepsCachedOrder)
+{
+    auto registry = TestRegistry{};
+    auto world = ecs::Ecs{registry};
+    const auto entities = BuildScene(world);
+    registry.CommitPendingChanges();
+
+    auto uut = ecs::DepthOrderedTransforms{};
+    EXPECT_TRUE(uut.Refresh(world));
+    EXPECT_FALSE(uut.Refresh(world));
+
+    world.Get<Transform>(entities.front()).SetPosition(Vector3::One());
+    registry.CommitPendingChanges();
+    EXPECT_FALSE(uut.Refresh(world));
+}
+
+TEST(TransformUpdateTests, Refresh_membershipChanged_rebuildsOrder)
+{
+    auto registry = TestRegistry{};
+    auto world = ecs::Ecs{registry};
+    const auto entities = BuildScene(world);
+    registry.CommitPendingChanges();
+
+    auto uut = ecs::DepthOrderedTransforms{};
+    uut.Refresh(world);
+    const auto initialSize = uut.size();
+
+    world.Emplace<Entity>({.parent = entities.front()});
+    registry.CommitPendingChanges();
+    EXPECT_TRUE(uut.Refresh(world));
+    EXPECT_EQ(initialSize + 1, uut.size());
+
+    world.Remove<Entity>(entities.back());
+    world.Remove<Entity>(entities.at(8));
+    registry.CommitPendingChanges();
+    EXPECT_TRUE(uut.Refresh(world));
+    EXPECT_EQ(initialSize - 2, uut.size()); // +1 added node, -3 for the wide child subtree, static was never ordered
+}
+
+TEST(TransformUpdateTests, Refresh_parentChanged_rebuildsOrder)
+{
+    auto registry = TestRegistry{};
+    auto world = ecs::Ecs{registry};
+    const auto entities = BuildScene(world);
+    registry.CommitPendingChanges();
+
+    auto uut = ecs::DepthOrderedTransforms{};
+    uut.Refresh(world);
+    const auto initialLevels = uut.LevelCount();
+
+    // Reparent the wide root under the end of the chain, deepening the tree
+    world.SetParent(entities.at(7), entities.at(6));
+    EXPECT_TRUE(uut.Refresh(world));
+    EXPECT_EQ(initialLevels + 3, uut.LevelCount());
+    EXPECT_FALSE(uut.Refresh(world));
+}
@@ -12,8 +12,9 @@ Registry g_registry{g_impl};
 
 namespace ecs
 {
-EcsModule::EcsModule(ComponentRegistry& registry, SystemEvents& events) noexcept
+EcsModule::EcsModule(ComponentRegistry& registry, const task::AsyncDispatcher& dispatcher, SystemEvents& events) noexcept
     : m_registry{&registry},
+      m_logicScheduler{dispatcher},
       m_rebuildStaticConnection{events.rebuildStatics.Connect([](){})}
 {
 }
@@ -70,11 +71,12 @@ class Transform_unit_tests : public ::testing::Test
     public:
         Registry* registry;
         SystemEvents events;
+        task::AsyncDispatcher dispatcher{nullptr};
         ecs::EcsModule ecsModule;
 
         Transform_unit_tests()
             : registry{&g_registry},
-              ecsModule{g_impl, events}
+              ecsModule{g_impl, dispatcher, events}
         {
         }
 
@@ -197,6 +199,24 @@ TEST_F(Transform_unit_tests, Scale_CalledFromChild_ResultIncludesParentScale)
     EXPECT_EQ(actual, expected);
 }
 
+TEST_F(Transform_unit_tests, Rotation_DirtyRoot_ReturnsPreviousWorldRotation)
+{
+    auto e = registry->Add<Entity>(EntityInfo{.rotation = TestRotQuat2});
+    auto t = registry->Get<Transform>(e);
+    t->SetRotation(TestRotQuat3);
+    EXPECT_EQ(t->Rotation(), TestRotQuat2);
+    ecsModule.RunFrameLogic();
+    EXPECT_EQ(t->Rotation(), TestRotQuat3);
+}
+
+TEST_F(Transform_unit_tests, Scale_RootWithNegativeScale_DecomposesScaleFromMatrix)
+{
+    auto e = registry->Add<Entity>(EntityInfo{.scale = Vector3{-2.0f, 1.0f, 1.0f}});
+    auto t = registry->Get<Transform>(e);
+    auto actual = t->Scale();
+    EXPECT_EQ(actual, (Vector3{2.0f, 1.0f, 1.0f}));
+}
+
 TEST_F(Transform_unit_tests, Up_ReturnsNormalizedVector)
 {
     auto e = registry->Add<Entity>(EntityInfo{.rotation = TestRotQuat2, .scale = TestScale2});
@@ -603,6 +623,32 @@ TEST_F(Transform_unit_tests, RotateAxisAngleOverload_CalledOnParent_OnlyWorldRot
     EXPECT_EQ(tChild->LocalScale(), Vector3::One());
 }
 
+TEST_F(Transform_unit_tests, SetPositionAndRotationXM_CalledOnRoot_ScalePreserved)
+{
+    auto e = registry->Add<Entity>(EntityInfo{.position = TestPos1, .rotation = TestRotQuat1, .scale = TestScale2});
+    auto t = registry->Get<Transform>(e);
+    t->SetPositionAndRotationXM(ToXMVector(TestPos2), ToXMVector(TestRotQuat2));
+    ecsModule.RunFrameLogic();
+    EXPECT_EQ(t->Position(), TestPos2);
+    EXPECT_EQ(t->Rotation(), TestRotQuat2);
+    EXPECT_EQ(t->Scale(), TestScale2);
+    EXPECT_EQ(t->LocalPosition(), TestPos2);
+    EXPECT_EQ(t->LocalRotation(), TestRotQuat2);
+    EXPECT_EQ(t->LocalScale(), TestScale2);
+}
+
+TEST_F(Transform_unit_tests, LocalTransformationMatrix_CalledOnRoot_MatchesComposedMatrix)
+{
+    auto e = registry->Add<Entity>(EntityInfo{.position = TestPos1, .rotation = TestRotQuat2, .scale = TestScale2});
+    auto t = registry->Get<Transform>(e);
+    const auto expected = ComposeMatrix(TestScale2, TestRotQuat2, TestPos1);
+    const auto actual = t->LocalTransformationMatrix();
+    for (auto i = 0u; i < 4u; ++i)
+    {
+        EXPECT_TRUE(DirectX::XMVector4NearEqual(actual.r[i], expected.r[i], DirectX::XMVectorReplicate(0.0001f)));
+    }
+}
+
 int main(int argc, char ** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
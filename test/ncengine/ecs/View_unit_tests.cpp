@@ -33,6 +33,18 @@ struct Fake3 : public ComponentBase
     int value;
 };
 
+struct Grouped1 : public ComponentBase
+{
+    Grouped1(Entity entity, int v) : ComponentBase{entity}, value{v} {}
+    int value;
+};
+
+struct Grouped2 : public ComponentBase
+{
+    Grouped2(Entity entity, int v) : ComponentBase{entity}, value{v} {}
+    int value;
+};
+
 class View_unit_tests : public ::testing::Test
 {
     public:
@@ -48,6 +60,9 @@ class View_unit_tests : public ::testing::Test
             impl.RegisterType<Fake1>(10);
             impl.RegisterType<Fake2>(10);
             impl.RegisterType<Fake3>(10);
+            impl.RegisterType<Grouped1>(10);
+            impl.RegisterType<Grouped2>(10);
+            impl.RegisterGroup<Grouped1, Grouped2>();
         }
 
         ~View_unit_tests()
@@ -255,6 +270,42 @@ TEST_F(View_unit_tests, Multi_VisitsEach)
     EXPECT_EQ(registry.Get<Fake3>(e4)->value, expectedFake3Value);
 }
 
+TEST_F(View_unit_tests, Multi_OwningGroup_VisitsEachMatchingEntity)
+{
+    auto e1 = registry.Add<Entity>(EntityInfo{});
+    auto e2 = registry.Add<Entity>(EntityInfo{});
+    auto e3 = registry.Add<Entity>(EntityInfo{});
+    registry.Add<Grouped1>(e1, 1);
+    registry.Add<Grouped1>(e2, 2);
+    registry.Add<Grouped1>(e3, 3);
+    registry.Add<Grouped2>(e3, 3);
+    registry.Add<Grouped2>(e1, 1);
+    registry.CommitStagedChanges();
+
+    auto visited = std::vector<Entity>{};
+    for(auto& [g1, g2] : MultiView<Grouped1, const Grouped2>{&registry})
+    {
+        EXPECT_EQ(g1->ParentEntity(), g2->ParentEntity());
+        EXPECT_EQ(g1->value, g2->value);
+        visited.push_back(g1->ParentEntity());
+    }
+
+    ASSERT_EQ(2, visited.size());
+    EXPECT_TRUE(std::ranges::contains(visited, e1));
+    EXPECT_TRUE(std::ranges::contains(visited, e3));
+
+    registry.Remove<Grouped2>(e1);
+    auto count = 0;
+    for(auto& [g1, g2] : MultiView<Grouped1, Grouped2>{&registry})
+    {
+        EXPECT_EQ(e3, g1->ParentEntity());
+        EXPECT_EQ(e3, g2->ParentEntity());
+        ++count;
+    }
+
+    EXPECT_EQ(1, count);
+}
+
 TEST_F(View_unit_tests, Multi_ConstAndNonConstComponents_PropagatesConst)
 {
     for(auto& [f1, f2] : MultiView<Fake1, const Fake2>{&registry})
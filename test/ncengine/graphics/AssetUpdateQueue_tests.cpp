@@ -0,0 +1,191 @@
+#include "gtest/gtest.h"
+#include "graphics/shader_resource/AssetUpdateQueue.h"
+#include "graphics/shader_resource/CubeMapArrayBufferHandle.h"
+#include "graphics/shader_resource/MeshArrayBufferHandle.h"
+#include "graphics/shader_resource/TextureArrayBufferHandle.h"
+
+#include <vector>
+
+using namespace nc::graphics;
+
+namespace
+{
+// Records what reaches the backend, copying data since event spans only live for the duration of the emit
+struct MeshCall
+{
+    MabUpdateAction action;
+    std::vector<nc::asset::MeshVertex> vertices;
+    std::vector<uint32_t> indices;
+    std::vector<nc::asset::MeshArenaRange> changedVertices;
+};
+
+struct BackendLog
+{
+    std::vector<MeshCall> meshCalls;
+    std::vector<CabUpdateAction> cubeMapActions;
+    std::vector<TabUpdateAction> textureActions;
+    std::vector<size_t> textureIds;
+
+    void OnMesh(const MabUpdateEventData& data)
+    {
+        meshCalls.emplace_back(
+            data.action,
+            std::vector<nc::asset::MeshVertex>{data.vertices.begin(), data.vertices.end()},
+            std::vector<uint32_t>{data.indices.begin(), data.indices.end()},
+            std::vector<nc::asset::MeshArenaRange>{data.changedVertices.begin(), data.changedVertices.end()}
+        );
+    }
+
+    void OnCubeMap(const CabUpdateEventData& data)
+    {
+        cubeMapActions.push_back(data.action);
+    }
+
+    void OnTexture(const TabUpdateEventData& data)
+    {
+        textureActions.push_back(data.action);
+        for (const auto& texture : data.data)
+            textureIds.push_back(texture.id);
+    }
+};
+
+auto MakeVertices(size_t count, float x) -> std::vector<nc::asset::MeshVertex>
+{
+    auto out = std::vector<nc::asset::MeshVertex>(count);
+    for (auto& vertex : out)
+        vertex.position = nc::Vector3{x, 0.0f, 0.0f};
+
+    return out;
+}
+
+auto MakeTexture(size_t id) -> nc::asset::TextureWithId
+{
+    return nc::asset::TextureWithId{nc::asset::Texture{1u, 1u, std::vector<unsigned char>(4, 255)}, id, 0};
+}
+} // anonymous namespace
+
+class AssetUpdateQueueTests : public ::testing::Test
+{
+    public:
+        nc::Signal<const MabUpdateEventData&> meshChannel;
+        nc::Signal<const CabUpdateEventData&> cubeMapChannel;
+        nc::Signal<const TabUpdateEventData&> textureChannel;
+        BackendLog log;
+        nc::Connection meshConnection = meshChannel.Connect(&log, &BackendLog::OnMesh);
+        nc::Connection cubeMapConnection = cubeMapChannel.Connect(&log, &BackendLog::OnCubeMap);
+        nc::Connection textureConnection = textureChannel.Connect(&log, &BackendLog::OnTexture);
+        MeshArrayBufferHandle meshes{&meshChannel};
+        CubeMapArrayBufferHandle cubeMaps{0u, ShaderStage::Fragment, &cubeMapChannel, 4u, 1u};
+        TextureArrayBufferHandle textures{0u, ShaderStage::Fragment, &textureChannel, 2u, 1u};
+        AssetUpdateQueue uut;
+
+        void Apply()
+        {
+            uut.Apply(meshes, cubeMaps, textures);
+        }
+};
+
+TEST_F(AssetUpdateQueueTests, Push_loadDuringInFlightRender_defersBackendUntilApply)
+{
+    {
+        // Mimic a manager whose storage changes or is freed after emitting, as happens if assets are loaded again
+        // before the render sync point.
+        auto vertices = MakeVertices(3, 1.0f);
+        auto indices = std::vector<uint32_t>{0u, 1u, 2u};
+        auto changed = std::vector<nc::asset::MeshArenaRange>{{0u, 3u}};
+        uut.Push(nc::asset::MeshUpdateEventData{vertices, indices, changed, changed, true});
+
+        auto loaded = std::vector{MakeTexture(7u)};
+        uut.Push(nc::asset::TextureUpdateEventData{nc::asset::UpdateAction::Load, loaded});
+        vertices.assign(3, nc::asset::MeshVertex{});
+        loaded.clear();
+    }
+
+    EXPECT_FALSE(uut.empty());
+    EXPECT_TRUE(log.meshCalls.empty());
+    EXPECT_TRUE(log.textureActions.empty());
+
+    Apply();
+    EXPECT_TRUE(uut.empty());
+    ASSERT_EQ(1ull, log.meshCalls.size());
+    const auto& call = log.meshCalls.front();
+    EXPECT_EQ(MabUpdateAction::Initialize, call.action);
+    ASSERT_EQ(3ull, call.vertices.size());
+    EXPECT_EQ(1.0f, call.vertices.front().position.x);
+    EXPECT_EQ((std::vector<uint32_t>{0u, 1u, 2u}), call.indices);
+    EXPECT_EQ(std::vector{TabUpdateAction::Add}, log.textureActions);
+    EXPECT_EQ(std::vector<size_t>{7u}, log.textureIds);
+}
+
+TEST_F(AssetUpdateQueueTests, Push_meshUpdates_queuesOnlyChangedRanges)
+{
+    auto vertices = MakeVertices(8, 1.0f);
+    auto indices = std::vector<uint32_t>{0u, 1u, 2u, 3u, 4u, 5u, 6u, 7u};
+    const auto firstChanged = std::vector<nc::asset::MeshArenaRange>{{0u, 2u}, {6u, 1u}};
+    uut.Push(nc::asset::MeshUpdateEventData{vertices, indices, firstChanged, firstChanged, false});
+
+    // A later load may reuse ranges from the first, so both updates must be kept
+    vertices[1].position.x = 2.0f;
+    indices[1] = 9u;
+    const auto secondChanged = std::vector<nc::asset::MeshArenaRange>{{1u, 1u}};
+    uut.Push(nc::asset::MeshUpdateEventData{vertices, indices, secondChanged, secondChanged, false});
+
+    Apply();
+    ASSERT_EQ(2ull, log.meshCalls.size());
+    const auto& first = log.meshCalls[0];
+    EXPECT_EQ(MabUpdateAction::Update, first.action);
+    ASSERT_EQ(3ull, first.vertices.size());
+    EXPECT_EQ((std::vector<uint32_t>{0u, 1u, 6u}), first.indices);
+    ASSERT_EQ(2ull, first.changedVertices.size());
+    EXPECT_EQ(6u, first.changedVertices[1].offset);
+
+    const auto& second = log.meshCalls[1];
+    EXPECT_EQ(MabUpdateAction::Update, second.action);
+    ASSERT_EQ(1ull, second.vertices.size());
+    EXPECT_EQ(2.0f, second.vertices.front().position.x);
+    EXPECT_EQ(std::vector<uint32_t>{9u}, second.indices);
+}
+
+TEST_F(AssetUpdateQueueTests, Push_reallocateThenUpdate_patchesSingleInitialize)
+{
+    const auto updates = std::vector<nc::asset::MeshArenaRange>{{0u, 1u}};
+    uut.Push(nc::asset::MeshUpdateEventData{MakeVertices(2, 5.0f), std::vector<uint32_t>{0u, 0u}, updates, updates, false});
+
+    auto vertices = MakeVertices(4, 3.0f);
+    auto indices = std::vector<uint32_t>{0u, 1u, 2u, 3u};
+    uut.Push(nc::asset::MeshUpdateEventData{vertices, indices, {}, {}, true});
+
+    vertices[1].position.x = 9.0f;
+    indices[1] = 7u;
+    const auto changed = std::vector<nc::asset::MeshArenaRange>{{1u, 1u}};
+    uut.Push(nc::asset::MeshUpdateEventData{vertices, indices, changed, changed, false});
+
+    Apply();
+    ASSERT_EQ(1ull, log.meshCalls.size());
+    const auto& call = log.meshCalls.front();
+    EXPECT_EQ(MabUpdateAction::Initialize, call.action);
+    ASSERT_EQ(4ull, call.vertices.size());
+    EXPECT_EQ(3.0f, call.vertices[0].position.x);
+    EXPECT_EQ(9.0f, call.vertices[1].position.x);
+    EXPECT_EQ((std::vector<uint32_t>{0u, 7u, 2u, 3u}), call.indices);
+}
+
+TEST_F(AssetUpdateQueueTests, Apply_preservesLoadAndUnloadOrder)
+{
+    const auto loaded = std::vector{MakeTexture(1u), MakeTexture(2u)};
+    uut.Push(nc::asset::TextureUpdateEventData{nc::asset::UpdateAction::Load, loaded});
+    uut.Push(nc::asset::TextureUpdateEventData{nc::asset::UpdateAction::Unload, {}});
+    uut.Push(nc::asset::TextureUpdateEventData{nc::asset::UpdateAction::UnloadAll, {}});
+    uut.Push(nc::asset::TextureUpdateEventData{nc::asset::UpdateAction::Load, std::vector{MakeTexture(3u)}});
+    uut.Push(nc::asset::CubeMapUpdateEventData{nc::asset::UpdateAction::UnloadAll, {}});
+
+    Apply();
+    EXPECT_EQ((std::vector{TabUpdateAction::Add, TabUpdateAction::Remove, TabUpdateAction::Clear, TabUpdateAction::Add}), log.textureActions);
+    EXPECT_EQ((std::vector<size_t>{1u, 2u, 3u}), log.textureIds);
+    EXPECT_EQ(std::vector{CabUpdateAction::Clear}, log.cubeMapActions);
+
+    // Everything was consumed, so nothing is forwarded again
+    Apply();
+    EXPECT_EQ(4ull, log.textureActions.size());
+    EXPECT_TRUE(log.meshCalls.empty());
+}
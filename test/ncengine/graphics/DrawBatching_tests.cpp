@@ -0,0 +1,86 @@
+#include "gtest/gtest.h"
+#include "graphics/system/DrawBatching.h"
+
+#include <algorithm>
+#include <random>
+
+using namespace nc::graphics;
+
+namespace
+{
+auto MakeMesh(uint32_t firstVertex, uint32_t firstIndex = 0u) -> nc::asset::MeshView
+{
+    return nc::asset::MeshView{.id = firstVertex, .firstVertex = firstVertex, .vertexCount = 3u, .firstIndex = firstIndex, .indexCount = 3u, .maxExtent = 1.0f};
+}
+} // anonymous namespace
+
+TEST(DrawBatchingTests, MakeDrawKey_ordersByMeshThenMaterial)
+{
+    EXPECT_LT(MakeDrawKey(MakeMesh(1u), 9u), MakeDrawKey(MakeMesh(2u), 0u));
+    EXPECT_LT(MakeDrawKey(MakeMesh(1u), 0u), MakeDrawKey(MakeMesh(1u), 1u));
+}
+
+TEST(DrawBatchingTests, RadixSort_emptyAndSingle_unchanged)
+{
+    auto keys = std::vector<DrawKey>{};
+    auto scratch = std::vector<DrawKey>{};
+    RadixSort(keys, scratch);
+    EXPECT_TRUE(keys.empty());
+
+    keys.push_back(DrawKey{42ull, 7u});
+    RadixSort(keys, scratch);
+    ASSERT_EQ(1ull, keys.size());
+    EXPECT_EQ(42ull, keys[0].key);
+    EXPECT_EQ(7u, keys[0].object);
+}
+
+TEST(DrawBatchingTests, RadixSort_matchesStableSort)
+{
+    auto rng = std::mt19937_64{3u};
+    for (auto distinct : {1ull, 2ull, 30ull, 1ull << 40})
+    {
+        auto keys = std::vector<DrawKey>(5000);
+        for (auto i = 0u; i < keys.size(); ++i)
+        {
+            keys[i] = DrawKey{rng() % distinct * 0x0101'0101'0101ull, i};
+        }
+
+        auto expected = keys;
+        std::ranges::stable_sort(expected, {}, &DrawKey::key);
+        auto scratch = std::vector<DrawKey>{};
+        RadixSort(keys, scratch);
+        for (auto i = 0u; i < keys.size(); ++i)
+        {
+            ASSERT_EQ(expected[i].key, keys[i].key);
+            ASSERT_EQ(expected[i].object, keys[i].object);
+        }
+    }
+}
+
+TEST(DrawBatchingTests, AppendInstance_groupsConsecutiveSameMesh)
+{
+    auto batches = std::vector<DrawBatch>{};
+    AppendInstance(batches, MakeMesh(0u), 0u);
+    AppendInstance(batches, MakeMesh(0u), 1u);
+    AppendInstance(batches, MakeMesh(10u, 3u), 2u);
+    AppendInstance(batches, MakeMesh(10u, 3u), 3u);
+    AppendInstance(batches, MakeMesh(10u, 3u), 4u);
+    AppendInstance(batches, MakeMesh(0u), 5u);
+
+    ASSERT_EQ(3ull, batches.size());
+    EXPECT_EQ(0u, batches[0].firstInstance);
+    EXPECT_EQ(2u, batches[0].instanceCount);
+    EXPECT_EQ(2u, batches[1].firstInstance);
+    EXPECT_EQ(3u, batches[1].instanceCount);
+    EXPECT_EQ(10u, batches[1].mesh.firstVertex);
+    EXPECT_EQ(5u, batches[2].firstInstance);
+    EXPECT_EQ(1u, batches[2].instanceCount);
+}
+
+TEST(DrawBatchingTests, AppendInstance_gapInInstances_startsNewBatch)
+{
+    auto batches = std::vector<DrawBatch>{};
+    AppendInstance(batches, MakeMesh(0u), 0u);
+    AppendInstance(batches, MakeMesh(0u), 2u);
+    EXPECT_EQ(2ull, batches.size());
+}
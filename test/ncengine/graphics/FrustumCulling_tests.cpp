@@ -0,0 +1,87 @@
+#include "gtest/gtest.h"
+#include "graphics/system/FrustumCulling.h"
+
+#include <array>
+#include <limits>
+
+using namespace nc::graphics;
+
+namespace
+{
+// Axis aligned box spanning [-10, 10] on each axis, with normals pointing inward
+const auto g_frustum = nc::Frustum
+{
+    .left   = nc::Plane{nc::Vector3{ 1.0f,  0.0f,  0.0f}, -10.0f},
+    .right  = nc::Plane{nc::Vector3{-1.0f,  0.0f,  0.0f}, -10.0f},
+    .bottom = nc::Plane{nc::Vector3{ 0.0f,  1.0f,  0.0f}, -10.0f},
+    .top    = nc::Plane{nc::Vector3{ 0.0f, -1.0f,  0.0f}, -10.0f},
+    .front  = nc::Plane{nc::Vector3{ 0.0f,  0.0f,  1.0f}, -10.0f},
+    .back   = nc::Plane{nc::Vector3{ 0.0f,  0.0f, -1.0f}, -10.0f}
+};
+
+auto Translation(float x, float y, float z) -> DirectX::XMMATRIX
+{
+    return DirectX::XMMatrixTranslation(x, y, z);
+}
+} // anonymous namespace
+
+TEST(FrustumCullingTests, Resize_setsSize)
+{
+    auto uut = BoundingSphereCache{};
+    uut.Resize(5);
+    EXPECT_EQ(5ull, uut.Size());
+    uut.Resize(2);
+    EXPECT_EQ(2ull, uut.Size());
+}
+
+TEST(FrustumCullingTests, Update_newRevision_recomputesSphere)
+{
+    auto uut = BoundingSphereCache{};
+    uut.Resize(1);
+    EXPECT_TRUE(uut.Update(0, 1, 2.0f, DirectX::XMMatrixScaling(3.0f, 1.0f, 1.0f) * Translation(1.0f, 2.0f, 3.0f)));
+    auto sphere = uut.GetSphere(0);
+    EXPECT_FLOAT_EQ(1.0f, sphere.center.x);
+    EXPECT_FLOAT_EQ(2.0f, sphere.center.y);
+    EXPECT_FLOAT_EQ(3.0f, sphere.center.z);
+    EXPECT_FLOAT_EQ(6.0f, sphere.radius);
+
+    EXPECT_TRUE(uut.Update(0, 2, 2.0f, Translation(4.0f, 5.0f, 6.0f)));
+    sphere = uut.GetSphere(0);
+    EXPECT_FLOAT_EQ(4.0f, sphere.center.x);
+    EXPECT_FLOAT_EQ(2.0f, sphere.radius);
+}
+
+TEST(FrustumCullingTests, Update_sameRevisionAndExtent_keepsCachedSphere)
+{
+    auto uut = BoundingSphereCache{};
+    uut.Resize(1);
+    EXPECT_TRUE(uut.Update(0, 1, 1.0f, Translation(1.0f, 0.0f, 0.0f)));
+    EXPECT_FALSE(uut.Update(0, 1, 1.0f, Translation(9.0f, 0.0f, 0.0f)));
+    EXPECT_FLOAT_EQ(1.0f, uut.GetSphere(0).center.x);
+
+    EXPECT_TRUE(uut.Update(0, 1, 4.0f, Translation(9.0f, 0.0f, 0.0f)));
+    EXPECT_FLOAT_EQ(9.0f, uut.GetSphere(0).center.x);
+    EXPECT_FLOAT_EQ(4.0f, uut.GetSphere(0).radius);
+}
+
+TEST(FrustumCullingTests, CullSpheres_classifiesSpheres)
+{
+    // inside, outside right, straddles top, outside front, inside (second lane group), then padding
+    const auto x      = std::array<float, 8>{0.0f, 20.0f,  0.0f,   0.0f, -5.0f, 0.0f, 0.0f, 0.0f};
+    const auto y      = std::array<float, 8>{0.0f,  0.0f, 11.0f,   0.0f,  5.0f, 0.0f, 0.0f, 0.0f};
+    const auto z      = std::array<float, 8>{0.0f,  0.0f,  0.0f, -12.0f,  5.0f, 0.0f, 0.0f, 0.0f};
+    constexpr auto pad = std::numeric_limits<float>::lowest();
+    const auto radius = std::array<float, 8>{1.0f,  1.0f,  2.0f,   1.0f,  1.0f,  pad,   pad,   pad};
+
+    auto visible = std::array<uint8_t, 8>{};
+    visible.fill(0xFF);
+    CullSpheres(BuildCullingFrustum(g_frustum), x.data(), y.data(), z.data(), radius.data(), visible.size(), visible.data());
+    EXPECT_EQ(1, visible[0]);
+    EXPECT_EQ(0, visible[1]);
+    EXPECT_EQ(1, visible[2]);
+    EXPECT_EQ(0, visible[3]);
+    EXPECT_EQ(1, visible[4]);
+    EXPECT_EQ(0, visible[5]);
+    EXPECT_EQ(0, visible[6]);
+    EXPECT_EQ(0, visible[7]);
+}
@@ -0,0 +1,175 @@
+#include "gtest/gtest.h"
+#include "graphics/system/SphereBvh.h"
+
+#include <algorithm>
+#include <random>
+
+using namespace nc;
+using namespace nc::graphics;
+
+namespace
+{
+auto MakeFrustum(float offsetX, float offsetY) -> Frustum
+{
+    return Frustum
+    {
+        .left   = Plane{Vector3{ 1.0f,  0.0f,  0.0f}, offsetX - 30.0f},
+        .right  = Plane{Vector3{-1.0f,  0.0f,  0.0f}, -(offsetX + 30.0f)},
+        .bottom = Plane{Vector3{ 0.0f,  1.0f,  0.0f}, offsetY - 20.0f},
+        .top    = Plane{Vector3{ 0.0f, -1.0f,  0.0f}, -(offsetY + 20.0f)},
+        .front  = Plane{Vector3{ 0.0f,  0.0f,  1.0f}, -50.0f},
+        .back   = Plane{Vector3{ 0.0f,  0.0f, -1.0f}, -10.0f}
+    };
+}
+
+auto IsVisible(const Frustum& frustum, const Sphere& sphere) -> bool
+{
+    for (const auto& plane : {frustum.front, frustum.left, frustum.right, frustum.top, frustum.bottom, frustum.back})
+    {
+        if (Dot(plane.normal, sphere.center) - plane.d + sphere.radius < 0.0f)
+            return false;
+    }
+
+    return true;
+}
+
+auto Overlaps(const Sphere& a, const Sphere& b) -> bool
+{
+    const auto r = a.radius + b.radius;
+    return SquareDistance(a.center, b.center) <= r * r;
+}
+
+class SphereBvhTests : public ::testing::Test
+{
+    public:
+        std::mt19937 rng{7u};
+        std::uniform_real_distribution<float> position{-100.0f, 100.0f};
+        std::uniform_real_distribution<float> radius{0.1f, 5.0f};
+
+        auto MakeSpheres(size_t count) -> std::vector<Sphere>
+        {
+            auto out = std::vector<Sphere>(count);
+            std::ranges::generate(out, [&]() { return Sphere{Vector3{position(rng), position(rng), position(rng)}, radius(rng)}; });
+            return out;
+        }
+
+        static auto MakeIds(size_t count, uint32_t first = 0u) -> std::vector<uint32_t>
+        {
+            auto out = std::vector<uint32_t>(count);
+            for (auto i = 0u; i < count; ++i)
+                out[i] = first + i;
+
+            return out;
+        }
+
+        void ExpectMatchesBruteForce(const SphereBvh& uut, const std::vector<Sphere>& spheres)
+        {
+            const auto frustum = MakeFrustum(position(rng) * 0.5f, position(rng) * 0.5f);
+            auto visible = std::vector<uint8_t>(spheres.size(), 0);
+            uut.Query(frustum, visible.data());
+            for (auto i = 0u; i < spheres.size(); ++i)
+            {
+                EXPECT_EQ(IsVisible(frustum, spheres[i]), visible[i] == 1) << "sphere " << i;
+            }
+
+            const auto volume = Sphere{Vector3{position(rng), position(rng), position(rng)}, 30.0f};
+            auto hits = std::vector<uint32_t>{};
+            uut.Query(volume, hits);
+            std::ranges::sort(hits);
+            auto expected = std::vector<uint32_t>{};
+            for (auto i = 0u; i < spheres.size(); ++i)
+            {
+                if (Overlaps(volume, spheres[i]))
+                    expected.push_back(i);
+            }
+
+            EXPECT_EQ(expected, hits);
+        }
+};
+} // anonymous namespace
+
+TEST_F(SphereBvhTests, Build_empty_queriesReturnNothing)
+{
+    auto uut = SphereBvh{};
+    uut.Build({}, {});
+    EXPECT_EQ(0ull, uut.ItemCount());
+    EXPECT_EQ(0ull, uut.NodeCount());
+
+    auto hits = std::vector<uint32_t>{};
+    uut.Query(Sphere{Vector3::Zero(), 100.0f}, hits);
+    EXPECT_TRUE(hits.empty());
+}
+
+TEST_F(SphereBvhTests, Build_singleLeaf_hasOneNode)
+{
+    const auto spheres = MakeSpheres(SphereBvh::LeafSize);
+    auto uut = SphereBvh{};
+    uut.Build(spheres, MakeIds(spheres.size()));
+    EXPECT_EQ(spheres.size(), uut.ItemCount());
+    EXPECT_EQ(1ull, uut.NodeCount());
+}
+
+TEST_F(SphereBvhTests, Query_matchesBruteForce)
+{
+    for (auto count : {1ull, 3ull, 17ull, 250ull, 1000ull})
+    {
+        const auto spheres = MakeSpheres(count);
+        auto uut = SphereBvh{};
+        uut.Build(spheres, MakeIds(count));
+        for (auto i = 0; i < 4; ++i)
+        {
+            ExpectMatchesBruteForce(uut, spheres);
+        }
+    }
+}
+
+TEST_F(SphereBvhTests, Query_reportsIds)
+{
+    const auto spheres = std::vector<Sphere>{
+        Sphere{Vector3{0.0f, 0.0f, 0.0f}, 1.0f},
+        Sphere{Vector3{500.0f, 0.0f, 0.0f}, 1.0f}
+    };
+
+    const auto ids = MakeIds(spheres.size(), 3u);
+    auto uut = SphereBvh{};
+    uut.Build(spheres, ids);
+
+    auto visible = std::vector<uint8_t>(5, 0);
+    uut.Query(MakeFrustum(0.0f, 0.0f), visible.data());
+    EXPECT_EQ((std::vector<uint8_t>{0, 0, 0, 1, 0}), visible);
+
+    auto hits = std::vector<uint32_t>{};
+    uut.Query(Sphere{Vector3{498.0f, 0.0f, 0.0f}, 1.0f}, hits);
+    EXPECT_EQ(std::vector<uint32_t>{4u}, hits);
+}
+
+TEST_F(SphereBvhTests, Refit_movedSpheres_matchesBruteForce)
+{
+    auto spheres = MakeSpheres(500);
+    auto uut = SphereBvh{};
+    uut.Build(spheres, MakeIds(spheres.size()));
+    for (auto& sphere : spheres)
+    {
+        sphere.center.x += position(rng) * 0.3f;
+        sphere.radius *= 2.0f;
+    }
+
+    uut.Refit(spheres);
+    for (auto i = 0; i < 4; ++i)
+    {
+        ExpectMatchesBruteForce(uut, spheres);
+    }
+}
+
+TEST_F(SphereBvhTests, Clear_removesItems)
+{
+    const auto spheres = MakeSpheres(100);
+    auto uut = SphereBvh{};
+    uut.Build(spheres, MakeIds(spheres.size()));
+    uut.Clear();
+    EXPECT_EQ(0ull, uut.ItemCount());
+
+    auto hits = std::vector<uint32_t>{};
+    uut.Query(Sphere{Vector3::Zero(), 1000.0f}, hits);
+    EXPECT_TRUE(hits.empty());
+}
@@ -0,0 +1,164 @@
+#include "gtest/gtest.h"
+#include "particle/EmitterState.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+constexpr auto g_tolerance = 0.0001f;
+
+auto MakeInfo(unsigned initialCount) -> nc::graphics::ParticleInfo
+{
+    auto info = nc::graphics::ParticleInfo{};
+    info.emission.maxParticleCount = 10u;
+    info.emission.initialEmissionCount = initialCount;
+    info.init.lifetime = 10.0f;
+    return info;
+}
+
+auto GetX(const DirectX::XMMATRIX& matrix) -> float
+{
+    return DirectX::XMVectorGetX(matrix.r[3]);
+}
+
+void ExpectNear(const nc::Vector3& expected, DirectX::FXMVECTOR actual)
+{
+    EXPECT_NEAR(expected.x, DirectX::XMVectorGetX(actual), g_tolerance);
+    EXPECT_NEAR(expected.y, DirectX::XMVectorGetY(actual), g_tolerance);
+    EXPECT_NEAR(expected.z, DirectX::XMVectorGetZ(actual), g_tolerance);
+}
+} // anonymous namespace
+
+class EmitterStateTests : public ::testing::Test
+{
+    public:
+        static constexpr size_t registryCapacity = 10ull;
+        nc::ecs::ComponentRegistry registry;
+        nc::Random random{1ull};
+        nc::Entity nextEntity = nc::Entity{0, 0, 0};
+
+        EmitterStateTests()
+            : registry{registryCapacity}
+        {
+            registry.RegisterType<nc::Transform>(registryCapacity);
+        }
+
+        auto CreateEmitter(const nc::Vector3& position, const nc::graphics::ParticleInfo& info) -> nc::particle::EmitterState
+        {
+            const auto entity = nextEntity;
+            nextEntity = nc::Entity{entity.Index() + 1, 0, 0};
+            registry.GetPool<nc::Transform>().Emplace(entity, position, nc::Quaternion::Identity(), nc::Vector3::One());
+            registry.CommitPendingChanges();
+            return nc::particle::EmitterState{nc::ecs::ExplicitEcs<nc::Transform>{registry}, entity, info, random.Fork()};
+        }
+};
+
+TEST_F(EmitterStateTests, Update_oneStep_integratesKinematics)
+{
+    auto info = MakeInfo(2u);
+    info.init.scaleMin = 2.0f;
+    info.init.scaleMax = 2.0f;
+    info.kinematic.velocityMin = nc::Vector3{1.0f, 2.0f, -4.0f};
+    info.kinematic.velocityMax = nc::Vector3{1.0f, 2.0f, -4.0f};
+    info.kinematic.velocityOverTimeFactor = 0.5f;
+    info.kinematic.rotationMin = 2.0f;
+    info.kinematic.rotationMax = 2.0f;
+    info.kinematic.scaleOverTimeFactor = 4.0f;
+    auto uut = CreateEmitter(nc::Vector3{1.0f, 0.0f, 0.0f}, info);
+
+    // velocity and scale are scaled before integrating: v' = v * (1 + 0.5 * 0.5), s' = s * (1 + 4 * 0.5^2)
+    uut.Update(0.5f, DirectX::XMMatrixIdentity());
+    const auto& matrices = uut.GetMatrices();
+    ASSERT_EQ(2ull, matrices.size());
+    const auto rotation = 1.0f;
+    const auto scale = 4.0f;
+    for (const auto& matrix : matrices)
+    {
+        ExpectNear(nc::Vector3{1.625f, 1.25f, -2.5f}, matrix.r[3]);
+        ExpectNear(nc::Vector3{scale * std::cos(rotation), scale * std::sin(rotation), 0.0f}, matrix.r[0]);
+        ExpectNear(nc::Vector3{-scale * std::sin(rotation), scale * std::cos(rotation), 0.0f}, matrix.r[1]);
+        ExpectNear(nc::Vector3{0.0f, 0.0f, scale}, matrix.r[2]);
+    }
+}
+
+TEST_F(EmitterStateTests, Update_partialBatch_computesAllMatrices)
+{
+    // Matrices are built four particles at a time, so cover a full batch plus a partial one
+    auto info = MakeInfo(6u);
+    info.kinematic.velocityMin = nc::Vector3{0.0f, 1.0f, 0.0f};
+    info.kinematic.velocityMax = nc::Vector3{0.0f, 1.0f, 0.0f};
+    auto uut = CreateEmitter(nc::Vector3{0.0f, 0.0f, 3.0f}, info);
+
+    uut.Update(1.0f, DirectX::XMMatrixIdentity());
+    const auto& matrices = uut.GetMatrices();
+    ASSERT_EQ(6ull, matrices.size());
+    for (const auto& matrix : matrices)
+    {
+        ExpectNear(nc::Vector3{0.0f, 1.0f, 3.0f}, matrix.r[3]);
+        ExpectNear(nc::Vector3{1.0f, 0.0f, 0.0f}, matrix.r[0]);
+    }
+}
+
+TEST_F(EmitterStateTests, Update_expiredParticles_removedWithoutLosingLiveOnes)
+{
+    // Emit long, short, and long lived particles at distinct offsets so expired ones end up between live ones
+    auto info = MakeInfo(3u);
+    info.init.positionMin = info.init.positionMax = nc::Vector3{1.0f, 0.0f, 0.0f};
+    auto uut = CreateEmitter(nc::Vector3::Zero(), info);
+
+    info.init.lifetime = 0.5f;
+    info.init.positionMin = info.init.positionMax = nc::Vector3{2.0f, 0.0f, 0.0f};
+    uut.UpdateInfo(info);
+    uut.Emit(4u);
+
+    info.init.lifetime = 10.0f;
+    info.init.positionMin = info.init.positionMax = nc::Vector3{3.0f, 0.0f, 0.0f};
+    uut.UpdateInfo(info);
+    uut.Emit(2u);
+
+    uut.Update(1.0f, DirectX::XMMatrixIdentity());
+    const auto& matrices = uut.GetMatrices();
+    ASSERT_EQ(5ull, matrices.size());
+    EXPECT_EQ(3, std::ranges::count_if(matrices, [](const auto& m) { return GetX(m) == 1.0f; }));
+    EXPECT_EQ(2, std::ranges::count_if(matrices, [](const auto& m) { return GetX(m) == 3.0f; }));
+
+    // Live particles keep aging and expire later
+    uut.Update(9.5f, DirectX::XMMatrixIdentity());
+    EXPECT_TRUE(uut.GetMatrices().empty());
+}
+
+TEST_F(EmitterStateTests, Emit_exceedsCapacity_clampsToMaxParticleCount)
+{
+    auto uut = CreateEmitter(nc::Vector3::Zero(), MakeInfo(8u));
+    uut.Emit(5u);
+    uut.Update(0.1f, DirectX::XMMatrixIdentity());
+    EXPECT_EQ(10ull, uut.GetMatrices().size());
+}
+
+TEST_F(EmitterStateTests, SortBackToFront_ordersByDistanceFromCamera)
+{
+    // Distances form a permutation with multiple cycles
+    const auto distances = std::array{2.0f, 5.0f, 1.0f, 4.0f, 3.0f, 6.0f};
+    auto emitters = std::vector<nc::particle::EmitterState>{};
+    for (auto distance : distances)
+    {
+        emitters.push_back(CreateEmitter(nc::Vector3{0.0f, 0.0f, 10.0f + distance}, MakeInfo(0u)));
+    }
+
+    nc::particle::SortBackToFront(emitters, DirectX::XMVectorSet(0.0f, 0.0f, 10.0f, 1.0f));
+    auto actual = std::vector<uint32_t>{};
+    for (const auto& emitter : emitters)
+    {
+        actual.push_back(emitter.GetEntity().Index());
+    }
+
+    EXPECT_EQ((std::vector<uint32_t>{5u, 1u, 3u, 4u, 0u, 2u}), actual);
+
+    // Already sorted emitters are left in place
+    nc::particle::SortBackToFront(emitters, DirectX::XMVectorSet(0.0f, 0.0f, 10.0f, 1.0f));
+    EXPECT_EQ(5u, emitters.front().GetEntity().Index());
+    EXPECT_EQ(2u, emitters.back().GetEntity().Index());
+}
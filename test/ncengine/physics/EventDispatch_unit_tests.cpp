@@ -0,0 +1,282 @@
+#include "gtest/gtest.h"
+#include "physics/EventDispatch.h"
+#include "physics/jolt/ContactListener.h"
+#include "ncengine/ecs/Ecs.h"
+#include "ncengine/physics/CollisionListener.h"
+
+#include <array>
+#include <vector>
+
+namespace
+{
+enum class Callback
+{
+    Enter,
+    Exit,
+    TriggerEnter,
+    TriggerExit
+};
+
+struct Invocation
+{
+    Callback callback;
+    nc::Entity self;
+    nc::Entity other;
+    float depth = 0.0f;
+
+    auto operator==(const Invocation&) const -> bool = default;
+};
+
+auto MakeHit(float depth) -> nc::HitInfo
+{
+    return nc::HitInfo{
+        nc::Vector3::Zero(),
+        nc::Vector3::Up(),
+        depth,
+        nc::Contacts{std::array<nc::Vector3, 4>{}, 0},
+        nc::Contacts{std::array<nc::Vector3, 4>{}, 0}
+    };
+}
+
+auto MakePair(uint64_t hash, nc::Entity first, nc::Entity second) -> nc::physics::OverlappingPair
+{
+    return nc::physics::OverlappingPair{hash, first, second};
+}
+
+auto MakeCollision(uint64_t hash, nc::Entity first, nc::Entity second, float depth = 0.0f) -> nc::physics::CollisionPair
+{
+    return nc::physics::CollisionPair{MakePair(hash, first, second), MakeHit(depth)};
+}
+} // anonymous namespace
+
+class EventDispatchTests : public ::testing::Test
+{
+    public:
+        static constexpr size_t registryCapacity = 10ull;
+        nc::ecs::ComponentRegistry registry;
+        std::vector<Invocation> invocations;
+        nc::Entity e0 = nc::Entity{0, 0, nc::Entity::Flags::None};
+        nc::Entity e1 = nc::Entity{1, 0, nc::Entity::Flags::None};
+        nc::Entity e2 = nc::Entity{2, 0, nc::Entity::Flags::None};
+        nc::Entity silent = nc::Entity{3, 0, nc::Entity::Flags::NoCollisionNotifications};
+
+        EventDispatchTests()
+            : registry{registryCapacity}
+        {
+            registry.RegisterType<nc::CollisionListener>(registryCapacity);
+            for (auto entity : {e0, e1, e2, silent})
+            {
+                AddListener(entity);
+            }
+
+            registry.CommitPendingChanges();
+        }
+
+        void AddListener(nc::Entity entity)
+        {
+            registry.GetPool<nc::CollisionListener>().Emplace(
+                entity,
+                [this](nc::Entity self, nc::Entity other, const nc::HitInfo& hit, nc::ecs::Ecs)
+                {
+                    invocations.emplace_back(Callback::Enter, self, other, hit.depth);
+                },
+                [this](nc::Entity self, nc::Entity other, nc::ecs::Ecs)
+                {
+                    invocations.emplace_back(Callback::Exit, self, other);
+                },
+                [this](nc::Entity self, nc::Entity other, nc::ecs::Ecs)
+                {
+                    invocations.emplace_back(Callback::TriggerEnter, self, other);
+                },
+                [this](nc::Entity self, nc::Entity other, nc::ecs::Ecs)
+                {
+                    invocations.emplace_back(Callback::TriggerExit, self, other);
+                }
+            );
+        }
+
+        void Dispatch(const nc::physics::ContactBuffer& events, bool groupByEntity)
+        {
+            invocations.clear();
+            nc::physics::DispatchPhysicsEvents(events, nc::ecs::Ecs{registry}, groupByEntity);
+        }
+};
+
+TEST_F(EventDispatchTests, DispatchPhysicsEvents_ungrouped_deliversInPairOrder)
+{
+    auto events = nc::physics::ContactBuffer{};
+    events.enteredCollisions.push_back(MakeCollision(1ull, e0, e1, 0.5f));
+    events.exitedCollisions.push_back(MakePair(2ull, e2, e0));
+
+    Dispatch(events, false);
+    const auto expected = std::vector<Invocation>{
+        {Callback::Enter, e0, e1, 0.5f},
+        {Callback::Enter, e1, e0, 0.5f},
+        {Callback::Exit, e2, e0},
+        {Callback::Exit, e0, e2}
+    };
+
+    EXPECT_EQ(expected, invocations);
+}
+
+TEST_F(EventDispatchTests, DispatchPhysicsEvents_grouped_deliversEachEntityContiguously)
+{
+    auto events = nc::physics::ContactBuffer{};
+    events.enteredCollisions.push_back(MakeCollision(1ull, e2, e0, 0.5f));
+    events.enteredTriggers.push_back(MakePair(2ull, e1, e2));
+    events.exitedCollisions.push_back(MakePair(3ull, e0, e1));
+    events.exitedTriggers.push_back(MakePair(4ull, e2, e1));
+
+    Dispatch(events, true);
+    const auto expected = std::vector<Invocation>{
+        {Callback::Enter, e0, e2, 0.5f},
+        {Callback::Exit, e0, e1},
+        {Callback::TriggerEnter, e1, e2},
+        {Callback::Exit, e1, e0},
+        {Callback::TriggerExit, e1, e2},
+        {Callback::Enter, e2, e0, 0.5f},
+        {Callback::TriggerEnter, e2, e1},
+        {Callback::TriggerExit, e2, e1}
+    };
+
+    EXPECT_EQ(expected, invocations);
+}
+
+TEST_F(EventDispatchTests, DispatchPhysicsEvents_grouped_ordersOthersWithinEventType)
+{
+    auto events = nc::physics::ContactBuffer{};
+    events.enteredCollisions.push_back(MakeCollision(1ull, e0, e2, 0.2f));
+    events.enteredCollisions.push_back(MakeCollision(2ull, e1, e0, 0.1f));
+
+    Dispatch(events, true);
+    const auto expected = std::vector<Invocation>{
+        {Callback::Enter, e0, e1, 0.1f},
+        {Callback::Enter, e0, e2, 0.2f},
+        {Callback::Enter, e1, e0, 0.1f},
+        {Callback::Enter, e2, e0, 0.2f}
+    };
+
+    EXPECT_EQ(expected, invocations);
+}
+
+TEST_F(EventDispatchTests, DispatchPhysicsEvents_grouped_dropsRepeatedEvents)
+{
+    // Sub-shape pairs of the same bodies have distinct hashes but describe the same event to listeners. The first
+    // recorded hit is kept.
+    auto events = nc::physics::ContactBuffer{};
+    events.enteredCollisions.push_back(MakeCollision(1ull, e0, e1, 0.1f));
+    events.enteredCollisions.push_back(MakeCollision(2ull, e1, e0, 0.2f));
+    events.enteredTriggers.push_back(MakePair(3ull, e0, e2));
+    events.enteredTriggers.push_back(MakePair(4ull, e0, e2));
+    events.exitedTriggers.push_back(MakePair(5ull, e2, e0));
+    events.exitedTriggers.push_back(MakePair(6ull, e0, e2));
+
+    Dispatch(events, true);
+    const auto expected = std::vector<Invocation>{
+        {Callback::Enter, e0, e1, 0.1f},
+        {Callback::TriggerEnter, e0, e2},
+        {Callback::TriggerExit, e0, e2},
+        {Callback::Enter, e1, e0, 0.1f},
+        {Callback::TriggerEnter, e2, e0},
+        {Callback::TriggerExit, e2, e0}
+    };
+
+    EXPECT_EQ(expected, invocations);
+}
+
+TEST_F(EventDispatchTests, DispatchPhysicsEvents_grouped_keepsEnterAndExitForSamePair)
+{
+    // An object passing through another within a frame reports both, which must not be collapsed
+    auto events = nc::physics::ContactBuffer{};
+    events.enteredCollisions.push_back(MakeCollision(1ull, e0, e1));
+    events.exitedCollisions.push_back(MakePair(1ull, e0, e1));
+
+    Dispatch(events, true);
+    const auto expected = std::vector<Invocation>{
+        {Callback::Enter, e0, e1},
+        {Callback::Exit, e0, e1},
+        {Callback::Enter, e1, e0},
+        {Callback::Exit, e1, e0}
+    };
+
+    EXPECT_EQ(expected, invocations);
+}
+
+TEST_F(EventDispatchTests, DispatchPhysicsEvents_entityWithoutNotifications_skipped)
+{
+    auto events = nc::physics::ContactBuffer{};
+    events.enteredCollisions.push_back(MakeCollision(1ull, e0, silent));
+    events.exitedTriggers.push_back(MakePair(2ull, silent, e1));
+
+    for (auto grouped : {false, true})
+    {
+        Dispatch(events, grouped);
+        const auto expected = std::vector<Invocation>{
+            {Callback::Enter, e0, silent},
+            {Callback::TriggerExit, e1, silent}
+        };
+
+        EXPECT_EQ(expected, invocations);
+    }
+}
+
+TEST_F(EventDispatchTests, MergeContactBuffers_perThreadBuffers_matchesSingleBuffer)
+{
+    auto record = [&](nc::physics::ContactBuffer& buffer, uint64_t hash)
+    {
+        const auto first = nc::Entity{static_cast<uint32_t>(hash % 3u), 0, nc::Entity::Flags::None};
+        const auto second = nc::Entity{static_cast<uint32_t>((hash + 1u) % 3u), 0, nc::Entity::Flags::None};
+        buffer.enteredCollisions.push_back(MakeCollision(hash, first, second, static_cast<float>(hash)));
+        buffer.enteredTriggers.push_back(MakePair(hash + 100u, second, first));
+        buffer.exitedCollisions.push_back(MakePair(hash + 200u, first, second));
+        buffer.exitedTriggers.push_back(MakePair(hash + 300u, second, first));
+    };
+
+    // Contacts are reported in an arbitrary order and spread unevenly across threads
+    const auto hashes = std::array{7ull, 3ull, 9ull, 1ull, 4ull, 8ull, 2ull, 6ull, 5ull};
+    auto single = nc::physics::ContactBuffer{};
+    auto threads = std::array<nc::physics::ContactBuffer, 3>{};
+    for (auto i = 0u; i < hashes.size(); ++i)
+    {
+        record(single, hashes[i]);
+        record(threads[(i * i) % threads.size()], hashes[i]);
+    }
+
+    auto expected = nc::physics::ContactBuffer{};
+    auto singleBuffers = std::array{&single};
+    nc::physics::MergeContactBuffers(singleBuffers, expected);
+
+    auto actual = nc::physics::ContactBuffer{};
+    auto threadBuffers = std::array{&threads[2], &threads[0], &threads[1]};
+    nc::physics::MergeContactBuffers(threadBuffers, actual);
+
+    const auto hashOf = [](const auto& pairs)
+    {
+        auto out = std::vector<uint64_t>{};
+        for (const auto& pair : pairs)
+            out.push_back(pair.hash);
+
+        return out;
+    };
+
+    EXPECT_EQ((std::vector<uint64_t>{101u, 102u, 103u, 104u, 105u, 106u, 107u, 108u, 109u}), hashOf(actual.enteredTriggers));
+    EXPECT_EQ(hashOf(expected.enteredTriggers), hashOf(actual.enteredTriggers));
+    EXPECT_EQ(hashOf(expected.exitedCollisions), hashOf(actual.exitedCollisions));
+    EXPECT_EQ(hashOf(expected.exitedTriggers), hashOf(actual.exitedTriggers));
+    ASSERT_EQ(expected.enteredCollisions.size(), actual.enteredCollisions.size());
+    for (auto i = 0u; i < actual.enteredCollisions.size(); ++i)
+    {
+        EXPECT_EQ(expected.enteredCollisions[i].pair.hash, actual.enteredCollisions[i].pair.hash);
+        EXPECT_EQ(expected.enteredCollisions[i].hit.depth, actual.enteredCollisions[i].hit.depth);
+    }
+
+    EXPECT_TRUE(single.enteredCollisions.empty());
+    EXPECT_TRUE(threads[0].exitedTriggers.empty());
+
+    // Listeners observe the same callbacks either way
+    Dispatch(expected, true);
+    const auto singleInvocations = invocations;
+    Dispatch(actual, true);
+    EXPECT_EQ(singleInvocations, invocations);
+    EXPECT_EQ(24ull, invocations.size());
+}
@@ -39,6 +39,7 @@ class ContactListenerTest : public ::testing::Test
         void Step()
         {
             joltApi.physicsSystem.Update(1.0f / 60.0f, 1, &joltApi.tempAllocator, joltApi.jobSystem.get());
+            uut.GatherContacts();
             lastOnEnter.clear();
             lastOnTriggerEnter.clear();
             lastOnExit.clear();
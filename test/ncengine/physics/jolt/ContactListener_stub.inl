@@ -2,6 +2,12 @@
 
 namespace nc::physics
 {
+ContactListener::ContactListener(JPH::PhysicsSystem& physicsSystem)
+    : m_physicsSystem{&physicsSystem},
+      m_epoch{0ull}
+{
+}
+
 void ContactListener::OnContactAdded(const JPH::Body&,
                                      const JPH::Body&,
                                      const JPH::ContactManifold&,
@@ -13,6 +19,10 @@ void ContactListener::OnContactRemoved(const JPH::SubShapeIDPair&)
 {
 }
 
+void ContactListener::GatherContacts()
+{
+}
+
 void ContactListener::CommitPendingChanges()
 {
 }
@@ -9,6 +9,16 @@
 #include <sstream>
 #include <ranges>
 
+// Ensure real AsyncDispatcher isn't also linked
+#ifdef _MSC_VER
+#pragma detect_mismatch("AsyncDispatcher", "Stub")
+#endif
+
+namespace nc::task
+{
+class AsyncDispatcher{};
+} // namespace nc::task
+
 namespace nc::asset
 {
 class NcAssetMock : public NcAsset
@@ -28,6 +38,16 @@ class NcAssetMock : public NcAsset
             m_assets.insert(std::cbegin(assets), std::cend(assets));
         }
 
+        auto LoadAssetsAsync(const AssetMap& assets) -> std::future<void> override
+        {
+            LoadAssets(assets);
+            auto promise = std::promise<void>{};
+            promise.set_value();
+            return promise.get_future();
+        }
+
+        void CommitPendingLoads() override {}
+
         auto GetLoadedAssets() const noexcept -> AssetMap override
         {
             return m_assets;
@@ -46,6 +66,7 @@ class NcAssetMock : public NcAsset
 
 auto BuildAssetModule(const config::AssetSettings&,
                       const config::MemorySettings&,
+                      const task::AsyncDispatcher&,
                       AssetMap) -> std::unique_ptr<NcAsset>
 {
     return std::make_unique<NcAssetMock>();
@@ -141,6 +162,7 @@ class SceneSerializationTests : public ::testing::Test
 
             moduleRegistry.Register(nc::asset::BuildAssetModule(nc::config::AssetSettings{},
                                                                 nc::config::MemorySettings{},
+                                                                nc::task::AsyncDispatcher{},
                                                                 nc::asset::AssetMap{}));
         }
 
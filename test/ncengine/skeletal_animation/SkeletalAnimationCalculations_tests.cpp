@@ -465,3 +465,160 @@ TEST_F(SkeletalAnimationCalculations_tests, ComposeBlendedMatrices_twoBonesHaveA
     EXPECT_EQ(matrices.hasValues[1], 1);
     EXPECT_EQ(matrices.hasValues[2], 0);
 }
+
+TEST_F(SkeletalAnimationCalculations_tests, CompileClip_resolvesBoneNamesToRigIndices)
+{
+    auto rig = graphics::anim::PackedRig{testData->bonesData};
+    auto clip = graphics::CompileClip(rig, testData->animation);
+    EXPECT_EQ(clip.boneCount, 3u);
+    EXPECT_EQ(clip.trackBones, (std::vector<uint32_t>{0u, 1u}));
+    EXPECT_EQ(clip.positions.keyOffsets, (std::vector<uint32_t>{0u, 3u, 6u}));
+    EXPECT_EQ(clip.rotations.keyOffsets, (std::vector<uint32_t>{0u, 3u, 6u}));
+    EXPECT_EQ(clip.scales.keyOffsets, (std::vector<uint32_t>{0u, 3u, 6u}));
+    EXPECT_EQ(clip.positions.times.size(), 6u);
+    EXPECT_EQ(clip.positions.values.size(), 6u);
+}
+
+TEST_F(SkeletalAnimationCalculations_tests, SampleClip_matchesGetAnimationOffsets)
+{
+    auto rig = graphics::anim::PackedRig{testData->bonesData};
+    auto clip = graphics::CompileClip(rig, testData->animation);
+    auto cursor = graphics::anim::ClipCursor{};
+    auto sample = graphics::anim::PackedAnimationDecomposed{};
+
+    for (auto time : {0.0f, 0.5f, 1.0f, 1.5f, 0.25f, 1.75f})
+    {
+        graphics::SampleClip(time, clip, cursor, sample);
+        const auto expected = graphics::GetAnimationOffsets(time, testData->boneNames, &testData->animation);
+        ASSERT_EQ(sample.hasValues, expected.hasValues);
+        for (auto i = 0u; i < 2u; ++i)
+        {
+            EXPECT_EQ(sample.offsets[i].pos, expected.offsets[i].pos);
+            EXPECT_EQ(sample.offsets[i].rot, expected.offsets[i].rot);
+            EXPECT_EQ(sample.offsets[i].scale, expected.offsets[i].scale);
+        }
+    }
+}
+
+TEST_F(SkeletalAnimationCalculations_tests, SampleClip_timeMovesBackwards_restartsCursor)
+{
+    auto rig = graphics::anim::PackedRig{testData->bonesData};
+    auto clip = graphics::CompileClip(rig, testData->animation);
+    auto cursor = graphics::anim::ClipCursor{};
+    auto sample = graphics::anim::PackedAnimationDecomposed{};
+
+    graphics::SampleClip(1.5f, clip, cursor, sample);
+    EXPECT_EQ(cursor.positions, (std::vector<uint32_t>{1u, 1u}));
+    EXPECT_FLOAT_EQ(sample.offsets[0].pos.x, 2.5f);
+
+    graphics::SampleClip(0.5f, clip, cursor, sample);
+    EXPECT_EQ(cursor.positions, (std::vector<uint32_t>{0u, 0u}));
+    EXPECT_FLOAT_EQ(sample.offsets[0].pos.x, 1.5f);
+}
+
+TEST_F(SkeletalAnimationCalculations_tests, SampleClip_pastLastKeyframe_holdsFinalValue)
+{
+    auto rig = graphics::anim::PackedRig{testData->bonesData};
+    auto clip = graphics::CompileClip(rig, testData->animation);
+    auto cursor = graphics::anim::ClipCursor{};
+    auto sample = graphics::anim::PackedAnimationDecomposed{};
+
+    graphics::SampleClip(5.0f, clip, cursor, sample);
+    EXPECT_FLOAT_EQ(sample.offsets[1].pos.x, 3.0f);
+    EXPECT_FLOAT_EQ(sample.offsets[1].scale.z, 3.0f);
+}
+
+TEST_F(SkeletalAnimationCalculations_tests, ComposeMatrices_reusedOutput_matchesFreshResult)
+{
+    auto rig = graphics::anim::PackedRig{testData->bonesData};
+    auto clip = graphics::CompileClip(rig, testData->animation);
+    auto cursor = graphics::anim::ClipCursor{};
+    auto sample = graphics::anim::PackedAnimationDecomposed{};
+    auto composed = graphics::anim::PackedAnimation{};
+
+    for (auto time : {0.5f, 1.5f})
+    {
+        graphics::SampleClip(time, clip, cursor, sample);
+        graphics::ComposeMatrices(sample, composed);
+        const auto expected = graphics::ComposeMatrices(time, testData->boneNames, &testData->animation);
+        ASSERT_EQ(composed.offsets.size(), expected.offsets.size());
+        EXPECT_EQ(composed.hasValues, expected.hasValues);
+        for (auto i = 0u; i < 2u; ++i)
+        {
+            EXPECT_TRUE(MatrixEquals(composed.offsets[i], expected.offsets[i]));
+        }
+    }
+}
+
+TEST_F(SkeletalAnimationCalculations_tests, AnimateBones_outputRange_matchesReturnedBones)
+{
+    auto rig = graphics::anim::PackedRig{testData->bonesData};
+    const auto animation = graphics::ComposeMatrices(0.5f, testData->boneNames, &testData->animation);
+    const auto expected = graphics::AnimateBones(rig, animation);
+
+    auto sandbox = std::vector<DirectX::XMMATRIX>{};
+    auto output = std::vector<graphics::SkeletalAnimationData>(rig.vertexToBone.size() + 1);
+    graphics::AnimateBones(rig, animation, sandbox, std::span{output}.subspan(1));
+
+    ASSERT_EQ(expected.size(), 2u);
+    EXPECT_TRUE(MatrixEquals(output[1].finalBoneTransform, expected[0].finalBoneTransform));
+    EXPECT_TRUE(MatrixEquals(output[2].finalBoneTransform, expected[1].finalBoneTransform));
+}
+
+TEST_F(SkeletalAnimationCalculations_tests, CompileClip_bonesWithChildren_orderedBeforeLeafBones)
+{
+    testData->bonesData.boneSpaceToParentSpace[1].numChildren = 1u;
+    testData->bonesData.boneSpaceToParentSpace[1].indexOfFirstChild = 2u;
+    auto rig = graphics::anim::PackedRig{testData->bonesData};
+    auto clip = graphics::CompileClip(rig, testData->animation);
+    EXPECT_EQ(clip.trackBones, (std::vector<uint32_t>{1u, 0u}));
+    EXPECT_EQ(clip.coreTrackCount, 1u);
+}
+
+TEST_F(SkeletalAnimationCalculations_tests, SampleClip_skipLeafBones_onlySamplesCoreTracks)
+{
+    testData->bonesData.boneSpaceToParentSpace[1].numChildren = 1u;
+    testData->bonesData.boneSpaceToParentSpace[1].indexOfFirstChild = 2u;
+    auto rig = graphics::anim::PackedRig{testData->bonesData};
+    auto clip = graphics::CompileClip(rig, testData->animation);
+    auto cursor = graphics::anim::ClipCursor{};
+    auto sample = graphics::anim::PackedAnimationDecomposed{};
+
+    graphics::SampleClip(0.5f, clip, cursor, sample, false);
+    EXPECT_EQ(sample.hasValues, (std::vector<graphics::anim::HasValue>{0, 1, 0}));
+
+    graphics::SampleClip(0.5f, clip, cursor, sample, true);
+    EXPECT_EQ(sample.hasValues, (std::vector<graphics::anim::HasValue>{1, 1, 0}));
+}
+
+TEST_F(SkeletalAnimationCalculations_tests, SelectAnimationLod_fartherUnits_updateLessOften)
+{
+    const auto& near = graphics::SelectAnimationLod(0.0f, true);
+    const auto& far = graphics::SelectAnimationLod(1000.0f, true);
+    EXPECT_EQ(near.updateInterval, 1u);
+    EXPECT_TRUE(near.blend);
+    EXPECT_TRUE(near.animateLeafBones);
+    EXPECT_GT(far.updateInterval, near.updateInterval);
+    EXPECT_FALSE(far.blend);
+    EXPECT_FALSE(far.animateLeafBones);
+}
+
+TEST_F(SkeletalAnimationCalculations_tests, SelectAnimationLod_notVisible_returnsLowestLevel)
+{
+    EXPECT_EQ(&graphics::SelectAnimationLod(0.0f, false), &graphics::SelectAnimationLod(1000.0f, true));
+}
+
+TEST_F(SkeletalAnimationCalculations_tests, IsAnimationUpdateFrame_phases_staggerUpdates)
+{
+    const auto& lod = graphics::SelectAnimationLod(1000.0f, true);
+    for (auto frame = 0ull; frame < lod.updateInterval; ++frame)
+    {
+        auto updates = 0u;
+        for (auto phase = 0u; phase < lod.updateInterval; ++phase)
+        {
+            updates += graphics::IsAnimationUpdateFrame(frame, phase, lod);
+        }
+
+        EXPECT_EQ(updates, 1u);
+    }
+}
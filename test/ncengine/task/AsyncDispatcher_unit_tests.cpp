@@ -0,0 +1,110 @@
+#include "gtest/gtest.h"
+#include "ncengine/task/AsyncDispatcher.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace nc::task;
+
+class AsyncDispatcherTest : public ::testing::Test
+{
+    public:
+        tf::Executor executor{4};
+        AsyncDispatcher uut{&executor};
+};
+
+TEST_F(AsyncDispatcherTest, ParallelFor_zeroCount_invokesSingleEmptyRange)
+{
+    auto calls = std::vector<std::pair<size_t, size_t>>{};
+    uut.ParallelFor(0, 16, [&calls](size_t begin, size_t end) { calls.emplace_back(begin, end); });
+    ASSERT_EQ(1ull, calls.size());
+    EXPECT_EQ(0ull, calls[0].first);
+    EXPECT_EQ(0ull, calls[0].second);
+}
+
+TEST_F(AsyncDispatcherTest, ParallelFor_countBelowGrainSize_runsOnCallingThread)
+{
+    const auto caller = std::this_thread::get_id();
+    auto calls = 0ull;
+    uut.ParallelFor(10, 16, [&](size_t begin, size_t end)
+    {
+        EXPECT_EQ(caller, std::this_thread::get_id());
+        EXPECT_EQ(0ull, begin);
+        EXPECT_EQ(10ull, end);
+        ++calls;
+    });
+
+    EXPECT_EQ(1ull, calls);
+}
+
+TEST_F(AsyncDispatcherTest, ParallelFor_coversRangeExactlyOnce)
+{
+    constexpr auto count = 1000ull;
+    auto hits = std::vector<int>(count, 0);
+    auto chunks = std::vector<std::pair<size_t, size_t>>{};
+    auto mutex = std::mutex{};
+    uut.ParallelFor(count, 10, [&](size_t begin, size_t end)
+    {
+        for (auto i = begin; i < end; ++i)
+            ++hits[i];
+
+        auto lock = std::lock_guard{mutex};
+        chunks.emplace_back(begin, end);
+    });
+
+    EXPECT_TRUE(std::ranges::all_of(hits, [](auto hit) { return hit == 1; }));
+    EXPECT_LE(chunks.size(), uut.MaxConcurrency());
+    EXPECT_GT(chunks.size(), 1ull);
+}
+
+TEST_F(AsyncDispatcherTest, ParallelFor_zeroGrainSize_treatedAsOne)
+{
+    auto total = std::atomic<size_t>{0};
+    uut.ParallelFor(8, 0, [&total](size_t begin, size_t end) { total += end - begin; });
+    EXPECT_EQ(8ull, total.load());
+}
+
+TEST_F(AsyncDispatcherTest, ParallelFor_chunkThrows_rethrowsAfterCompletion)
+{
+    auto total = std::atomic<size_t>{0};
+    EXPECT_THROW(
+        uut.ParallelFor(100, 1, [&total](size_t begin, size_t end)
+        {
+            total += end - begin;
+            if (begin != 0)
+                throw std::runtime_error{"chunk failed"};
+        }),
+        std::runtime_error
+    );
+
+    EXPECT_EQ(100ull, total.load());
+}
+
+TEST_F(AsyncDispatcherTest, ParallelFor_nestedInWorker_completes)
+{
+    constexpr auto outerCount = 8ull;
+    constexpr auto innerCount = 64ull;
+    auto sums = std::vector<size_t>(outerCount, 0);
+    uut.ParallelFor(outerCount, 1, [&](size_t outerBegin, size_t outerEnd)
+    {
+        for (auto i = outerBegin; i < outerEnd; ++i)
+        {
+            auto sum = std::atomic<size_t>{0};
+            uut.ParallelFor(innerCount, 1, [&sum](size_t begin, size_t end)
+            {
+                for (auto j = begin; j < end; ++j)
+                    sum += j;
+            });
+
+            sums[i] = sum.load();
+        }
+    });
+
+    const auto expected = innerCount * (innerCount - 1) / 2;
+    EXPECT_TRUE(std::ranges::all_of(sums, [expected](auto sum) { return sum == expected; }));
+}
@@ -1,8 +1,11 @@
 #include "gtest/gtest.h"
 #include "task/Executor.h"
 
+#include <atomic>
+#include <chrono>
 #include <mutex>
 #include <sstream>
+#include <thread>
 
 auto s_numTasksRun = size_t{};
 auto s_updateInvokeOrder = std::vector<size_t>{};
@@ -204,6 +207,37 @@ struct GraphRebuildModule : nc::Module
     }
 };
 
+// Module whose render task waits for an update task, which only succeeds if the graphs run concurrently
+struct OverlapModule : nc::Module
+{
+    static constexpr auto Timeout = std::chrono::seconds{5};
+    std::atomic<bool> updateRan = false;
+    std::atomic<bool> overlapped = false;
+
+    void OnBuildTaskGraph(nc::task::UpdateTasks& update, nc::task::RenderTasks& render) override
+    {
+        update.Add(g_updateId1, "", [this] { updateRan = true; });
+        render.Add(g_renderId1, "", [this] {
+            const auto deadline = std::chrono::steady_clock::now() + Timeout;
+            while (!updateRan && std::chrono::steady_clock::now() < deadline)
+            {
+                std::this_thread::yield();
+            }
+
+            overlapped = updateRan.load();
+        });
+    }
+};
+
+// Module whose render task throws
+struct ThrowingRenderModule : nc::Module
+{
+    void OnBuildTaskGraph(nc::task::UpdateTasks&, nc::task::RenderTasks& render) override
+    {
+        render.Add(g_renderId1, "", [] { throw std::runtime_error("failed task"); });
+    }
+};
+
 // Fixture to wipe counters
 class ExecutorTests : public ::testing::Test
 {
@@ -310,6 +344,45 @@ TEST_F(ExecutorTests, SetContext_graphRunning_throws)
     EXPECT_THROW(uut.RunUpdateTasks(), nc::NcError);
 }
 
+TEST_F(ExecutorTests, BeginRenderTasks_runsConcurrentlyWithUpdate)
+{
+    auto modules = BuildModules<OverlapModule>();
+    auto uut = nc::task::Executor{4, nc::task::BuildContext(modules)};
+    uut.BeginRenderTasks();
+    EXPECT_TRUE(uut.IsRunningRenderTasks());
+    EXPECT_NO_THROW(uut.RunUpdateTasks());
+    EXPECT_NO_THROW(uut.WaitRenderTasks());
+    EXPECT_FALSE(uut.IsRunningRenderTasks());
+    EXPECT_TRUE(dynamic_cast<OverlapModule*>(modules.at(0).get())->overlapped);
+}
+
+TEST_F(ExecutorTests, BeginRenderTasks_alreadyRunning_throws)
+{
+    auto modules = BuildModules<SingleTaskModule>();
+    auto uut = nc::task::Executor{4, nc::task::BuildContext(modules)};
+    uut.BeginRenderTasks();
+    EXPECT_THROW(uut.BeginRenderTasks(), nc::NcError);
+    EXPECT_THROW(uut.SetContext(nc::task::BuildContext(modules)), nc::NcError);
+    EXPECT_NO_THROW(uut.WaitRenderTasks());
+}
+
+TEST_F(ExecutorTests, WaitRenderTasks_notRunning_doesNothing)
+{
+    auto modules = BuildModules<SingleTaskModule>();
+    auto uut = nc::task::Executor{4, nc::task::BuildContext(modules)};
+    EXPECT_NO_THROW(uut.WaitRenderTasks());
+    EXPECT_EQ(0ull, s_numTasksRun);
+}
+
+TEST_F(ExecutorTests, WaitRenderTasks_taskThrows_rethrows)
+{
+    auto modules = BuildModules<ThrowingRenderModule>();
+    auto uut = nc::task::Executor{4, nc::task::BuildContext(modules)};
+    uut.BeginRenderTasks();
+    EXPECT_THROW(uut.WaitRenderTasks(), std::exception);
+    EXPECT_FALSE(uut.IsRunningRenderTasks());
+}
+
 TEST_F(ExecutorTests, WriteGraph_writesToStream)
 {
     auto modules = BuildModules<SingleTaskModule>();
@@ -2,6 +2,8 @@
 #include "time/StepTimer.h"
 
 #include <algorithm>
+#include <chrono>
+#include <thread>
 #include <vector>
 
 void TestUpdate(float) {}
@@ -118,3 +120,71 @@ TEST(StepTimerTests, Reset_resetsTimeStamps)
     uut.Reset();
     EXPECT_FALSE(uut.Tick(TestUpdate)); // dt should be near 0, not 20ms
 }
+
+TEST(StepTimerTests, Tick_fixedStepWithBacklog_runsMultipleSteps)
+{
+    auto invocations = 0ull;
+    auto update = [&invocations](float) { ++invocations; };
+    auto uut = nc::time::StepTimer{0.02, 0.1, 4u};
+    uut.Reset();
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    EXPECT_TRUE(uut.Tick(update));
+    EXPECT_EQ(2ull, uut.GetFramesThisTick());
+    EXPECT_EQ(2ull, invocations);
+}
+
+TEST(StepTimerTests, Tick_fixedStepBacklogExceedsMaxSteps_dropsExcess)
+{
+    auto uut = nc::time::StepTimer{0.02, 0.1, 2u};
+    uut.Reset();
+    std::this_thread::sleep_for(std::chrono::milliseconds{70});
+    EXPECT_TRUE(uut.Tick(TestUpdate));
+    EXPECT_EQ(2ull, uut.GetFramesThisTick());
+    EXPECT_FALSE(uut.Tick(TestUpdate)); // only the partial step should remain
+}
+
+TEST(StepTimerTests, Tick_fixedStepWithPacing_waitsForNextStep)
+{
+    constexpr auto expectedFrames = 5ull;
+    constexpr auto timeStep = 0.01;
+    auto uut = nc::time::StepTimer{timeStep, 0.1, 1u, true};
+    uut.Reset();
+    const auto start = std::chrono::steady_clock::now();
+    for (auto i = 0ull; i < expectedFrames; ++i)
+    {
+        EXPECT_TRUE(uut.Tick(TestUpdate));
+    }
+
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    EXPECT_EQ(expectedFrames, uut.GetFrameCount());
+    EXPECT_LE(timeStep * (expectedFrames - 1), elapsed);
+}
+
+TEST(FixedStepAccumulatorTests, Advance_carriesRemainder)
+{
+    auto uut = nc::time::FixedStepAccumulator{0.01, 8u};
+    EXPECT_EQ(0u, uut.Advance(0.004));
+    EXPECT_NEAR(0.4f, uut.Alpha(), 1e-4f);
+    EXPECT_EQ(1u, uut.Advance(0.008));
+    EXPECT_NEAR(0.2f, uut.Alpha(), 1e-4f);
+    EXPECT_EQ(3u, uut.Advance(0.03));
+    EXPECT_NEAR(0.2f, uut.Alpha(), 1e-4f);
+}
+
+TEST(FixedStepAccumulatorTests, Advance_exceedsMaxSteps_dropsExcess)
+{
+    auto uut = nc::time::FixedStepAccumulator{0.01, 2u};
+    EXPECT_EQ(2u, uut.Advance(0.055));
+    EXPECT_NEAR(0.5f, uut.Alpha(), 1e-4f);
+    EXPECT_EQ(1u, uut.Advance(0.005));
+    EXPECT_NEAR(0.0f, uut.Alpha(), 1e-4f);
+}
+
+TEST(FixedStepAccumulatorTests, Reset_clearsAccumulatedTime)
+{
+    auto uut = nc::time::FixedStepAccumulator{0.01, 4u};
+    uut.Advance(0.005);
+    uut.Reset();
+    EXPECT_EQ(0.0f, uut.Alpha());
+    EXPECT_EQ(0u, uut.Advance(0.009));
+}